@@ -0,0 +1,245 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSDatasmithRuntimeActor.h"
+#include "../Runtime/DSMetadataViewFilter.h"
+
+#include "IDatasmithSceneElements.h"
+
+// Logging category for this class
+DEFINE_LOG_CATEGORY_STATIC(LogDSDatasmithRuntimeActor, Log, All);
+
+void ADSDatasmithRuntimeActor::Tick(float DeltaSeconds)
+{
+    // Listeners run before the runtime actor learns the delta is complete and starts applying it below
+    if (bDeltaClosed.exchange(false))
+    {
+        FDSDatasmithUpdate Update;
+        TArray<TSharedPtr<IDatasmithElement>> Forwarded;
+        {
+            FScopeLock Lock(&PendingUpdateLock);
+            FilterElements(Forwarded);
+            Update = MoveTemp(PendingUpdate);
+            PendingUpdate = FDSDatasmithUpdate();
+        }
+
+        // Elements the delta did not carry are reported as changed so the importer picks up their new mesh
+        for (const TSharedPtr<IDatasmithElement>& Element : Forwarded)
+        {
+            Update.ActorNames.Add(Element->GetName());
+            Super::OnChangedElement(Element->GetNodeId(), Element);
+        }
+
+        UE_LOG(LogDSDatasmithRuntimeActor, Verbose, TEXT("Received update with %d changed actors%s"),
+               Update.ActorNames.Num(), Update.bTouchesAll ? TEXT(", touching every component") : TEXT(""));
+
+        OnUpdateReceived.Broadcast(Update);
+        Super::OnCloseDelta();
+    }
+
+    Super::Tick(DeltaSeconds);
+}
+
+void ADSDatasmithRuntimeActor::SetElementFilter(TSharedPtr<const FDSMetadataViewFilter> InFilter)
+{
+    ElementFilter = InFilter;
+}
+
+void ADSDatasmithRuntimeActor::OnOpenDelta()
+{
+    {
+        FScopeLock Lock(&PendingUpdateLock);
+        PendingUpdate = FDSDatasmithUpdate();
+        PendingActors.Reset();
+        PendingElementIds.Reset();
+        bPendingNewScene = false;
+    }
+
+    Super::OnOpenDelta();
+}
+
+void ADSDatasmithRuntimeActor::OnNewScene(const DirectLink::FSceneIdentifier& SceneId)
+{
+    {
+        FScopeLock Lock(&PendingUpdateLock);
+        PendingUpdate.bTouchesAll = true;
+        bPendingNewScene = true;
+        MetadataByElement.Reset();
+    }
+
+    Super::OnNewScene(SceneId);
+}
+
+void ADSDatasmithRuntimeActor::OnAddElement(DirectLink::FSceneGraphId ElementId, TSharedPtr<IDatasmithElement> Element)
+{
+    RecordElement(ElementId, Element);
+    Super::OnAddElement(ElementId, Element);
+}
+
+void ADSDatasmithRuntimeActor::OnChangedElement(DirectLink::FSceneGraphId ElementId, TSharedPtr<IDatasmithElement> Element)
+{
+    RecordElement(ElementId, Element);
+    Super::OnChangedElement(ElementId, Element);
+}
+
+void ADSDatasmithRuntimeActor::OnCloseDelta()
+{
+    // Forwarded from the next tick, after the listeners have seen the update
+    bDeltaClosed = true;
+}
+
+void ADSDatasmithRuntimeActor::RecordElement(DirectLink::FSceneGraphId ElementId, const TSharedPtr<IDatasmithElement>& Element)
+{
+    if (!Element.IsValid())
+    {
+        return;
+    }
+
+    // Removed elements only destroy components, materials and textures can change on components of any mobility
+    FScopeLock Lock(&PendingUpdateLock);
+    PendingElementIds.Add(ElementId);
+    if (Element->IsA(EDatasmithElementType::Actor))
+    {
+        PendingUpdate.ActorNames.Add(Element->GetName());
+        PendingActors.Add(StaticCastSharedPtr<IDatasmithActorElement>(Element));
+    }
+    else if (Element->IsA(EDatasmithElementType::StaticMesh))
+    {
+        // Every component using the mesh gets its rebuilt version
+        PendingUpdate.bTouchesAll = true;
+    }
+    else if (Element->IsA(EDatasmithElementType::MetaData))
+    {
+        // Metadata is an element of its own and may arrive after its actor, which is filtered again with it
+        const TSharedPtr<IDatasmithMetaDataElement> Metadata = StaticCastSharedPtr<IDatasmithMetaDataElement>(Element);
+        const TSharedPtr<IDatasmithElement> Associated = Metadata->GetAssociatedElement();
+        if (Associated.IsValid())
+        {
+            MetadataByElement.Add(Associated->GetName(), Metadata);
+            if (Associated->IsA(EDatasmithElementType::Actor))
+            {
+                PendingActors.Add(StaticCastSharedPtr<IDatasmithActorElement>(Associated));
+            }
+        }
+    }
+}
+
+void ADSDatasmithRuntimeActor::FilterElements(TArray<TSharedPtr<IDatasmithElement>>& OutForwarded)
+{
+    if (bPendingNewScene)
+    {
+        // The previous scene's elements are gone, their meshes cannot be given back
+        DroppedMeshPaths.Reset();
+    }
+
+    // Metadata lives on ancestors too, so everything below a received actor is evaluated again
+    int32 NumDropped = 0;
+    int32 NumRestored = 0;
+    if (ElementFilter.IsValid() || DroppedMeshPaths.Num() > 0)
+    {
+        TSet<const IDatasmithActorElement*> Visited;
+        TArray<TSharedPtr<IDatasmithActorElement>> Stack = PendingActors;
+        while (Stack.Num() > 0)
+        {
+            const TSharedPtr<IDatasmithActorElement> Actor = Stack.Pop();
+            bool bAlreadyVisited = false;
+            Visited.Add(Actor.Get(), &bAlreadyVisited);
+            if (!Actor.IsValid() || bAlreadyVisited)
+            {
+                continue;
+            }
+
+            for (int32 ChildIndex = 0; ChildIndex < Actor->GetChildrenCount(); ++ChildIndex)
+            {
+                Stack.Add(Actor->GetChild(ChildIndex));
+            }
+
+            if (!Actor->IsA(EDatasmithElementType::StaticMeshActor))
+            {
+                continue;
+            }
+
+            const TSharedPtr<IDatasmithMeshActorElement> MeshActor = StaticCastSharedPtr<IDatasmithMeshActorElement>(Actor);
+            const FString Name = MeshActor->GetName();
+            const bool bInDelta = PendingElementIds.Contains(MeshActor->GetNodeId());
+            const bool bPasses = !ElementFilter.IsValid() || ElementFilter->Passes([this, &Actor](FName Key, FString& OutValue)
+            {
+                return FindElementMetadata(Actor, Key, OutValue);
+            });
+
+            // A changed element is received with its mesh again
+            if (bInDelta && FCString::Strlen(MeshActor->GetStaticMeshPathName()) > 0)
+            {
+                DroppedMeshPaths.Remove(Name);
+            }
+
+            if (const FString* DroppedPath = DroppedMeshPaths.Find(Name))
+            {
+                if (!bPasses)
+                {
+                    continue;
+                }
+                MeshActor->SetStaticMeshPathName(**DroppedPath);
+                DroppedMeshPaths.Remove(Name);
+                ++NumRestored;
+            }
+            else
+            {
+                if (bPasses)
+                {
+                    continue;
+                }
+                DroppedMeshPaths.Add(Name, MeshActor->GetStaticMeshPathName());
+                MeshActor->SetStaticMeshPathName(TEXT(""));
+                ++NumDropped;
+            }
+
+            if (!bInDelta)
+            {
+                OutForwarded.Add(MeshActor);
+            }
+        }
+    }
+
+    if (NumDropped > 0 || NumRestored > 0)
+    {
+        UE_LOG(LogDSDatasmithRuntimeActor, Log, TEXT("Element filter dropped %d and gave back %d meshes, %d mesh actors are not built"),
+               NumDropped, NumRestored, DroppedMeshPaths.Num());
+    }
+
+    PendingActors.Reset();
+    PendingElementIds.Reset();
+    bPendingNewScene = false;
+}
+
+bool ADSDatasmithRuntimeActor::FindElementMetadata(const TSharedPtr<IDatasmithActorElement>& Actor, FName Key, FString& OutValue) const
+{
+    const FString KeyName = Key.ToString();
+    for (TSharedPtr<IDatasmithActorElement> Current = Actor; Current.IsValid(); Current = Current->GetParentActor())
+    {
+        const TSharedPtr<IDatasmithMetaDataElement>* Metadata = MetadataByElement.Find(Current->GetName());
+        if (!Metadata)
+        {
+            continue;
+        }
+
+        for (int32 PropertyIndex = 0; PropertyIndex < (*Metadata)->GetPropertiesCount(); ++PropertyIndex)
+        {
+            const TSharedPtr<IDatasmithKeyValueProperty> Property = (*Metadata)->GetProperty(PropertyIndex);
+            if (Property.IsValid() && KeyName.Equals(Property->GetName(), ESearchCase::IgnoreCase))
+            {
+                OutValue = Property->GetValue();
+                return true;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,120 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DatasmithRuntime.h"
+#include <atomic>
+#include "DSDatasmithRuntimeActor.generated.h"
+
+/**
+ * Elements changed by a DirectLink update, reported before the importer applies it
+ */
+struct FDSDatasmithUpdate
+{
+    /** Names of the actor elements added or changed by the update */
+    TSet<FString> ActorNames;
+
+    /** Set when the update can touch any component: a new scene, or a changed mesh */
+    bool bTouchesAll = false;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FDSOnDatasmithUpdateReceived, const FDSDatasmithUpdate&);
+
+// Forward declarations
+class FDSMetadataViewFilter;
+class IDatasmithActorElement;
+class IDatasmithMetaDataElement;
+
+/**
+ * ADSDatasmithRuntimeActor - Datasmith runtime actor that reports what an update changes
+ *
+ * DirectLink delivers an update on its own thread, and the runtime actor applies it in its
+ * next tick once the delta has closed. Passes that must be undone before the importer sees
+ * their components need to know which ones an update touches, and must run before that tick.
+ * The element callbacks record the changed actor elements, and closing the delta is forwarded
+ * to the runtime actor from the game thread right after OnUpdateReceived has been broadcast,
+ * so the update is never applied before its listeners have run.
+ *
+ * The same window is used to filter the received elements by metadata: mesh actors that do
+ * not pass the element filter lose their mesh before the delta is forwarded, so the importer
+ * never builds, uploads or spawns geometry for them. Their mesh is given back when a later
+ * delta makes them pass again; rule changes need a new import to bring them back.
+ */
+UCLASS()
+class DATASMITHTEST_API ADSDatasmithRuntimeActor : public ADatasmithRuntimeActor
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Tick(float DeltaSeconds) override;
+
+    // ISceneChangeListener interface, called on the DirectLink thread
+    virtual void OnOpenDelta() override;
+    virtual void OnNewScene(const DirectLink::FSceneIdentifier& SceneId) override;
+    virtual void OnAddElement(DirectLink::FSceneGraphId ElementId, TSharedPtr<IDatasmithElement> Element) override;
+    virtual void OnChangedElement(DirectLink::FSceneGraphId ElementId, TSharedPtr<IDatasmithElement> Element) override;
+    virtual void OnCloseDelta() override;
+
+    /**
+     * Sets the rules received elements must pass to be built, applied from the next delta on
+     * @param InFilter Metadata rules, null to build every element
+     */
+    void SetElementFilter(TSharedPtr<const FDSMetadataViewFilter> InFilter);
+
+    /**
+     * Gets the number of mesh actors whose mesh is currently dropped by the element filter
+     */
+    int32 GetNumDroppedElements() const { return DroppedMeshPaths.Num(); }
+
+    /** Broadcast on the game thread once an update has been received, before it is applied */
+    FDSOnDatasmithUpdateReceived OnUpdateReceived;
+
+private:
+    /**
+     * Records an added or changed element
+     */
+    void RecordElement(DirectLink::FSceneGraphId ElementId, const TSharedPtr<IDatasmithElement>& Element);
+
+    /**
+     * Drops or gives back the mesh of every mesh actor at or below the delta's actors, called with
+     * PendingUpdateLock held before the delta is forwarded
+     * @param OutForwarded Elements outside the delta whose mesh changed, to be reported as changed
+     */
+    void FilterElements(TArray<TSharedPtr<IDatasmithElement>>& OutForwarded);
+
+    /**
+     * Gets the metadata value of an actor element or its closest ancestor that has the key
+     */
+    bool FindElementMetadata(const TSharedPtr<IDatasmithActorElement>& Actor, FName Key, FString& OutValue) const;
+
+    /** Rules received elements are filtered with, game thread */
+    TSharedPtr<const FDSMetadataViewFilter> ElementFilter;
+
+    /** Original mesh of the mesh actors dropped by the filter, by element name, game thread */
+    TMap<FString, FString> DroppedMeshPaths;
+
+    /** Changes of the delta being received, guarded by PendingUpdateLock */
+    FDSDatasmithUpdate PendingUpdate;
+    FCriticalSection PendingUpdateLock;
+
+    /** Actor elements of the delta being received and the ids of all its elements, guarded by PendingUpdateLock */
+    TArray<TSharedPtr<IDatasmithActorElement>> PendingActors;
+    TSet<DirectLink::FSceneGraphId> PendingElementIds;
+    bool bPendingNewScene = false;
+
+    /** Metadata of the received scene by the name of the element it describes, guarded by PendingUpdateLock */
+    TMap<FString, TSharedPtr<IDatasmithMetaDataElement>> MetadataByElement;
+
+    /** Set when a delta has closed and is waiting to be forwarded from the game thread */
+    std::atomic<bool> bDeltaClosed{ false };
+};
@@ -19,7 +19,9 @@
 #include "Components/SpotLightComponent.h"
 #include "SocketSubsystem.h"
 #include "IPAddress.h"
-#include "Json.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "../Runtime/DSTrace.h"
 
 /**
  * @brief Constructor - enables ticking for processing queued TCP data
@@ -32,8 +34,8 @@ ADSLightSyncer::ADSLightSyncer()
 /**
  * @brief Called when the actor begins play
  * 
- * Optionally starts the TCP listener immediately. You can also call
- * StartTcpListener() manually from Blueprint or C++.
+ * Spawns the lights of the light cache when there is one. The TCP listener
+ * is started by StartTcpListener() from Blueprint or C++, or by sync node mode.
  */
 void ADSLightSyncer::BeginPlay()
 {
@@ -41,6 +43,43 @@ void ADSLightSyncer::BeginPlay()
 	
 	// Optionally start listening immediately when the game starts
 	// StartTcpListener();
+
+	// Start from the lights a sync node (or an earlier session) received last
+	FString CachedJsonData;
+	if (bLoadLightCacheOnStart && FFileHelper::LoadFileToString(CachedJsonData, *GetLightCacheFilePath()))
+	{
+		UE_LOG(LogTemp, Log, TEXT("Loading cached light data from %s"), *GetLightCacheFilePath());
+		ProcessReceivedLightData(CachedJsonData);
+	}
+}
+
+/**
+ * @brief Switches to headless sync node operation
+ * 
+ * Starts listening immediately and writes every light event received to the
+ * light cache, so interactive viewers can start from the latest lights.
+ */
+void ADSLightSyncer::EnterSyncNodeMode()
+{
+	bWriteLightCache = true;
+	StartTcpListener();
+
+	UE_LOG(LogTemp, Log, TEXT("Light syncer running as sync node, caching light data in %s"), *GetLightCacheFilePath());
+}
+
+/**
+ * @brief Gets the resolved light cache file path
+ * 
+ * @return LightCachePath, or the default location in the project's Saved directory when it is empty
+ */
+FString ADSLightSyncer::GetLightCacheFilePath() const
+{
+	if (!LightCachePath.IsEmpty())
+	{
+		return LightCachePath;
+	}
+
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("DatasmithTest"), TEXT("LightCache"), TEXT("Lights.json"));
 }
 
 /**
@@ -65,6 +104,13 @@ void ADSLightSyncer::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 	ProcessQueuedData(); // Process any queued light data from TCP
+	ProcessReplay(); // Feed light data of a replayed capture
+
+	// Per-frame light sync counters for CSV captures
+	CSV_CUSTOM_STAT(DSLightSync, EventsProcessed, NumEventsThisFrame, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(DSLightSync, Lights, SpawnedLights.Num(), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(DSLightSync, ReplayEventsPending, ReplayEvents.Num() - NextReplayEvent, ECsvCustomStatOp::Set);
+	NumEventsThisFrame = 0;
 }
 
 /**
@@ -214,201 +260,152 @@ void ADSLightSyncer::ProcessQueuedData()
 	FString JsonData;
 	while (IncomingDataQueue.Dequeue(JsonData))
 	{
+		// Only data from the network is recorded, replayed events would otherwise record themselves
+		if (!CaptureFilePath.IsEmpty())
+		{
+			// JSON needs no line breaks outside strings, so every event fits on one line
+			const FString Line = FString::Printf(TEXT("%.3f\t%s\n"), FPlatformTime::Seconds() - CaptureStartTime,
+				*JsonData.Replace(TEXT("\r"), TEXT(" ")).Replace(TEXT("\n"), TEXT(" ")));
+			FFileHelper::SaveStringToFile(Line, *CaptureFilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+		}
+
 		ProcessReceivedLightData(JsonData);
 	}
 }
 
 /**
- * @brief Processes received light data from Rhino
+ * @brief Starts recording light events received over TCP
  * 
- * Parses the JSON light data and spawns/updates lights in the Unreal scene.
+ * Each event is appended to the capture file as one line holding the seconds since
+ * recording started, a tab and the JSON data, so ReplayCapture can reproduce the session.
  * 
- * @param JsonData The JSON string containing light information from Rhino
+ * @param FilePath Capture file, overwritten if it exists
+ * @return True if the capture file could be created
  */
-void ADSLightSyncer::ProcessReceivedLightData(const FString& JsonData)
+bool ADSLightSyncer::StartCapture(const FString& FilePath)
 {
-	// Parse the JSON data from Rhino
-	FRhinoLightData LightData = ParseJsonLightData(JsonData);
-	
-	if (!LightData.bIsValid)
+	if (!FFileHelper::SaveStringToFile(FString(), *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Failed to parse received light data from Rhino"));
-		return;
+		UE_LOG(LogTemp, Error, TEXT("Failed to create light capture file: %s"), *FilePath);
+		return false;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Processing light event from Rhino: %s with %d lights"), 
-		*LightData.EventType, LightData.LightCount);
+	CaptureFilePath = FilePath;
+	CaptureStartTime = FPlatformTime::Seconds();
+	UE_LOG(LogTemp, Log, TEXT("Recording light events to %s"), *CaptureFilePath);
+	return true;
+}
 
-	// Spawn/update lights from the received data
-	SpawnLightsFromJsonData(LightData);
+/**
+ * @brief Stops recording light events
+ */
+void ADSLightSyncer::StopCapture()
+{
+	if (!CaptureFilePath.IsEmpty())
+	{
+		UE_LOG(LogTemp, Log, TEXT("Stopped recording light events to %s"), *CaptureFilePath);
+		CaptureFilePath.Reset();
+	}
 }
 
 /**
- * @brief Parses JSON light data received from Rhino
+ * @brief Replays a capture recorded by StartCapture
  * 
- * Converts the simplified JSON structure from Rhino into Unreal-compatible data structures.
- * Handles the streamlined format that includes rotation directly.
+ * Events are fed to ProcessReceivedLightData from Tick, either at their recorded
+ * times or one per frame when timing is not kept.
  * 
- * @param JsonData The JSON string from Rhino
- * @return Parsed light data structure
+ * @param FilePath Capture file to replay
+ * @param bKeepTiming Whether to reproduce the recorded delays between events
+ * @return True if the capture holds at least one event
  */
-ADSLightSyncer::FRhinoLightData ADSLightSyncer::ParseJsonLightData(const FString& JsonData)
+bool ADSLightSyncer::ReplayCapture(const FString& FilePath, bool bKeepTiming)
 {
-	FRhinoLightData Result;
-	Result.bIsValid = false;
-
-	// Parse the JSON string into an object
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonData);
-
-	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *FilePath))
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to parse JSON data from Rhino"));
-		return Result;
+		UE_LOG(LogTemp, Error, TEXT("Failed to load light capture file: %s"), *FilePath);
+		return false;
 	}
 
-	// Extract main fields from simplified JSON structure
-	Result.EventType = JsonObject->GetStringField(TEXT("event"));
-	Result.LightCount = JsonObject->GetIntegerField(TEXT("lightCount"));
-
-	UE_LOG(LogTemp, Log, TEXT("Parsing Rhino event: %s with %d lights"), *Result.EventType, Result.LightCount);
-
-	// Parse lights array
-	const TArray<TSharedPtr<FJsonValue>>* LightsArray;
-	if (JsonObject->TryGetArrayField(TEXT("lights"), LightsArray))
+	ReplayEvents.Reset();
+	for (const FString& Line : Lines)
 	{
-		for (const auto& LightValue : *LightsArray)
+		FString TimeString;
+		FString JsonData;
+		if (Line.Split(TEXT("\t"), &TimeString, &JsonData))
 		{
-			TSharedPtr<FJsonObject> LightObject = LightValue->AsObject();
-			if (LightObject.IsValid())
-			{
-				FLightData LightData = ParseJsonLight(LightObject);
-				if (LightData.bIsValid)
-				{
-					Result.Lights.Add(LightData);
-				}
-			}
+			ReplayEvents.Emplace(FCString::Atod(*TimeString), JsonData);
 		}
 	}
 
-	// Validate that we parsed the expected number of lights
-	Result.bIsValid = (Result.Lights.Num() == Result.LightCount);
-	
-	if (Result.bIsValid)
-	{
-		UE_LOG(LogTemp, Log, TEXT("Successfully parsed %d lights from Rhino"), Result.Lights.Num());
-	}
-	else
-	{
-		UE_LOG(LogTemp, Error, TEXT("Light count mismatch: expected %d, parsed %d"), Result.LightCount, Result.Lights.Num());
-	}
+	NextReplayEvent = 0;
+	ReplayStartTime = FPlatformTime::Seconds();
+	bReplayKeepTiming = bKeepTiming;
 
-	return Result;
+	UE_LOG(LogTemp, Log, TEXT("Replaying %d light events from %s"), ReplayEvents.Num(), *FilePath);
+	return ReplayEvents.Num() > 0;
 }
 
 /**
- * @brief Parses individual light data from JSON
- * 
- * Extracts position, rotation, intensity, color and spotlight parameters
- * from the simplified JSON structure sent by Rhino.
- * 
- * @param LightObject JSON object containing a single light's data
- * @return Parsed light data structure
+ * @brief Feeds the events of the replayed capture that are due
  */
-ADSLightSyncer::FLightData ADSLightSyncer::ParseJsonLight(const TSharedPtr<FJsonObject>& LightObject)
+void ADSLightSyncer::ProcessReplay()
 {
-	FLightData Result;
-	Result.bIsValid = false;
-
-	if (!LightObject.IsValid())
+	if (!IsReplayingCapture())
 	{
-		return Result;
+		return;
 	}
 
-	// Parse light type (Point, Directional, Spot)
-	Result.LightType = LightObject->GetStringField(TEXT("type"));
-
-	// Parse location from Rhino (coordinates are in meters)
-	const TSharedPtr<FJsonObject>* LocationObject;
-	if (LightObject->TryGetObjectField(TEXT("location"), LocationObject) && LocationObject->IsValid())
+	// With timing kept, every event recorded up to now is due; otherwise one event per frame
+	const double Elapsed = FPlatformTime::Seconds() - ReplayStartTime;
+	int32 NumFed = 0;
+	while (IsReplayingCapture() && (bReplayKeepTiming ? ReplayEvents[NextReplayEvent].Key <= Elapsed : NumFed == 0))
 	{
-		// Rhino coordinates to Unreal coordinates conversion
-		// Rhino: X=Right, Y=Forward, Z=Up
-		// Unreal: X=Forward, Y=Right, Z=Up
-		// So we swap X and Y from Rhino to get proper Unreal coordinates
-		float RhinoX = (*LocationObject)->GetNumberField(TEXT("x"));
-		float RhinoY = (*LocationObject)->GetNumberField(TEXT("y"));
-		float RhinoZ = (*LocationObject)->GetNumberField(TEXT("z"));
-		
-		// Convert from meters to Unreal units (1m = 100 Unreal units)
-		// and apply coordinate system conversion
-		Result.Location = FVector(
-			RhinoX * 100.0f,  // Unreal X = Rhino X
-			-RhinoY * 100.0f, // Unreal Y = -Rhino Y (negated for coordinate system conversion)
-			RhinoZ * 100.0f   // Unreal Z = Rhino Z
-		);
+		ProcessReceivedLightData(ReplayEvents[NextReplayEvent++].Value);
+		++NumFed;
 	}
 
-	// Parse rotation directly from Rhino (no complex conversion needed)
-	const TSharedPtr<FJsonObject>* RotationObject;
-	if (LightObject->TryGetObjectField(TEXT("rotation"), RotationObject) && RotationObject->IsValid())
+	if (!IsReplayingCapture())
 	{
-		// Get rotation values in degrees from Rhino
-		float Pitch = (*RotationObject)->GetNumberField(TEXT("pitch"));
-		float Yaw = (*RotationObject)->GetNumberField(TEXT("yaw"));
-		float Roll = (*RotationObject)->GetNumberField(TEXT("roll"));
-		
-		// Direct rotation conversion from Rhino to Unreal
-		// Rhino and Unreal both use: Pitch (X-axis), Yaw (Z-axis), Roll (Y-axis)
-		// However, coordinate system differences require adjustment:
-		// - Rhino: X=Right, Y=Forward, Z=Up
-		// - Unreal: X=Forward, Y=Right, Z=Up
-		Result.Rotation = FRotator(
-			Pitch,   // Keep pitch as-is
-			-Yaw,    // Negate yaw for coordinate system conversion
-			Roll     // Keep roll as-is
-		);
-		
-		UE_LOG(LogTemp, Log, TEXT("Parsed rotation from JSON - Pitch: %.3f, Yaw: %.3f, Roll: %.3f"), 
-			Pitch, Yaw, Roll);
-		UE_LOG(LogTemp, Log, TEXT("Applied rotation to Unreal - Pitch: %.3f, Yaw: %.3f, Roll: %.3f"), 
-			Result.Rotation.Pitch, Result.Rotation.Yaw, Result.Rotation.Roll);
+		UE_LOG(LogTemp, Log, TEXT("Light capture replay finished"));
+		ReplayEvents.Reset();
+		NextReplayEvent = 0;
 	}
+}
 
-	// Parse intensity value
-	Result.Intensity = LightObject->GetNumberField(TEXT("intensity"));
+/**
+ * @brief Processes received light data from Rhino
+ * 
+ * Parses the JSON light data and spawns/updates lights in the Unreal scene.
+ * 
+ * @param JsonData The JSON string containing light information from Rhino
+ */
+void ADSLightSyncer::ProcessReceivedLightData(const FString& JsonData)
+{
+	DS_TRACE_SCOPE(ADSLightSyncer::ProcessReceivedLightData);
+	CSV_SCOPED_TIMING_STAT(DSLightSync, ProcessReceivedLightData);
+	++NumEventsThisFrame;
 
-	// Parse RGB color values (0-255 range from Rhino)
-	const TSharedPtr<FJsonObject>* ColorObject;
-	if (LightObject->TryGetObjectField(TEXT("color"), ColorObject) && ColorObject->IsValid())
+	// Parse the JSON data from Rhino
+	FDSRhinoLightData LightData = FDSLightParser::ParseJsonLightData(JsonData);
+	
+	if (!LightData.bIsValid)
 	{
-		int32 R = (*ColorObject)->GetIntegerField(TEXT("r"));
-		int32 G = (*ColorObject)->GetIntegerField(TEXT("g"));
-		int32 B = (*ColorObject)->GetIntegerField(TEXT("b"));
-		
-		// Convert from 0-255 range to 0-1 range for Unreal
-		Result.Color = FLinearColor(R / 255.0f, G / 255.0f, B / 255.0f, 1.0f);
+		UE_LOG(LogTemp, Warning, TEXT("Failed to parse received light data from Rhino"));
+		return;
 	}
 
-	// Parse spotlight parameters if present
-	const TSharedPtr<FJsonObject>* SpotLightObject;
-	if (LightObject->TryGetObjectField(TEXT("spotLight"), SpotLightObject) && SpotLightObject->IsValid())
-	{
-		Result.InnerAngle = (*SpotLightObject)->GetNumberField(TEXT("innerAngle"));
-		Result.OuterAngle = (*SpotLightObject)->GetNumberField(TEXT("outerAngle"));
-	}
-	else
+	UE_LOG(LogTemp, Log, TEXT("Processing light event from Rhino: %s with %d lights"), 
+		*LightData.EventType, LightData.LightCount);
+
+	// Only data that parsed is cached, a viewer must never start from a broken cache
+	if (bWriteLightCache && !FFileHelper::SaveStringToFile(JsonData, *GetLightCacheFilePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
 	{
-		// Default spotlight values for non-spot lights
-		Result.InnerAngle = 0.0f;
-		Result.OuterAngle = 45.0f;
+		UE_LOG(LogTemp, Warning, TEXT("Failed to write light cache: %s"), *GetLightCacheFilePath());
 	}
 
-	Result.bIsValid = true;
-	UE_LOG(LogTemp, VeryVerbose, TEXT("Parsed %s light at location %s with rotation %s"), 
-		*Result.LightType, *Result.Location.ToString(), *Result.Rotation.ToString());
-
-	return Result;
+	// Spawn/update lights from the received data
+	SpawnLightsFromJsonData(LightData);
 }
 
 /**
@@ -420,8 +417,10 @@ ADSLightSyncer::FLightData ADSLightSyncer::ParseJsonLight(const TSharedPtr<FJson
  * 
  * @param LightData The parsed light data from Rhino
  */
-void ADSLightSyncer::SpawnLightsFromJsonData(const FRhinoLightData& LightData)
+void ADSLightSyncer::SpawnLightsFromJsonData(const FDSRhinoLightData& LightData)
 {
+	DS_TRACE_SCOPE(ADSLightSyncer::SpawnLightsFromJsonData);
+
 	// Clear existing lights first to avoid duplicates
 	ClearExistingLights();
 
@@ -430,7 +429,7 @@ void ADSLightSyncer::SpawnLightsFromJsonData(const FRhinoLightData& LightData)
 	// Spawn each light based on its type
 	for (int32 LightIndex = 0; LightIndex < LightData.Lights.Num(); LightIndex++)
 	{
-		const FLightData& Light = LightData.Lights[LightIndex];
+		const FDSLightData& Light = LightData.Lights[LightIndex];
 		AActor* SpawnedLightActor = nullptr;
 		
 		if (Light.LightType == TEXT("Point"))
@@ -563,7 +562,7 @@ void ADSLightSyncer::LoadAndSpawnLights()
 		}
 		
 		// Parse the line using the legacy format
-		FLightData ParsedLight = ParseLightLine(Line);
+		FDSLightData ParsedLight = FDSLightParser::ParseLightLine(Line);
 		if (!ParsedLight.bIsValid)
 		{
 			UE_LOG(LogTemp, Warning, TEXT("Failed to parse line: %s"), *Line);
@@ -649,183 +648,3 @@ void ADSLightSyncer::ClearExistingLights()
 	
 	UE_LOG(LogTemp, Log, TEXT("Cleared %d existing lights"), SpawnedLights.Num());
 }
-
-/**
- * @brief Legacy function to parse light data from text file format
- * 
- * Parses the old text-based format for backwards compatibility.
- * New implementations should use the JSON-based TCP approach.
- */
-ADSLightSyncer::FLightData ADSLightSyncer::ParseLightLine(const FString& Line)
-{
-	FLightData Result;
-	Result.bIsValid = false;
-	
-	// Split the line into components by spaces, but be careful with parentheses
-	TArray<FString> Components;
-	FString CurrentComponent;
-	bool bInParentheses = false;
-	
-	for (int32 i = 0; i < Line.Len(); i++)
-	{
-		TCHAR Char = Line[i];
-		
-		if (Char == '(')
-		{
-			bInParentheses = true;
-			CurrentComponent += Char;
-		}
-		else if (Char == ')')
-		{
-			bInParentheses = false;
-			CurrentComponent += Char;
-		}
-		else if (Char == ' ' && !bInParentheses)
-		{
-			if (!CurrentComponent.IsEmpty())
-			{
-				Components.Add(CurrentComponent.TrimStartAndEnd());
-				CurrentComponent.Empty();
-			}
-		}
-		else
-		{
-			CurrentComponent += Char;
-		}
-	}
-	
-	// Add the last component
-	if (!CurrentComponent.IsEmpty())
-	{
-		Components.Add(CurrentComponent.TrimStartAndEnd());
-	}
-	
-	// Expected format: Type Location Rotation Intensity Color [InnerAngle OuterAngle]
-	if (Components.Num() < 5)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Not enough components in line. Found %d, expected at least 5"), Components.Num());
-		return Result;
-	}
-	
-	// Parse light type
-	Result.LightType = Components[0];
-	
-	// Parse location: (x,y,z)
-	FVector Location = ParseVectorString(Components[1]);
-	if (Location == FVector::ZeroVector && Components[1] != TEXT("(0,0,0)"))
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Failed to parse location: %s"), *Components[1]);
-		return Result;
-	}
-	
-	// Convert to FVector (Rhino to UE4 coordinate conversion) - NOW CONSISTENT WITH JSON PARSING
-	Result.Location.X = Location.X * 100.0f;     // Convert to Unreal units (cm)
-	Result.Location.Y = -Location.Y * 100.0f;    // Negate Y and convert to Unreal units (cm)
-	Result.Location.Z = Location.Z * 100.0f;     // Convert to Unreal units (cm)
-	
-	// Parse rotation: (pitch°, yaw°, roll°)
-	Result.Rotation = ParseRotationString(Components[2]);
-	
-	// Parse intensity
-	Result.Intensity = FCString::Atof(*Components[3]);
-	
-	// Parse color: RGB(r,g,b)
-	Result.Color = ParseColorString(Components[4]);
-	
-	// Parse spot light angles if present (for spot lights)
-	if (Result.LightType == TEXT("Spot") && Components.Num() >= 7)
-	{
-		// Remove degree symbol and parse
-		FString InnerAngleStr = Components[5].Replace(TEXT("°"), TEXT(""));
-		FString OuterAngleStr = Components[6].Replace(TEXT("°"), TEXT(""));
-		
-		Result.InnerAngle = FCString::Atof(*InnerAngleStr);
-		Result.OuterAngle = FCString::Atof(*OuterAngleStr);
-	}
-	else
-	{
-		// Default values for non-spot lights
-		Result.InnerAngle = 0.0f;
-		Result.OuterAngle = 45.0f;
-	}
-	
-	Result.bIsValid = true;
-	return Result;
-}
-
-// Legacy parsing helper functions (kept for file-based compatibility)
-FVector ADSLightSyncer::ParseVectorString(const FString& VectorStr)
-{
-	// Parse vector format: (x,y,z)
-	FString CleanStr = VectorStr;
-	CleanStr = CleanStr.Replace(TEXT("("), TEXT(""));
-	CleanStr = CleanStr.Replace(TEXT(")"), TEXT(""));
-	
-	TArray<FString> VectorParts;
-	CleanStr.ParseIntoArray(VectorParts, TEXT(","));
-	
-	if (VectorParts.Num() != 3)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Invalid vector format: %s"), *VectorStr);
-		return FVector::ZeroVector;
-	}
-	
-	float X = FCString::Atof(*VectorParts[0].TrimStartAndEnd());
-	float Y = FCString::Atof(*VectorParts[1].TrimStartAndEnd());
-	float Z = FCString::Atof(*VectorParts[2].TrimStartAndEnd());
-	
-	return FVector(X, Y, Z);
-}
-
-FRotator ADSLightSyncer::ParseRotationString(const FString& RotationStr)
-{
-	// Parse rotation format: (pitch°, yaw°, roll°) to FRotator
-	FString CleanStr = RotationStr;
-	CleanStr = CleanStr.Replace(TEXT("("), TEXT(""));
-	CleanStr = CleanStr.Replace(TEXT(")"), TEXT(""));
-	CleanStr = CleanStr.Replace(TEXT("°"), TEXT(""));
-	
-	TArray<FString> RotationParts;
-	CleanStr.ParseIntoArray(RotationParts, TEXT(","));
-	
-	if (RotationParts.Num() != 3)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Invalid rotation format: %s"), *RotationStr);
-		return FRotator::ZeroRotator;
-	}
-	
-	// Convert Rhino rotation to UE4 rotation - NOW CONSISTENT WITH JSON PARSING
-	float Pitch = FCString::Atof(*RotationParts[0].TrimStartAndEnd());
-	float Yaw = FCString::Atof(*RotationParts[1].TrimStartAndEnd());
-	float Roll = FCString::Atof(*RotationParts[2].TrimStartAndEnd());
-	
-	// Apply the same coordinate system conversion as JSON parsing
-	return FRotator(
-		Pitch,  // Keep pitch as-is
-		-Yaw,   // Negate yaw for coordinate system conversion
-		Roll    // Keep roll as-is
-	);
-}
-
-FLinearColor ADSLightSyncer::ParseColorString(const FString& ColorStr)
-{
-	// Parse color format: RGB(r,g,b)
-	FString CleanStr = ColorStr;
-	CleanStr = CleanStr.Replace(TEXT("RGB("), TEXT(""));
-	CleanStr = CleanStr.Replace(TEXT(")"), TEXT(""));
-	
-	TArray<FString> ColorParts;
-	CleanStr.ParseIntoArray(ColorParts, TEXT(","));
-	
-	if (ColorParts.Num() != 3)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Invalid color format: %s, using white"), *ColorStr);
-		return FLinearColor::White;
-	}
-	
-	float R = FCString::Atof(*ColorParts[0].TrimStartAndEnd()) / 255.0f;
-	float G = FCString::Atof(*ColorParts[1].TrimStartAndEnd()) / 255.0f;
-	float B = FCString::Atof(*ColorParts[2].TrimStartAndEnd()) / 255.0f;
-	
-	return FLinearColor(R, G, B, 1.0f);
-}
\ No newline at end of file
@@ -17,6 +17,7 @@
 #include "HAL/Runnable.h"
 #include "HAL/RunnableThread.h"
 #include "Networking.h"
+#include "../Runtime/DSLightParser.h"
 #include "DSLightSyncer.generated.h"
 
 // Forward declaration
@@ -34,29 +35,6 @@ protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-    // Structure to hold parsed light data
-    struct FLightData
-    {
-       bool bIsValid = false;
-       FString LightType;
-       FVector Location = FVector::ZeroVector;
-       FRotator Rotation = FRotator::ZeroRotator;
-       float Intensity = 1.0f;
-       FLinearColor Color = FLinearColor::White;
-       float InnerAngle = 0.0f;  // For spot lights
-       float OuterAngle = 45.0f; // For spot lights
-    };
-
-    // Structure to hold JSON light data from Rhino
-    struct FRhinoLightData
-    {
-        FString EventType;
-        FString Timestamp;
-        int32 LightCount = 0;
-        TArray<FLightData> Lights;
-        bool bIsValid = false;
-    };
-
 public:
     // Path to the light synchronization file
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Sync")
@@ -66,6 +44,18 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Sync")
     int32 ListeningPort = 5173;
 
+    // File the last received light data is cached in, empty for Saved/DatasmithTest/LightCache/Lights.json
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Sync|Cache")
+    FString LightCachePath;
+
+    // Whether received light data is written to the light cache
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Sync|Cache")
+    bool bWriteLightCache = false;
+
+    // Whether cached light data is spawned on BeginPlay, so viewers start with the lights a sync node received
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Sync|Cache")
+    bool bLoadLightCacheOnStart = true;
+
     // Function to load lights from file and spawn them in the scene
     UFUNCTION(BlueprintCallable, Category = "Light Sync")
     void LoadAndSpawnLights();
@@ -82,6 +72,38 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Light Sync")
     void StopTcpListener();
 
+    // Function to run headless as a sync node: listens right away and caches every light event received
+    UFUNCTION(BlueprintCallable, Category = "Light Sync")
+    void EnterSyncNodeMode();
+
+    // Function to get the resolved light cache file path
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Light Sync|Cache")
+    FString GetLightCacheFilePath() const;
+
+    // Function to start recording every light event received over TCP, with its arrival time, to a capture file
+    UFUNCTION(BlueprintCallable, Category = "Light Sync|Capture")
+    bool StartCapture(const FString& FilePath);
+
+    // Function to stop recording light events
+    UFUNCTION(BlueprintCallable, Category = "Light Sync|Capture")
+    void StopCapture();
+
+    // Function to replay a capture file, with the recorded timing or one event per frame
+    UFUNCTION(BlueprintCallable, Category = "Light Sync|Capture")
+    bool ReplayCapture(const FString& FilePath, bool bKeepTiming = true);
+
+    // Function to check whether a capture is being replayed
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Light Sync|Capture")
+    bool IsReplayingCapture() const { return NextReplayEvent < ReplayEvents.Num(); }
+
+    // Function to check whether the TCP listener is running
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Light Sync")
+    bool IsListening() const { return bIsListening; }
+
+    // Function to get the number of light actors currently spawned
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Light Sync")
+    int32 GetNumSpawnedLights() const { return SpawnedLights.Num(); }
+
     // Function to process received JSON data (called from game thread)
     UFUNCTION(BlueprintCallable, Category = "Light Sync")
     void ProcessReceivedLightData(const FString& JsonData);
@@ -98,18 +120,21 @@ private:
     // Thread-safe queue for incoming data
     TQueue<FString, EQueueMode::Mpsc> IncomingDataQueue;
 
-    // Helper functions for parsing
-    FLightData ParseLightLine(const FString& Line);
-    FVector ParseVectorString(const FString& VectorStr);
-    FRotator ParseRotationString(const FString& RotationStr);
-    FLinearColor ParseColorString(const FString& ColorStr);
+    // Capture recording state, empty path when not recording
+    FString CaptureFilePath;
+    double CaptureStartTime = 0.0;
+
+    // Capture replay state, events are (seconds since capture start, JSON data)
+    TArray<TPair<double, FString>> ReplayEvents;
+    int32 NextReplayEvent = 0;
+    double ReplayStartTime = 0.0;
+    bool bReplayKeepTiming = true;
 
-    // JSON parsing functions
-    FRhinoLightData ParseJsonLightData(const FString& JsonData);
-    FLightData ParseJsonLight(const TSharedPtr<FJsonObject>& LightObject);
+    // Light events processed since the last tick, recorded as a CSV stat
+    int32 NumEventsThisFrame = 0;
 
     // Spawn lights from JSON data
-    void SpawnLightsFromJsonData(const FRhinoLightData& LightData);
+    void SpawnLightsFromJsonData(const FDSRhinoLightData& LightData);
 
     // TCP connection handling
     bool HandleConnectionAccepted(FSocket* Socket, const FIPv4Endpoint& Endpoint);
@@ -117,6 +142,9 @@ private:
     // Process queued data in game thread
     void ProcessQueuedData();
 
+    // Feed due events of the capture being replayed
+    void ProcessReplay();
+
 public:
     // Tick function to process queued data
     virtual void Tick(float DeltaTime) override;
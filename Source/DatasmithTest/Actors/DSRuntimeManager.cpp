@@ -10,17 +10,54 @@
 //
 // Contact: rudraojhaif@gmail.com for licensing inquiries.
 #include "DSRuntimeManager.h"
+#include "DSDatasmithRuntimeActor.h"
+#include "../Runtime/DSVisibilityGrid.h"
+#include "../Runtime/DSCullDistanceClassifier.h"
+#include "../Runtime/DSPSOPrecacher.h"
+#include "../Runtime/DSMeshOptimizer.h"
+#include "../Runtime/DSTaskScheduler.h"
+#include "../Runtime/DSTessellationPredictor.h"
+#include "../Runtime/DSMeshWorkerPool.h"
+#include "../Runtime/DSVertexQuantizer.h"
+#include "../Runtime/DSTextureCompressionPass.h"
+#include "../Runtime/DSTextureStreamer.h"
+#include "../Runtime/DSDeferredDestroyer.h"
+#include "../Runtime/DSHierarchyFlattener.h"
+#include "../Runtime/DSMobilityPromoter.h"
+#include "../Runtime/DSMetadataViewFilter.h"
+#include "../Runtime/DSElementPicker.h"
+#include "../Runtime/DSSceneCostAnalyzer.h"
+#include "../Runtime/DSGCClusterer.h"
+#include "../Runtime/DSGCPauseTimer.h"
+#include "../Runtime/DSStartupTimeline.h"
+#include "../Runtime/DSTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/Texture2D.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
+#include "Async/Async.h"
+#include "Misc/Paths.h"
+#include "Misc/App.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/LightComponent.h"
+#include "EngineUtils.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "ConvexVolume.h"
+#include "DatasmithAssetUserData.h"
 
 // Logging category for this class
 DEFINE_LOG_CATEGORY_STATIC(LogDSRuntimeManager, Log, All);
 
 ADSRuntimeManager::ADSRuntimeManager()
 {
-    // Set this actor to never tick for performance
-    PrimaryActorTick.bCanEverTick = false;
+    // Ticks before the runtime actor once initialized, only to catch updates before they are applied
+    PrimaryActorTick.bCanEverTick = true;
     PrimaryActorTick.bStartWithTickEnabled = false;
+    PrimaryActorTick.TickGroup = TG_PrePhysics;
 
     // Initialize root component for proper actor placement and hierarchy
     DefaultRootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("DefaultRootComponent"));
@@ -28,40 +65,143 @@ ADSRuntimeManager::ADSRuntimeManager()
 
     // Set default spawn collision handling method
     SpawnCollisionHandlingMethod = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    // Default size-to-distance curve: screws vanish past ~10m, fittings past ~30m, panels past ~120m
+    FRichCurve* CullCurve = CullDistanceCurve.GetRichCurve();
+    CullCurve->AddKey(1.0f, 1000.0f);
+    CullCurve->AddKey(5.0f, 3000.0f);
+    CullCurve->AddKey(25.0f, 12000.0f);
+    CullCurve->AddKey(100.0f, 40000.0f);
+
+    // Typical viewing distances for the cull report: room, floor, building
+    CullReportViewDistances = { 1000.0f, 5000.0f, 20000.0f };
 }
 
 void ADSRuntimeManager::BeginPlay()
 {
     Super::BeginPlay();
 
+    if (bDeferInitialization)
+    {
+        // Spawning stays cheap, the DirectLink endpoint and the runtime actor come up on the next frame
+        GetWorldTimerManager().SetTimerForNextTick(this, &ADSRuntimeManager::InitializeServices);
+    }
+    else
+    {
+        InitializeServices();
+    }
+}
+
+void ADSRuntimeManager::InitializeServices()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(ADSRuntimeManager::InitializeServices);
+
     UE_LOG(LogDSRuntimeManager, Log, TEXT("DSRuntimeManager starting initialization..."));
 
     // Initialize DirectLink proxy first
     if (!RefreshDirectLinkProxy())
     {
-        UE_LOG(LogDSRuntimeManager, Warning, TEXT("Failed to initialize DirectLink proxy during BeginPlay"));
+        UE_LOG(LogDSRuntimeManager, Warning, TEXT("Failed to initialize DirectLink proxy during initialization"));
     }
+    FDSStartupTimeline::Mark(TEXT("DirectLink proxy ready"));
 
     // Initialize Datasmith actor
     if (!InitializeDatasmithActor())
     {
-        UE_LOG(LogDSRuntimeManager, Error, TEXT("Failed to initialize Datasmith actor during BeginPlay"));
+        UE_LOG(LogDSRuntimeManager, Error, TEXT("Failed to initialize Datasmith actor during initialization"));
         return;
     }
+    FDSStartupTimeline::Mark(TEXT("Datasmith runtime actor spawned"));
 
     // Apply initial import options
     ApplyImportOptions();
+    OnViewFiltersChanged();
+
+    // Start precompiling pipeline states recorded by earlier sessions
+    if (bPrecompileImportedPSOs && FApp::CanEverRender())
+    {
+        FDSPSOPrecacher::SetRecording(true);
+        FDSPSOPrecacher::OpenPersistentCache();
+    }
+
+    if (bMeasureGCPauses)
+    {
+        GCPauseTimer = MakeShared<FDSGCPauseTimer>();
+    }
+
+    // Watch the runtime actor so post-import passes can run when a scene finishes building
+    GetWorldTimerManager().SetTimer(ImportMonitorTimerHandle, this, &ADSRuntimeManager::PollImportState, ImportMonitorInterval, true);
+    SetActorTickEnabled(true);
+
+#if CSV_PROFILER
+    CsvStatsTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ADSRuntimeManager::RecordCsvStats));
+#endif
 
     // Log current configuration for debugging
     LogCurrentConfiguration();
 
+    bServicesInitialized = true;
     UE_LOG(LogDSRuntimeManager, Log, TEXT("DSRuntimeManager initialization completed successfully"));
+    FDSStartupTimeline::Mark(TEXT("Runtime manager initialized"));
+}
+
+void ADSRuntimeManager::Tick(float DeltaSeconds)
+{
+    Super::Tick(DeltaSeconds);
+
+    // The only place the utilization window advances, so stats readers never shorten it for each other
+    if (TaskScheduler.IsValid())
+    {
+        TaskScheduler->SampleUtilization();
+    }
+
+    // The runtime actor applies a received update in its own tick, which runs after this one. Passes that must
+    // be undone before the importer touches the scene are undone here, not up to a monitor interval too late.
+    if (!bImportInProgress && IsImportInProgress())
+    {
+        PollImportState();
+    }
 }
 
 void ADSRuntimeManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     UE_LOG(LogDSRuntimeManager, Log, TEXT("DSRuntimeManager ending play..."));
 
+    // Stop monitoring and restore anything hidden by visibility culling
+    bServicesInitialized = false;
+    GetWorldTimerManager().ClearTimer(ImportMonitorTimerHandle);
+    GetWorldTimerManager().ClearTimer(ImportRestartTimerHandle);
+    GetWorldTimerManager().ClearTimer(SyncNodeConnectTimerHandle);
+    GetWorldTimerManager().ClearTimer(PSOPrecacheTimerHandle);
+    GetWorldTimerManager().ClearTimer(TextureStreamingTimerHandle);
+    FTSTicker::GetCoreTicker().RemoveTicker(CsvStatsTickerHandle);
+    SetImportPhase(nullptr);
+    CancelTextureCompression();
+    CancelMeshOptimization();
+    CancelTessellationPrediction();
+    ClearVisibilityCulling();
+
+    // Waits for running tasks, queued ones belong to the passes cancelled above
+    TaskScheduler.Reset();
+    MeshWorkerPool.Reset();
+
+    // Retired actors that are still queued are destroyed now, the manager may end play in a world that lives on
+    GetWorldTimerManager().ClearTimer(DeferredDestroyTimerHandle);
+    if (DeferredDestroyer.IsValid())
+    {
+        DeferredDestroyer->Flush();
+        DeferredDestroyer.Reset();
+    }
+    FrontDatasmithActorRef.Reset();
+
+    ReleaseImportCluster(ImportCluster);
+    ReleaseImportCluster(FrontImportCluster);
+    if (GCPauseTimer.IsValid())
+    {
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("%s"), *GCPauseTimer->GetStats().ToString());
+        GCPauseTimer.Reset();
+    }
+
     // Clean up references
     DatasmithRuntimeActorRef.Reset();
     DirectLinkProxyRef.Reset();
@@ -71,6 +211,8 @@ void ADSRuntimeManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 bool ADSRuntimeManager::UpdateDirectLinkConnection()
 {
+    DS_TRACE_SCOPE(ADSRuntimeManager::UpdateDirectLinkConnection);
+
     // Validate DirectLink proxy
     if (!DirectLinkProxyRef.IsValid())
     {
@@ -116,6 +258,8 @@ bool ADSRuntimeManager::UpdateDirectLinkConnection()
     
     if (bConnectionSuccess)
     {
+        // A new connection starts with a snapshot of the whole scene
+        bFullImportPending = true;
         UE_LOG(LogDSRuntimeManager, Log, TEXT("Successfully opened DirectLink connection with source index %d"), DirectLinkSourceIndex);
     }
     else
@@ -126,6 +270,42 @@ bool ADSRuntimeManager::UpdateDirectLinkConnection()
     return bConnectionSuccess;
 }
 
+void ADSRuntimeManager::EnterSyncNodeMode()
+{
+    if (bSyncNode)
+    {
+        return;
+    }
+
+    bSyncNode = true;
+
+    // Nobody looks at the scene: no back buffer to keep on screen, no pipeline states to compile, no mips to stream
+    bDoubleBufferReimports = false;
+    bPrecompileImportedPSOs = false;
+    bEnableTextureStreaming = false;
+    TextureStreamer.Reset();
+    GetWorldTimerManager().ClearTimer(TextureStreamingTimerHandle);
+
+    // Visibility cells and texture compression stay on, their results are what the viewers load from disk
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Running as sync node: caching visibility cells, compressed textures and scene cost reports for viewers"));
+
+    GetWorldTimerManager().SetTimer(SyncNodeConnectTimerHandle, this, &ADSRuntimeManager::TickSyncNodeConnection, SyncNodeConnectInterval, true, 0.0f);
+}
+
+void ADSRuntimeManager::TickSyncNodeConnection()
+{
+    // The runtime actor comes up a frame after the manager, and sources appear whenever their application starts
+    if (!DatasmithRuntimeActorRef.IsValid() || DatasmithRuntimeActorRef->IsConnected() || bImportInProgress)
+    {
+        return;
+    }
+
+    if (UpdateDirectLinkConnection())
+    {
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("Sync node connected to DirectLink source %d"), DirectLinkSourceIndex);
+    }
+}
+
 bool ADSRuntimeManager::InitializeDatasmithActor()
 {
     UWorld* World = GetWorld();
@@ -151,8 +331,8 @@ bool ADSRuntimeManager::InitializeDatasmithActor()
     // Use identity transform - let the manager handle positioning
     const FTransform SpawnTransform(FQuat::Identity, FVector::ZeroVector, FVector::OneVector);
 
-    ADatasmithRuntimeActor* NewDatasmithActor = World->SpawnActor<ADatasmithRuntimeActor>(
-        ADatasmithRuntimeActor::StaticClass(),
+    ADSDatasmithRuntimeActor* NewDatasmithActor = World->SpawnActor<ADSDatasmithRuntimeActor>(
+        ADSDatasmithRuntimeActor::StaticClass(),
         SpawnTransform,
         SpawnParams
     );
@@ -165,6 +345,12 @@ bool ADSRuntimeManager::InitializeDatasmithActor()
 
     // Store weak reference
     DatasmithRuntimeActorRef = NewDatasmithActor;
+    bFullImportPending = true;
+
+    // Import starts are detected in the manager's tick before the runtime actor starts applying them
+    NewDatasmithActor->AddTickPrerequisiteActor(this);
+    NewDatasmithActor->OnUpdateReceived.AddUObject(this, &ADSRuntimeManager::HandleUpdateReceived);
+    NewDatasmithActor->SetElementFilter(ViewFilter);
     
     UE_LOG(LogDSRuntimeManager, Log, TEXT("Successfully spawned Datasmith runtime actor"));
     return true;
@@ -219,29 +405,236 @@ bool ADSRuntimeManager::ApplyImportOptions()
     return true;
 }
 
+bool ADSRuntimeManager::IsImportInProgress() const
+{
+    if (!DatasmithRuntimeActorRef.IsValid())
+    {
+        return false;
+    }
+
+    return DatasmithRuntimeActorRef->bBuilding || DatasmithRuntimeActorRef->IsReceiving();
+}
+
+void ADSRuntimeManager::SetRestartImportOnSettingsChange(bool bInEnabled)
+{
+    bRestartImportOnSettingsChange = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Restart import on settings change set to %s"), bRestartImportOnSettingsChange ? TEXT("true") : TEXT("false"));
+
+    if (!bRestartImportOnSettingsChange)
+    {
+        GetWorldTimerManager().ClearTimer(ImportRestartTimerHandle);
+    }
+}
+
+bool ADSRuntimeManager::IsImportRestartPending() const
+{
+    return GetWorldTimerManager().IsTimerActive(ImportRestartTimerHandle);
+}
+
+bool ADSRuntimeManager::RestartImport()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::RestartImport);
+
+    GetWorldTimerManager().ClearTimer(ImportRestartTimerHandle);
+
+    if (!DatasmithRuntimeActorRef.IsValid())
+    {
+        UE_LOG(LogDSRuntimeManager, Warning, TEXT("Cannot restart import - Datasmith actor is invalid"));
+        return false;
+    }
+
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Restarting Datasmith import with new settings"));
+
+    // Queued post-import tasks are dropped from the scheduler instead of running on components about to go away.
+    // Textures compressed so far stay in the texture cache and are picked up again by the next import.
+    CancelMeshOptimization();
+    CancelTextureCompression();
+
+    // Closing the connection stops receiving, resetting discards the importer's queued tessellation and build work
+    ADatasmithRuntimeActor* RuntimeActor = DatasmithRuntimeActorRef.Get();
+    const bool bWasConnected = RuntimeActor->IsConnected();
+    const bool bWasImporting = bImportInProgress;
+    RuntimeActor->CloseConnection();
+
+    // A finished scene stays on screen while the next version is built in a hidden back buffer.
+    // Partially built scenes and back buffers that are themselves being rebuilt are reset in place.
+    TArray<UPrimitiveComponent*> Primitives;
+    GatherImportedPrimitives(Primitives);
+    if (bDoubleBufferReimports && bWasConnected && !bWasImporting && !FrontDatasmithActorRef.IsValid() && Primitives.Num() > 0)
+    {
+        // The front scene is never updated again, its flattened hierarchy can stay as it is
+        HierarchyFlattener.Reset();
+        FrontDatasmithActorRef = RuntimeActor;
+        DatasmithRuntimeActorRef.Reset();
+        FrontImportCluster = ImportCluster;
+        ImportCluster = nullptr;
+
+        if (InitializeDatasmithActor())
+        {
+            DatasmithRuntimeActorRef->SetActorHiddenInGame(true);
+            UE_LOG(LogDSRuntimeManager, Log, TEXT("Building reimport in a hidden back buffer, %d components stay on screen"), Primitives.Num());
+        }
+        else
+        {
+            UE_LOG(LogDSRuntimeManager, Warning, TEXT("Failed to create back buffer actor, reimporting in place"));
+            DatasmithRuntimeActorRef = RuntimeActor;
+            FrontDatasmithActorRef.Reset();
+            ImportCluster = FrontImportCluster;
+            FrontImportCluster = nullptr;
+            ReleaseImportCluster(ImportCluster);
+            RuntimeActor->Reset();
+        }
+    }
+    else
+    {
+        // Resetting destroys the imported assets, they must not be collected as one cluster
+        ReleaseImportCluster(ImportCluster);
+        RuntimeActor->Reset();
+        bFullImportPending = true;
+    }
+
+    // The cancelled import never completes, the restarted one is reported as a new import by the monitor
+    bImportInProgress = false;
+    bSwapAfterTextureCompression = false;
+
+    if (!bWasConnected)
+    {
+        // Nothing to reimport from, the options are picked up by the next connection
+        ApplyImportOptions();
+        if (bSceneHiddenForPrecache)
+        {
+            RevealImportedScene();
+        }
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("No DirectLink connection, import options apply to the next connection"));
+        return false;
+    }
+
+    // Reconnecting applies the current options and requests a fresh snapshot from the source
+    return UpdateDirectLinkConnection();
+}
+
+void ADSRuntimeManager::OnImportSettingsChanged()
+{
+    if (!bRestartImportOnSettingsChange || !IsImportInProgress())
+    {
+        // Picked up by the next import
+        return;
+    }
+
+    // Restarting the timer on every change lets edits made together restart the import once
+    GetWorldTimerManager().SetTimer(ImportRestartTimerHandle, this, &ADSRuntimeManager::OnImportRestartTimer, FMath::Max(ImportRestartDelay, 0.01f), false);
+}
+
+void ADSRuntimeManager::OnImportRestartTimer()
+{
+    // The import may have finished while waiting, its result is then kept until the next update
+    if (IsImportInProgress())
+    {
+        RestartImport();
+    }
+}
+
 // Tessellation Setters with validation
 void ADSRuntimeManager::SetChordTolerance(float InChordTolerance)
 {
     ChordTolerance = FMath::Clamp(InChordTolerance, 0.001f, 10.0f);
     UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Chord tolerance set to %f"), ChordTolerance);
+    OnImportSettingsChanged();
 }
 
 void ADSRuntimeManager::SetMaxEdgeLength(float InMaxEdgeLength)
 {
     MaxEdgeLength = FMath::Max(InMaxEdgeLength, 0.0f);
     UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Max edge length set to %f"), MaxEdgeLength);
+    OnImportSettingsChanged();
 }
 
 void ADSRuntimeManager::SetNormalTolerance(float InNormalTolerance)
 {
     NormalTolerance = FMath::Clamp(InNormalTolerance, 0.1f, 90.0f);
     UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Normal tolerance set to %f"), NormalTolerance);
+    OnImportSettingsChanged();
 }
 
 void ADSRuntimeManager::SetStitchingTechnique(EDatasmithCADStitchingTechnique InStitchingTechnique)
 {
     StitchingTechnique = InStitchingTechnique;
     UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Stitching technique set to %d"), (int32)StitchingTechnique);
+    OnImportSettingsChanged();
+}
+
+bool ADSRuntimeManager::PredictTessellationCost(float InChordTolerance, float InMaxEdgeLength, float InNormalTolerance)
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::PredictTessellationCost);
+
+    // The scene is only a valid baseline once it is completely built
+    if (bImportInProgress || NumImportsCompleted == 0)
+    {
+        return false;
+    }
+
+    // Sampled on the first request after each import, later requests only re-estimate. Meshes being
+    // optimized are not what the importer built, they are skipped until the pass has finished.
+    if (!TessellationPredictor.IsValid() && (IsMeshOptimizationInProgress() || !StartTessellationPredictor()))
+    {
+        return false;
+    }
+
+    // Same limits as the setters, so the prediction matches what committing the values would import
+    FDSTessellationSettings Proposed;
+    Proposed.ChordTolerance = FMath::Clamp(InChordTolerance, 0.001f, 10.0f);
+    Proposed.MaxEdgeLength = FMath::Max(InMaxEdgeLength, 0.0f);
+    Proposed.NormalTolerance = FMath::Clamp(InNormalTolerance, 0.1f, 90.0f);
+    TessellationPredictor->Predict(Proposed);
+
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Predicting tessellation cost for chord %f, max edge %f, normal %f"),
+           Proposed.ChordTolerance, Proposed.MaxEdgeLength, Proposed.NormalTolerance);
+    return true;
+}
+
+FString ADSRuntimeManager::GetTessellationPrediction() const
+{
+    FDSTessellationPrediction Prediction;
+    if (!TessellationPredictor.IsValid() || !TessellationPredictor->GetPrediction(Prediction))
+    {
+        return FString();
+    }
+
+    return Prediction.ToString();
+}
+
+bool ADSRuntimeManager::IsTessellationPredictionInProgress() const
+{
+    return TessellationPredictor.IsValid() && TessellationPredictor->IsBusy();
+}
+
+bool ADSRuntimeManager::StartTessellationPredictor()
+{
+    TArray<UPrimitiveComponent*> Primitives;
+    GatherImportedPrimitives(Primitives);
+
+    FDSTessellationSettings ImportedSettings;
+    ImportedSettings.ChordTolerance = ImportedChordTolerance;
+    ImportedSettings.MaxEdgeLength = ImportedMaxEdgeLength;
+    ImportedSettings.NormalTolerance = ImportedNormalTolerance;
+
+    TessellationPredictor = MakeShared<FDSTessellationPredictor, ESPMode::ThreadSafe>();
+    if (TessellationPredictor->Start(Primitives, ImportedSettings, (float)LastImportSeconds, GetTaskScheduler()) == 0)
+    {
+        TessellationPredictor.Reset();
+        return false;
+    }
+    return true;
+}
+
+void ADSRuntimeManager::CancelTessellationPrediction()
+{
+    if (TessellationPredictor.IsValid())
+    {
+        // Running tasks keep their own reference and drop their results
+        TessellationPredictor->Cancel();
+        TessellationPredictor.Reset();
+    }
 }
 
 // Hierarchy Setters
@@ -249,6 +642,7 @@ void ADSRuntimeManager::SetHierarchyMethod(EBuildHierarchyMethod InHierarchyMeth
 {
     HierarchyMethod = InHierarchyMethod;
     UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Hierarchy method set to %d"), (int32)HierarchyMethod);
+    OnImportSettingsChanged();
 }
 
 // Collision Setters
@@ -256,12 +650,14 @@ void ADSRuntimeManager::SetCollisionEnabled(ECollisionEnabled::Type InCollisionE
 {
     CollisionEnabled = InCollisionEnabled;
     UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Collision enabled set to %d"), (int32)CollisionEnabled);
+    OnImportSettingsChanged();
 }
 
 void ADSRuntimeManager::SetCollisionTraceFlag(ECollisionTraceFlag InCollisionTraceFlag)
 {
     CollisionTraceFlag = InCollisionTraceFlag;
     UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Collision trace flag set to %d"), (int32)CollisionTraceFlag);
+    OnImportSettingsChanged();
 }
 
 // Metadata Setters
@@ -269,6 +665,94 @@ void ADSRuntimeManager::SetImportMetadata(bool bInImportMetadata)
 {
     bImportMetaData = bInImportMetadata;
     UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Import metadata set to %s"), bImportMetaData ? TEXT("true") : TEXT("false"));
+    OnImportSettingsChanged();
+}
+
+void ADSRuntimeManager::SetViewIncludeFilters(const TArray<FString>& InFilters)
+{
+    ViewIncludeFilters = InFilters;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("View include filters set to [%s]"), *FString::Join(ViewIncludeFilters, TEXT("; ")));
+    OnViewFiltersChanged();
+}
+
+void ADSRuntimeManager::SetViewExcludeFilters(const TArray<FString>& InFilters)
+{
+    ViewExcludeFilters = InFilters;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("View exclude filters set to [%s]"), *FString::Join(ViewExcludeFilters, TEXT("; ")));
+    OnViewFiltersChanged();
+}
+
+void ADSRuntimeManager::OnViewFiltersChanged()
+{
+    // Elements dropped by the previous rules come back before the new rules are evaluated
+    const bool bWasFiltering = ViewFilter.IsValid();
+    if (ViewFilter.IsValid())
+    {
+        ViewFilter->Restore();
+        ViewFilter.Reset();
+    }
+
+    TSharedPtr<FDSMetadataViewFilter> NewFilter = MakeShared<FDSMetadataViewFilter>(ViewIncludeFilters, ViewExcludeFilters);
+    if (!NewFilter->IsEmpty())
+    {
+        ViewFilter = NewFilter;
+    }
+
+    // Elements received from now on are dropped before they are built
+    ADSDatasmithRuntimeActor* RuntimeActor = Cast<ADSDatasmithRuntimeActor>(DatasmithRuntimeActorRef.Get());
+    const int32 NumDropped = RuntimeActor ? RuntimeActor->GetNumDroppedElements() : 0;
+    if (RuntimeActor)
+    {
+        RuntimeActor->SetElementFilter(ViewFilter);
+    }
+
+    // Dropped elements were never built, only a fresh snapshot can bring back the ones the new rules let through
+    if (NumDropped > 0)
+    {
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("Reimporting for the new filters, %d elements were dropped by the previous rules"), NumDropped);
+        RestartImport();
+        return;
+    }
+
+    // Import options request metadata while filtering, components built before that carry none to match
+    if (!bWasFiltering && ViewFilter.IsValid() && !bImportMetaData)
+    {
+        if (NumImportsCompleted > 0 || IsImportInProgress())
+        {
+            UE_LOG(LogDSRuntimeManager, Log, TEXT("Metadata import was disabled, reimporting so the filters have metadata to match"));
+            RestartImport();
+            return;
+        }
+
+        // Nothing imported yet, the first import picks the options up
+        ApplyImportOptions();
+    }
+
+    // An import in flight is filtered as it streams in and once more when it completes
+    if (!IsImportInProgress())
+    {
+        ApplyViewFilters();
+    }
+}
+
+int32 ADSRuntimeManager::ApplyViewFilters()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::ApplyViewFilters);
+
+    if (!ViewFilter.IsValid())
+    {
+        return 0;
+    }
+
+    const FDSViewFilterReport Report = ViewFilter->Apply(DatasmithRuntimeActorRef.Get(), false);
+    Report.Log();
+
+    return Report.NumFiltered;
+}
+
+int32 ADSRuntimeManager::GetNumFilteredComponents() const
+{
+    return ViewFilter.IsValid() ? ViewFilter->GetNumFiltered() : 0;
 }
 
 // DirectLink Setters
@@ -287,6 +771,36 @@ void ADSRuntimeManager::SetDirectLinkSourceIndex(int32 InSourceIndex)
     UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("DirectLink source index set to %d"), DirectLinkSourceIndex);
 }
 
+// Precomputed Visibility Setters
+void ADSRuntimeManager::SetVisibilityCellsEnabled(bool bInEnabled)
+{
+    bEnableVisibilityCells = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Visibility cells set to %s"), bEnableVisibilityCells ? TEXT("true") : TEXT("false"));
+
+    if (!bEnableVisibilityCells)
+    {
+        ClearVisibilityCulling();
+    }
+}
+
+// Cull Distance Setters
+void ADSRuntimeManager::SetSizeCullDistancesEnabled(bool bInEnabled)
+{
+    bEnableSizeCullDistances = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Size cull distances set to %s"), bEnableSizeCullDistances ? TEXT("true") : TEXT("false"));
+
+    if (bEnableSizeCullDistances)
+    {
+        ApplySizeCullDistances();
+    }
+    else if (CullDistanceOverrides.IsValid())
+    {
+        const int32 NumRestored = FDSCullDistanceClassifier::Reset(*CullDistanceOverrides);
+        CullDistanceOverrides.Reset();
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("Restored the draw distances of %d components"), NumRestored);
+    }
+}
+
 bool ADSRuntimeManager::ValidateComponents() const
 {
     const bool bProxyValid = DirectLinkProxyRef.IsValid();
@@ -325,7 +839,8 @@ FDatasmithRuntimeImportOptions ADSRuntimeManager::CreateImportOptionsFromSetting
     ImportOptions.BuildHierarchy = HierarchyMethod;
     ImportOptions.BuildCollisions = CollisionEnabled;
     ImportOptions.CollisionType = CollisionTraceFlag;
-    ImportOptions.bImportMetaData = bImportMetaData;
+    // View filters are evaluated on the imported metadata, so they need it even when it is otherwise unused
+    ImportOptions.bImportMetaData = bImportMetaData || ViewIncludeFilters.Num() > 0 || ViewExcludeFilters.Num() > 0;
 
     return ImportOptions;
 }
@@ -341,7 +856,1551 @@ void ADSRuntimeManager::LogCurrentConfiguration() const
     UE_LOG(LogDSRuntimeManager, Log, TEXT("Collision Enabled: %d"), (int32)CollisionEnabled.GetValue());
     UE_LOG(LogDSRuntimeManager, Log, TEXT("Collision Trace Flag: %d"), (int32)CollisionTraceFlag.GetValue());
     UE_LOG(LogDSRuntimeManager, Log, TEXT("Import Metadata: %s"), bImportMetaData ? TEXT("true") : TEXT("false"));
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("View Filters: include [%s], exclude [%s]"), *FString::Join(ViewIncludeFilters, TEXT("; ")), *FString::Join(ViewExcludeFilters, TEXT("; ")));
     UE_LOG(LogDSRuntimeManager, Log, TEXT("DirectLink Source Index: %d"), DirectLinkSourceIndex);
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Restart Import On Settings Change: %s (delay %f)"), bRestartImportOnSettingsChange ? TEXT("true") : TEXT("false"), ImportRestartDelay);
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Double Buffer Reimports: %s (retire budget %f ms)"), bDoubleBufferReimports ? TEXT("true") : TEXT("false"), RetireTimeBudgetMs);
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Flatten Imported Hierarchy: %s (assembly depth %d, metadata key '%s')"), bFlattenImportedHierarchy ? TEXT("true") : TEXT("false"), FlattenAssemblyDepth, *FlattenGroupMetadataKey.ToString());
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Sync Node: %s"), bSyncNode ? TEXT("true") : TEXT("false"));
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Cluster Imported Assets: %s (GC clusters %s)"), bClusterImportedAssets ? TEXT("true") : TEXT("false"), FDSGCClusterer::IsClusteringEnabled() ? TEXT("enabled") : TEXT("disabled"));
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Measure GC Pauses: %s"), bMeasureGCPauses ? TEXT("true") : TEXT("false"));
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Promote Static Mobility: %s (after %d unchanged updates)"), bPromoteStaticMobility ? TEXT("true") : TEXT("false"), MobilityPromotionUpdates);
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Analyze Scene Cost: %s (%d rows logged)"), bAnalyzeSceneCost ? TEXT("true") : TEXT("false"), SceneCostLogRows);
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Pick Refine Triangles: %s"), bPickRefineTriangles ? TEXT("true") : TEXT("false"));
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Size Cull Distances: %s (never cull radius %f)"), bEnableSizeCullDistances ? TEXT("true") : TEXT("false"), CullDistanceNeverCullRadius);
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Precompile Imported PSOs: %s (timeout %f)"), bPrecompileImportedPSOs ? TEXT("true") : TEXT("false"), PSOPrecacheTimeout);
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Task Scheduler Workers: %d (%d reserved cores)"), FDSTaskScheduler::ComputeWorkerCount(TaskSchedulerWorkerCount, TaskSchedulerReservedCores), TaskSchedulerReservedCores);
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Optimize Imported Meshes: %s (weld tolerance %f)"), bOptimizeImportedMeshes ? TEXT("true") : TEXT("false"), MeshWeldTolerance);
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Mesh Worker Processes: %s (%d workers, memory limit %d MB, %d retries)"), bOptimizeMeshesInWorkerProcesses ? TEXT("true") : TEXT("false"),
+           FDSTaskScheduler::ComputeWorkerCount(MeshWorkerProcessCount, TaskSchedulerReservedCores), MeshWorkerMemoryLimitMB, MeshWorkerMaxRetries);
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Quantize Imported Vertices: %s"), bQuantizeImportedVertices ? TEXT("true") : TEXT("false"));
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Compress Imported Textures: %s"), bCompressImportedTextures ? TEXT("true") : TEXT("false"));
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Texture Streaming: %s (pool %d MB)"), bEnableTextureStreaming ? TEXT("true") : TEXT("false"), TextureStreamingPoolSizeMB);
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Visibility Cells: %s (cell size %f, max %d)"), bEnableVisibilityCells ? TEXT("true") : TEXT("false"), VisibilityCellSize, VisibilityMaxCells);
     UE_LOG(LogDSRuntimeManager, Log, TEXT("Available Sources: %d"), GetAvailableSourceCount());
     UE_LOG(LogDSRuntimeManager, Log, TEXT("====================================="));
+}
+
+void ADSRuntimeManager::PollImportState()
+{
+    // Worker settings changed while work was queued take effect once the queues have drained
+    if (bTaskSchedulerResetPending)
+    {
+        ResetIdleTaskScheduler();
+    }
+
+    if (bMeshWorkerPoolResetPending)
+    {
+        ResetIdleMeshWorkerPool();
+    }
+
+    const bool bInProgress = IsImportInProgress();
+
+    // Passes of the previous import are undone before anything of this one is traced or filtered
+    if (bInProgress && !bImportInProgress)
+    {
+        bImportInProgress = true;
+        HandleImportStarted();
+    }
+
+    // Tessellation, asset builds and component spawning all happen inside the runtime actor's build phase
+    if (bInProgress)
+    {
+        SetImportPhase(DatasmithRuntimeActorRef->IsReceiving() ? TEXT("Receive") : TEXT("Build"));
+    }
+
+    // Filtered elements are unregistered as they stream in, so they never reach the renderer or physics
+    if (bInProgress && ViewFilter.IsValid())
+    {
+        ViewFilter->Apply(DatasmithRuntimeActorRef.Get(), true);
+    }
+
+    if (!bInProgress && bImportInProgress)
+    {
+        bImportInProgress = false;
+        HandleImportCompleted();
+    }
+}
+
+void ADSRuntimeManager::SetImportPhase(const TCHAR* Phase)
+{
+    if (Phase && ImportPhaseRegion.IsEmpty())
+    {
+        TracedImportNumber = NumImportsCompleted + 1;
+    }
+
+    // Every import after the first one is an incremental DirectLink update
+    const FString Region = Phase ? FString::Printf(TEXT("DS %s %d: %s"), TracedImportNumber > 1 ? TEXT("Update") : TEXT("Import"), TracedImportNumber, Phase) : FString();
+    if (Region == ImportPhaseRegion)
+    {
+        return;
+    }
+
+    if (!ImportPhaseRegion.IsEmpty())
+    {
+        FDSTrace::EndRegion(ImportPhaseRegion);
+    }
+
+    ImportPhaseRegion = Region;
+    if (!ImportPhaseRegion.IsEmpty())
+    {
+        FDSTrace::BeginRegion(ImportPhaseRegion);
+    }
+}
+
+bool ADSRuntimeManager::RecordCsvStats(float DeltaTime)
+{
+    CSV_CUSTOM_STAT(DSImport, ImportInProgress, bImportInProgress ? 1 : 0, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(DSImport, ImportsCompleted, NumImportsCompleted, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(DSImport, Idle, IsIdle() ? 1 : 0, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(DSImport, MeshOptimization, IsMeshOptimizationInProgress() ? 1 : 0, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(DSImport, TextureCompression, IsTextureCompressionInProgress() ? 1 : 0, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(DSImport, PSOPrecacheProgress, GetPSOPrecacheProgress(), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(DSImport, StreamedTextureMB, GetStreamedTextureMemoryMB(), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(DSImport, RetiredComponentsPending, DeferredDestroyer.IsValid() ? DeferredDestroyer->GetNumPendingComponents() : 0, ECsvCustomStatOp::Set);
+    return true;
+}
+
+void ADSRuntimeManager::HandleImportStarted()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::HandleImportStarted);
+
+    // An update arriving during the post-import passes of the previous one ends their region and gets its own number
+    SetImportPhase(nullptr);
+
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Datasmith import started"));
+    ImportStartTime = FPlatformTime::Seconds();
+    FDSStartupTimeline::Mark(TEXT("Import started"));
+
+    const bool bFullImport = bFullImportPending;
+    bFullImportPending = false;
+
+    // Updates keep the previous report, a new one can be requested with AnalyzeSceneCost
+    bSceneCostPending = bAnalyzeSceneCost && bFullImport;
+
+    // A full import replaces every component. Updates only demote the components they touch once they have been received.
+    if (bFullImport && MobilityPromoter.IsValid())
+    {
+        MobilityPromoter->Demote();
+    }
+
+    // The importer addresses components through their original parents, relative transforms and mobilities
+    UnflattenImportedHierarchy();
+
+    // The update replaces meshes and materials, references inside a cluster must not change under it.
+    // This runs from the tick before the importer applies anything, so the cluster is gone by then.
+    ReleaseImportCluster(ImportCluster);
+
+    // Components are about to change, culling against the old grid would hide the wrong parts
+    ClearVisibilityCulling();
+    InvalidateElementPicker();
+
+    // Textures and meshes may be replaced by the update, results of running passes could target stale objects.
+    // A back buffer still waiting for its textures is swapped in once this update has been processed instead.
+    bSwapAfterTextureCompression = false;
+    CancelTextureCompression();
+    CancelMeshOptimization();
+    CancelTessellationPrediction();
+
+    // Options can be applied without reimporting, the ones read by this import are the baseline of predictions
+    if (DatasmithRuntimeActorRef.IsValid())
+    {
+        const FDatasmithTessellationOptions& TessellationOptions = DatasmithRuntimeActorRef->ImportOptions.TessellationOptions;
+        ImportedChordTolerance = TessellationOptions.ChordTolerance;
+        ImportedMaxEdgeLength = TessellationOptions.MaxEdgeLength;
+        ImportedNormalTolerance = TessellationOptions.NormalTolerance;
+    }
+
+    // Keep new content hidden until its pipeline states are compiled, and let cached PSOs compile faster meanwhile.
+    // Only full scenes are held back, incremental updates never hide what the user is looking at.
+    if (bPrecompileImportedPSOs && FApp::CanEverRender() && bFullImport && DatasmithRuntimeActorRef.IsValid())
+    {
+        GetWorldTimerManager().ClearTimer(PSOPrecacheTimerHandle);
+        DatasmithRuntimeActorRef->SetActorHiddenInGame(true);
+        bSceneHiddenForPrecache = true;
+        FDSPSOPrecacher::SetFastPrecompile(true);
+    }
+}
+
+void ADSRuntimeManager::HandleUpdateReceived(const FDSDatasmithUpdate& Update)
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::HandleUpdateReceived);
+
+    if (!MobilityPromoter.IsValid() || MobilityPromoter->GetNumPromoted() == 0)
+    {
+        return;
+    }
+
+    // Static components cannot be moved by the update, everything it does not touch stays static
+    int32 NumDemoted = 0;
+    if (Update.bTouchesAll)
+    {
+        NumDemoted = MobilityPromoter->Demote();
+    }
+    else
+    {
+        const USceneComponent* RootComponent = DatasmithRuntimeActorRef.IsValid() ? DatasmithRuntimeActorRef->GetRootComponent() : nullptr;
+        NumDemoted = MobilityPromoter->Demote([&Update, RootComponent](const USceneComponent* Component)
+        {
+            if (Component == RootComponent)
+            {
+                return false;
+            }
+
+            // Components that cannot be matched to an element are demoted to be safe
+            const UDatasmithAssetUserData* UserData = Component->GetAssetUserData<UDatasmithAssetUserData>();
+            const FString* UniqueId = UserData ? UserData->MetaData.Find(UDatasmithAssetUserData::UniqueIdMetaDataKey) : nullptr;
+            return !UniqueId || Update.ActorNames.Contains(*UniqueId);
+        });
+    }
+
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Demoted %d components touched by the update, %d stay static"), NumDemoted, MobilityPromoter->GetNumPromoted());
+}
+
+void ADSRuntimeManager::HandleImportCompleted()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::HandleImportCompleted);
+
+    LastImportSeconds = FPlatformTime::Seconds() - ImportStartTime;
+    ++NumImportsCompleted;
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Datasmith import %d completed in %.3f s, running post-import passes"), NumImportsCompleted, LastImportSeconds);
+    SetImportPhase(TEXT("Post-import passes"));
+    FDSStartupTimeline::Mark(TEXT("Import completed"));
+
+    // Before every other pass, filtered elements are unregistered and skipped by all of them
+    if (ViewFilter.IsValid())
+    {
+        ApplyViewFilters();
+    }
+
+    // World transforms are unchanged by flattening, so the passes below see the same scene either way
+    if (bFlattenImportedHierarchy)
+    {
+        FlattenImportedHierarchy();
+    }
+
+    // Before PSO precaching, static and movable primitives use different pipeline states
+    if (bPromoteStaticMobility)
+    {
+        UpdateMobilityPromotion();
+    }
+
+    // Components were added, moved or filtered by the update
+    InvalidateElementPicker();
+
+    // Re-applied after every update so components added or resized by DirectLink get matching distances
+    if (bEnableSizeCullDistances)
+    {
+        ApplySizeCullDistances();
+    }
+
+    if (bEnableVisibilityCells)
+    {
+        RebuildVisibilityCells();
+    }
+
+    // Textures streamed since an earlier import may be used by new components
+    if (TextureStreamer.IsValid())
+    {
+        TArray<UPrimitiveComponent*> Primitives;
+        GatherImportedPrimitives(Primitives);
+        TextureStreamer->SetPrimitives(Primitives);
+    }
+
+    if (bCompressImportedTextures)
+    {
+        CompressImportedTextures();
+    }
+
+    // Welding and quantization rewrite the meshes, predictions sample them as the importer built them first
+    if (bOptimizeImportedMeshes || bQuantizeImportedVertices)
+    {
+        StartTessellationPredictor();
+    }
+
+    // Mesh passes change vertex layouts, so pipeline states are precached once they have finished
+    if (!bOptimizeImportedMeshes || OptimizeImportedMeshes() == 0)
+    {
+        FinishMeshPasses();
+    }
+}
+
+void ADSRuntimeManager::FinishMeshPasses()
+{
+    // Welding has already run on full precision attributes by now
+    if (bQuantizeImportedVertices)
+    {
+        QuantizeImportedVertices();
+    }
+
+    // Assets keep their references from here until the next update
+    if (bClusterImportedAssets)
+    {
+        ClusterImportedAssets();
+    }
+
+    // Meshes are final by now, so the ranking matches what is drawn
+    if (bSceneCostPending)
+    {
+        bSceneCostPending = false;
+        AnalyzeSceneCost();
+    }
+
+    // Revealing the scene swaps the back buffer in, so it waits for pipeline states when they are precompiled
+    if (bSceneHiddenForPrecache)
+    {
+        StartPSOPrecache();
+    }
+    else if (FrontDatasmithActorRef.IsValid() && IsTextureCompressionInProgress())
+    {
+        // The back buffer is swapped in with its final textures, the previous scene stays on screen meanwhile
+        bSwapAfterTextureCompression = true;
+    }
+    else
+    {
+        SwapImportBuffers();
+    }
+}
+
+void ADSRuntimeManager::SwapImportBuffers()
+{
+    // Every path after an import ends here, the update is on screen from this frame on
+    SetImportPhase(nullptr);
+
+    if (!FrontDatasmithActorRef.IsValid())
+    {
+        return;
+    }
+
+    // Both visibility changes land in the same frame, the viewport never shows both versions or neither
+    if (DatasmithRuntimeActorRef.IsValid())
+    {
+        DatasmithRuntimeActorRef->SetActorHiddenInGame(false);
+    }
+
+    // Retired assets are released as their components are destroyed, not all at once with the cluster
+    ReleaseImportCluster(FrontImportCluster);
+    RetireDatasmithActor(FrontDatasmithActorRef.Get());
+    FrontDatasmithActorRef.Reset();
+    InvalidateElementPicker();
+
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Swapped reimported scene in"));
+}
+
+void ADSRuntimeManager::RetireDatasmithActor(ADatasmithRuntimeActor* RuntimeActor)
+{
+    if (!DeferredDestroyer.IsValid())
+    {
+        DeferredDestroyer = MakeShared<FDSDeferredDestroyer>();
+    }
+
+    const bool bWasIdle = DeferredDestroyer->IsEmpty();
+    DeferredDestroyer->Add(RuntimeActor);
+
+    if (bWasIdle)
+    {
+        DeferredDestroyTimerHandle = GetWorldTimerManager().SetTimerForNextTick(this, &ADSRuntimeManager::TickDeferredDestroy);
+    }
+}
+
+void ADSRuntimeManager::TickDeferredDestroy()
+{
+    if (!DeferredDestroyer.IsValid())
+    {
+        return;
+    }
+
+    if (!DeferredDestroyer->Tick(RetireTimeBudgetMs * 0.001))
+    {
+        DeferredDestroyTimerHandle = GetWorldTimerManager().SetTimerForNextTick(this, &ADSRuntimeManager::TickDeferredDestroy);
+    }
+}
+
+void ADSRuntimeManager::SetDoubleBufferReimports(bool bInEnabled)
+{
+    bDoubleBufferReimports = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Double buffer reimports set to %s"), bDoubleBufferReimports ? TEXT("true") : TEXT("false"));
+}
+
+bool ADSRuntimeManager::IsSceneSwapPending() const
+{
+    return FrontDatasmithActorRef.IsValid();
+}
+
+bool ADSRuntimeManager::IsIdle() const
+{
+    return !IsImportInProgress()
+        && !IsImportRestartPending()
+        && !IsSceneSwapPending()
+        && !IsMeshOptimizationInProgress()
+        && !IsTextureCompressionInProgress()
+        && !IsPSOPrecacheInProgress()
+        && !bVisibilityBuildInFlight
+        && (!DeferredDestroyer.IsValid() || DeferredDestroyer->IsEmpty());
+}
+
+void ADSRuntimeManager::LogStats() const
+{
+    TArray<UPrimitiveComponent*> Primitives;
+    GatherImportedPrimitives(Primitives);
+
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("=== DSRuntimeManager Stats ==="));
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Idle: %s (import %s, restart pending %s, swap pending %s)"), IsIdle() ? TEXT("true") : TEXT("false"),
+           IsImportInProgress() ? TEXT("running") : TEXT("idle"), IsImportRestartPending() ? TEXT("true") : TEXT("false"), IsSceneSwapPending() ? TEXT("true") : TEXT("false"));
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Imports Completed: %d (last took %.3f s)"), NumImportsCompleted, LastImportSeconds);
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Imported Primitives: %d (%d filtered, %d static)"), Primitives.Num(), GetNumFilteredComponents(), GetNumStaticPromotedComponents());
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Mesh Optimization: %s, Texture Compression: %s, PSO Precache: %s (%.0f%%)"),
+           IsMeshOptimizationInProgress() ? TEXT("running") : TEXT("idle"), IsTextureCompressionInProgress() ? TEXT("running") : TEXT("idle"),
+           IsPSOPrecacheInProgress() ? TEXT("running") : TEXT("idle"), GetPSOPrecacheProgress() * 100.0f);
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Streamed Texture Memory: %.1f MB"), GetStreamedTextureMemoryMB());
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Visibility Cells: %s"), VisibilityGrid.IsValid() ? *FString::Printf(TEXT("%d cells"), VisibilityGrid->GetNumCells()) : TEXT("none"));
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Retired Components Pending: %d"), DeferredDestroyer.IsValid() ? DeferredDestroyer->GetNumPendingComponents() : 0);
+
+    if (TaskScheduler.IsValid())
+    {
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("Task Scheduler: %s"), *TaskScheduler->GetStats().ToString());
+    }
+
+    if (MeshWorkerPool.IsValid())
+    {
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("Mesh Worker Pool: %s"), *MeshWorkerPool->GetStats().ToString());
+    }
+
+    if (GCPauseTimer.IsValid())
+    {
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("%s"), *GCPauseTimer->GetStats().ToString());
+    }
+
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Scene Cost Report: %s"), SceneCostReportPath.IsEmpty() ? TEXT("none") : *SceneCostReportPath);
+
+    const FString TessellationPrediction = GetTessellationPrediction();
+    if (!TessellationPrediction.IsEmpty())
+    {
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("Tessellation Prediction: %s"), *TessellationPrediction);
+    }
+
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("=============================="));
+}
+
+void ADSRuntimeManager::SetFlattenImportedHierarchy(bool bInEnabled)
+{
+    bFlattenImportedHierarchy = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Flatten imported hierarchy set to %s"), bFlattenImportedHierarchy ? TEXT("true") : TEXT("false"));
+
+    if (IsImportInProgress())
+    {
+        // Applied when the import completes
+        return;
+    }
+
+    // Promoted components could not be re-attached below movable parents
+    const bool bRepromote = MobilityPromoter.IsValid() && MobilityPromoter->Demote() > 0;
+
+    if (bFlattenImportedHierarchy)
+    {
+        FlattenImportedHierarchy();
+    }
+    else
+    {
+        UnflattenImportedHierarchy();
+    }
+
+    if (bRepromote)
+    {
+        UpdateMobilityPromotion();
+    }
+}
+
+int32 ADSRuntimeManager::FlattenImportedHierarchy()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::FlattenImportedHierarchy);
+
+    if (!DatasmithRuntimeActorRef.IsValid())
+    {
+        return 0;
+    }
+
+    // Recreated so changed grouping settings take effect, the previous flattening is undone first
+    UnflattenImportedHierarchy();
+    HierarchyFlattener = MakeShared<FDSHierarchyFlattener>(FlattenAssemblyDepth, FlattenGroupMetadataKey);
+
+    const FDSHierarchyFlattenReport Report = HierarchyFlattener->Flatten(DatasmithRuntimeActorRef.Get());
+    Report.Log();
+
+    return Report.NumMoved;
+}
+
+int32 ADSRuntimeManager::UnflattenImportedHierarchy()
+{
+    if (!HierarchyFlattener.IsValid())
+    {
+        return 0;
+    }
+
+    const int32 NumRestored = HierarchyFlattener->Unflatten();
+    HierarchyFlattener.Reset();
+    return NumRestored;
+}
+
+void ADSRuntimeManager::SetPromoteStaticMobility(bool bInEnabled)
+{
+    bPromoteStaticMobility = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Promote static mobility set to %s"), bPromoteStaticMobility ? TEXT("true") : TEXT("false"));
+
+    if (!bPromoteStaticMobility && MobilityPromoter.IsValid())
+    {
+        MobilityPromoter->Demote();
+        MobilityPromoter.Reset();
+    }
+}
+
+int32 ADSRuntimeManager::GetNumStaticPromotedComponents() const
+{
+    return MobilityPromoter.IsValid() ? MobilityPromoter->GetNumPromoted() : 0;
+}
+
+int32 ADSRuntimeManager::UpdateMobilityPromotion()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::UpdateMobilityPromotion);
+
+    if (!MobilityPromoter.IsValid())
+    {
+        MobilityPromoter = MakeShared<FDSMobilityPromoter>(MobilityPromotionUpdates);
+    }
+
+    const FDSMobilityPromotionReport Report = MobilityPromoter->Update(DatasmithRuntimeActorRef.Get());
+    Report.Log();
+
+    return Report.NumPromoted;
+}
+
+void ADSRuntimeManager::SetClusterImportedAssets(bool bInEnabled)
+{
+    bClusterImportedAssets = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Cluster imported assets set to %s"), bClusterImportedAssets ? TEXT("true") : TEXT("false"));
+
+    if (!bClusterImportedAssets)
+    {
+        ReleaseImportCluster(ImportCluster);
+    }
+    else if (!bImportInProgress && !ImportCluster)
+    {
+        ClusterImportedAssets();
+    }
+}
+
+int32 ADSRuntimeManager::ClusterImportedAssets()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::ClusterImportedAssets);
+
+    ReleaseImportCluster(ImportCluster);
+
+    TArray<UPrimitiveComponent*> Primitives;
+    GatherImportedPrimitives(Primitives);
+    if (Primitives.Num() == 0)
+    {
+        return 0;
+    }
+
+    FDSGCClusterReport Report;
+    ImportCluster = FDSGCClusterer::CreateCluster(Primitives, Report);
+    Report.Log();
+
+    return Report.NumClustered;
+}
+
+void ADSRuntimeManager::ReleaseImportCluster(TObjectPtr<UDSImportCluster>& Cluster)
+{
+    if (Cluster)
+    {
+        FDSGCClusterer::DissolveCluster(Cluster);
+        Cluster = nullptr;
+    }
+}
+
+void ADSRuntimeManager::SetMeasureGCPauses(bool bInEnabled)
+{
+    bMeasureGCPauses = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Measure GC pauses set to %s"), bMeasureGCPauses ? TEXT("true") : TEXT("false"));
+
+    if (!bMeasureGCPauses)
+    {
+        GCPauseTimer.Reset();
+    }
+    else if (!GCPauseTimer.IsValid())
+    {
+        GCPauseTimer = MakeShared<FDSGCPauseTimer>();
+    }
+}
+
+bool ADSRuntimeManager::GetGCPauseStats(int32& OutNumCollections, float& OutAverageMs, float& OutMaxMs) const
+{
+    if (!GCPauseTimer.IsValid())
+    {
+        OutNumCollections = 0;
+        OutAverageMs = 0.0f;
+        OutMaxMs = 0.0f;
+        return false;
+    }
+
+    const FDSGCPauseStats& Stats = GCPauseTimer->GetStats();
+    OutNumCollections = Stats.NumCollections;
+    OutAverageMs = (float)Stats.GetAverageMs();
+    OutMaxMs = (float)Stats.MaxMs;
+    return true;
+}
+
+void ADSRuntimeManager::ResetGCPauseStats()
+{
+    if (GCPauseTimer.IsValid())
+    {
+        GCPauseTimer->Reset();
+    }
+}
+
+float ADSRuntimeManager::MeasureGCPause()
+{
+    // A temporary timer when not measuring continuously, the collection below is timed either way
+    TSharedPtr<FDSGCPauseTimer> Timer = GCPauseTimer.IsValid() ? GCPauseTimer : MakeShared<FDSGCPauseTimer>();
+
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+
+    const FDSGCPauseStats& Stats = Timer->GetStats();
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Measured GC pause: %.2f ms with %d objects (imported assets %s)"),
+           Stats.LastMs, Stats.NumObjects, ImportCluster ? TEXT("clustered") : TEXT("unclustered"));
+    return (float)Stats.LastMs;
+}
+
+void ADSRuntimeManager::SetAnalyzeSceneCost(bool bInEnabled)
+{
+    bAnalyzeSceneCost = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Analyze scene cost set to %s"), bAnalyzeSceneCost ? TEXT("true") : TEXT("false"));
+}
+
+FString ADSRuntimeManager::AnalyzeSceneCost()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::AnalyzeSceneCost);
+
+    TArray<UPrimitiveComponent*> Primitives;
+    GatherImportedPrimitives(Primitives);
+
+    // Lights synced from other sources light the imported scene as well, so every light in the world counts
+    TArray<ULightComponent*> Lights;
+    for (TActorIterator<AActor> It(GetWorld()); It; ++It)
+    {
+        TArray<ULightComponent*> ActorLights;
+        It->GetComponents<ULightComponent>(ActorLights);
+        Lights.Append(ActorLights);
+    }
+
+    SceneCostReport = MakeShared<FDSSceneCostReport>(FDSSceneCostAnalyzer::Analyze(Primitives, Lights));
+    SceneCostReport->Log(SceneCostLogRows);
+
+    ++SceneCostReportNumber;
+
+    // Only the latest report is kept, the log has the summary of earlier ones
+    const FString FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("DatasmithTest"), TEXT("SceneCost.json"));
+    SceneCostReportPath = SceneCostReport->SaveToJson(FilePath) ? FilePath : FString();
+
+    return SceneCostReportPath;
+}
+
+TArray<FString> ADSRuntimeManager::GetSceneCostCategories() const
+{
+    TArray<FString> Categories;
+    for (int32 CategoryIndex = 0; CategoryIndex < (int32)EDSSceneCostCategory::Count; ++CategoryIndex)
+    {
+        Categories.Add(FDSSceneCostReport::GetCategoryName((EDSSceneCostCategory)CategoryIndex));
+    }
+    return Categories;
+}
+
+TArray<FString> ADSRuntimeManager::GetSceneCostColumns(int32 Category) const
+{
+    if (!SceneCostReport.IsValid() || Category < 0 || Category >= (int32)EDSSceneCostCategory::Count)
+    {
+        return TArray<FString>();
+    }
+    return SceneCostReport->Tables[Category].Columns;
+}
+
+FString ADSRuntimeManager::GetSceneCostTable(int32 Category, int32 SortColumn, int32 MaxRows)
+{
+    if (!SceneCostReport.IsValid() || Category < 0 || Category >= (int32)EDSSceneCostCategory::Count)
+    {
+        return FString();
+    }
+
+    SceneCostReport->Tables[Category].SortBy(SortColumn);
+    return SceneCostReport->ToTable((EDSSceneCostCategory)Category, MaxRows);
+}
+
+void ADSRuntimeManager::SetPickRefineTriangles(bool bInEnabled)
+{
+    bPickRefineTriangles = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Pick refine triangles set to %s"), bPickRefineTriangles ? TEXT("true") : TEXT("false"));
+}
+
+UPrimitiveComponent* ADSRuntimeManager::PickImportedElement(FVector Origin, FVector Direction, float MaxDistance, FVector& OutHitLocation)
+{
+    OutHitLocation = FVector::ZeroVector;
+    if (!Direction.Normalize())
+    {
+        return nullptr;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    FDSElementHit Hit;
+    if (!GetElementPicker().Raycast(Origin, Direction, MaxDistance, bPickRefineTriangles, Hit))
+    {
+        return nullptr;
+    }
+
+    UE_LOG(LogDSRuntimeManager, Verbose, TEXT("Picked %s at %.1f cm (%s) in %.1f us"), *Hit.Component->GetName(), Hit.Distance,
+        Hit.bOnTriangle ? TEXT("triangle") : TEXT("bounds"), (FPlatformTime::Seconds() - StartTime) * 1000000.0);
+
+    OutHitLocation = Hit.Location;
+    return Hit.Component;
+}
+
+int32 ADSRuntimeManager::SelectImportedElementsInScreenRect(APlayerController* PlayerController, FVector2D ScreenMin, FVector2D ScreenMax, TArray<UPrimitiveComponent*>& OutComponents)
+{
+    OutComponents.Reset();
+    if (!IsValid(PlayerController))
+    {
+        return 0;
+    }
+
+    // Corners may come in any order from a drag, and a click without a drag still selects under the cursor
+    const FVector2D Min(FMath::Min(ScreenMin.X, ScreenMax.X), FMath::Min(ScreenMin.Y, ScreenMax.Y));
+    const FVector2D Max(FMath::Max(FMath::Max(ScreenMin.X, ScreenMax.X), Min.X + 1.0), FMath::Max(FMath::Max(ScreenMin.Y, ScreenMax.Y), Min.Y + 1.0));
+
+    const FVector2D Corners[4] = { Min, FVector2D(Max.X, Min.Y), Max, FVector2D(Min.X, Max.Y) };
+    FVector Origins[4];
+    FVector Directions[4];
+    for (int32 Corner = 0; Corner < 4; ++Corner)
+    {
+        if (!PlayerController->DeprojectScreenPositionToWorld(Corners[Corner].X, Corners[Corner].Y, Origins[Corner], Directions[Corner]))
+        {
+            return 0;
+        }
+    }
+
+    FVector CenterOrigin;
+    FVector CenterDirection;
+    PlayerController->DeprojectScreenPositionToWorld((Min.X + Max.X) * 0.5, (Min.Y + Max.Y) * 0.5, CenterOrigin, CenterDirection);
+    const FVector Inside = CenterOrigin + CenterDirection * 100.0;
+
+    // One side plane per rectangle edge, facing away from the rectangle's center ray
+    FConvexVolume Frustum;
+    for (int32 Corner = 0; Corner < 4; ++Corner)
+    {
+        const int32 Next = (Corner + 1) % 4;
+        FPlane Plane(Origins[Corner], Origins[Corner] + Directions[Corner] * 100.0, Origins[Next] + Directions[Next] * 100.0);
+        if (Plane.PlaneDot(Inside) > 0.0)
+        {
+            Plane = Plane.Flip();
+        }
+        Frustum.Planes.Add(Plane);
+    }
+    Frustum.Init();
+
+    const double StartTime = FPlatformTime::Seconds();
+    GetElementPicker().QueryConvex(Frustum, OutComponents);
+
+    UE_LOG(LogDSRuntimeManager, Verbose, TEXT("Selected %d imported components in %.1f us"), OutComponents.Num(), (FPlatformTime::Seconds() - StartTime) * 1000000.0);
+
+    return OutComponents.Num();
+}
+
+void ADSRuntimeManager::InvalidateElementPicker()
+{
+    ElementPicker.Reset();
+}
+
+FDSElementPicker& ADSRuntimeManager::GetElementPicker()
+{
+    if (!ElementPicker.IsValid())
+    {
+        ElementPicker = MakeShared<FDSElementPicker>();
+
+        // While a reimport builds off screen, the scene being looked at is the front buffer
+        TArray<UPrimitiveComponent*> Primitives;
+        if (FrontDatasmithActorRef.IsValid())
+        {
+            FrontDatasmithActorRef->GetComponents<UPrimitiveComponent>(Primitives);
+        }
+        else
+        {
+            GatherImportedPrimitives(Primitives);
+        }
+
+        ElementPicker->Build(Primitives);
+    }
+
+    return *ElementPicker;
+}
+
+void ADSRuntimeManager::GatherImportedPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+    OutPrimitives.Reset();
+
+    if (!DatasmithRuntimeActorRef.IsValid())
+    {
+        return;
+    }
+
+    // The runtime actor owns every component it creates for the imported scene
+    DatasmithRuntimeActorRef->GetComponents<UPrimitiveComponent>(OutPrimitives);
+    OutPrimitives.RemoveAll([](const UPrimitiveComponent* Primitive)
+    {
+        return !IsValid(Primitive) || !Primitive->IsRegistered();
+    });
+}
+
+int32 ADSRuntimeManager::ApplySizeCullDistances()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::ApplySizeCullDistances);
+
+    TArray<UPrimitiveComponent*> Primitives;
+    GatherImportedPrimitives(Primitives);
+    if (Primitives.Num() == 0)
+    {
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("No imported components to classify for cull distances"));
+        return 0;
+    }
+
+    if (!CullDistanceOverrides.IsValid())
+    {
+        CullDistanceOverrides = MakeShared<FDSCullDistanceOverrides>();
+    }
+
+    const FDSCullDistanceClassifier Classifier(*CullDistanceCurve.GetRichCurveConst(), CullDistanceNeverCullRadius);
+    const FDSCullDistanceReport Report = Classifier.Apply(Primitives, CullReportViewDistances, *CullDistanceOverrides);
+    Report.Log();
+
+    return Report.NumPrimitivesChanged;
+}
+
+void ADSRuntimeManager::SetPrecompileImportedPSOs(bool bInEnabled)
+{
+    bPrecompileImportedPSOs = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Precompile imported PSOs set to %s"), bPrecompileImportedPSOs ? TEXT("true") : TEXT("false"));
+
+    // Pipeline states are only recorded for the next session while they are precompiled in this one
+    if (FApp::CanEverRender())
+    {
+        FDSPSOPrecacher::SetRecording(bPrecompileImportedPSOs);
+        if (bPrecompileImportedPSOs)
+        {
+            FDSPSOPrecacher::OpenPersistentCache();
+        }
+    }
+
+    // Never leave the scene hidden once precompilation is switched off
+    if (!bPrecompileImportedPSOs && bSceneHiddenForPrecache)
+    {
+        RevealImportedScene();
+    }
+}
+
+float ADSRuntimeManager::GetPSOPrecacheProgress() const
+{
+    if (!bSceneHiddenForPrecache)
+    {
+        return 1.0f;
+    }
+
+    return PSOPrecacher.IsValid() ? PSOPrecacher->GetProgress() : 0.0f;
+}
+
+void ADSRuntimeManager::StartPSOPrecache()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::StartPSOPrecache);
+
+    TArray<UPrimitiveComponent*> Primitives;
+    GatherImportedPrimitives(Primitives);
+
+    if (!PSOPrecacher.IsValid())
+    {
+        PSOPrecacher = MakeShared<FDSPSOPrecacher>();
+    }
+
+    PSOPrecacher->Start(Primitives);
+    PSOPrecacheStartTime = FPlatformTime::Seconds();
+
+    GetWorldTimerManager().SetTimer(PSOPrecacheTimerHandle, this, &ADSRuntimeManager::PollPSOPrecache, ImportMonitorInterval, true);
+    PollPSOPrecache();
+}
+
+void ADSRuntimeManager::PollPSOPrecache()
+{
+    if (!PSOPrecacher.IsValid())
+    {
+        RevealImportedScene();
+        return;
+    }
+
+    const double Elapsed = FPlatformTime::Seconds() - PSOPrecacheStartTime;
+    if (PSOPrecacher->IsComplete() && IsTextureCompressionInProgress())
+    {
+        // Hidden content is shown with its compressed textures, within the same timeout
+        return;
+    }
+
+    if (PSOPrecacher->IsComplete())
+    {
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("Imported PSOs compiled in %.2f seconds"), Elapsed);
+        RevealImportedScene();
+    }
+    else if (Elapsed > PSOPrecacheTimeout)
+    {
+        UE_LOG(LogDSRuntimeManager, Warning, TEXT("PSO precompilation timed out after %.2f seconds with %d tasks remaining, revealing scene"),
+               Elapsed, PSOPrecacher->GetNumRemaining());
+        RevealImportedScene();
+    }
+}
+
+void ADSRuntimeManager::RevealImportedScene()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::RevealImportedScene);
+
+    GetWorldTimerManager().ClearTimer(PSOPrecacheTimerHandle);
+
+    if (DatasmithRuntimeActorRef.IsValid())
+    {
+        DatasmithRuntimeActorRef->SetActorHiddenInGame(false);
+    }
+
+    bSceneHiddenForPrecache = false;
+    FDSPSOPrecacher::SetFastPrecompile(false);
+    FDSPSOPrecacher::SavePersistentCache();
+
+    if (PSOPrecacher.IsValid())
+    {
+        PSOPrecacher->Reset();
+    }
+
+    SwapImportBuffers();
+}
+
+void ADSRuntimeManager::SetOptimizeImportedMeshes(bool bInEnabled)
+{
+    bOptimizeImportedMeshes = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Optimize imported meshes set to %s"), bOptimizeImportedMeshes ? TEXT("true") : TEXT("false"));
+}
+
+void ADSRuntimeManager::SetMeshWeldTolerance(float InWeldTolerance)
+{
+    MeshWeldTolerance = FMath::Clamp(InWeldTolerance, 0.0f, 1.0f);
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Mesh weld tolerance set to %f"), MeshWeldTolerance);
+
+    // Meshes welded with the previous tolerance are processed again by the next pass
+    if (OptimizedMeshes.IsValid())
+    {
+        OptimizedMeshes->Reset();
+    }
+}
+
+int32 ADSRuntimeManager::OptimizeImportedMeshes()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::OptimizeImportedMeshes);
+
+    CancelMeshOptimization();
+
+    TArray<UPrimitiveComponent*> Primitives;
+    GatherImportedPrimitives(Primitives);
+    if (Primitives.Num() == 0)
+    {
+        return 0;
+    }
+
+    // Seams are only merged where the tessellator's own normal tolerance already allows the shading difference
+    FDSMeshOptimizeSettings Settings;
+    Settings.WeldTolerance = MeshWeldTolerance;
+    Settings.WeldNormalTolerance = NormalTolerance;
+
+    // Updates only queue the meshes they added or rebuilt
+    if (!OptimizedMeshes.IsValid())
+    {
+        OptimizedMeshes = MakeShared<FDSOptimizedMeshes>();
+    }
+    OptimizedMeshes->RemoveStale();
+
+    MeshOptimizationPass = MakeShared<FDSMeshOptimizationPass, ESPMode::ThreadSafe>();
+    FDSMeshWorkerPool* WorkerPool = bOptimizeMeshesInWorkerProcesses ? GetMeshWorkerPool() : nullptr;
+    const int32 NumQueued = MeshOptimizationPass->Start(Primitives, Settings, GetTaskScheduler(), WorkerPool, OptimizedMeshes.Get());
+    if (NumQueued == 0)
+    {
+        MeshOptimizationPass.Reset();
+        return 0;
+    }
+
+    GetWorldTimerManager().SetTimer(MeshOptimizationTimerHandle, this, &ADSRuntimeManager::PollMeshOptimization, ImportMonitorInterval, true);
+    return NumQueued;
+}
+
+bool ADSRuntimeManager::IsMeshOptimizationInProgress() const
+{
+    return MeshOptimizationPass.IsValid();
+}
+
+void ADSRuntimeManager::PollMeshOptimization()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::PollMeshOptimization);
+
+    if (!MeshOptimizationPass.IsValid() || !MeshOptimizationPass->IsComplete())
+    {
+        return;
+    }
+
+    GetWorldTimerManager().ClearTimer(MeshOptimizationTimerHandle);
+
+    const FDSMeshOptimizeReport Report = MeshOptimizationPass->ApplyResults(OptimizedMeshes.Get());
+    MeshOptimizationPass.Reset();
+    Report.Log();
+
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Task scheduler: %s"), *GetTaskScheduler().GetStats().ToString());
+    if (MeshWorkerPool.IsValid())
+    {
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("Mesh worker pool: %s"), *MeshWorkerPool->GetStats().ToString());
+    }
+
+    FinishMeshPasses();
+}
+
+void ADSRuntimeManager::SetOptimizeMeshesInWorkerProcesses(bool bInEnabled)
+{
+    bOptimizeMeshesInWorkerProcesses = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Optimize meshes in worker processes set to %s"), bOptimizeMeshesInWorkerProcesses ? TEXT("true") : TEXT("false"));
+
+    if (!bOptimizeMeshesInWorkerProcesses)
+    {
+        ResetIdleMeshWorkerPool();
+    }
+}
+
+void ADSRuntimeManager::SetMeshWorkerProcessCount(int32 InProcessCount)
+{
+    MeshWorkerProcessCount = FMath::Clamp(InProcessCount, 0, 64);
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Mesh worker process count set to %d"), MeshWorkerProcessCount);
+    ResetIdleMeshWorkerPool();
+}
+
+FDSMeshWorkerPool* ADSRuntimeManager::GetMeshWorkerPool()
+{
+    if (!MeshWorkerPool.IsValid())
+    {
+        MeshWorkerPool = MakeShared<FDSMeshWorkerPool, ESPMode::ThreadSafe>(
+            FDSTaskScheduler::ComputeWorkerCount(MeshWorkerProcessCount, TaskSchedulerReservedCores), MeshWorkerMemoryLimitMB, MeshWorkerMaxRetries);
+    }
+
+    if (!MeshWorkerPool->IsAvailable())
+    {
+        UE_LOG(LogDSRuntimeManager, Warning, TEXT("Mesh worker processes are unavailable, optimizing meshes in process"));
+        return nullptr;
+    }
+
+    return MeshWorkerPool.Get();
+}
+
+void ADSRuntimeManager::ResetIdleMeshWorkerPool()
+{
+    if (!MeshWorkerPool.IsValid())
+    {
+        bMeshWorkerPoolResetPending = false;
+        return;
+    }
+
+    // Destroying the pool stops its workers, so one with work keeps its size until the import monitor finds it idle
+    const FDSMeshWorkerPoolStats Stats = MeshWorkerPool->GetStats();
+    if (Stats.NumRunning == 0 && Stats.NumQueued == 0)
+    {
+        MeshWorkerPool.Reset();
+        bMeshWorkerPoolResetPending = false;
+    }
+    else if (!bMeshWorkerPoolResetPending)
+    {
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("Mesh worker pool is busy, new worker settings apply once it is idle"));
+        bMeshWorkerPoolResetPending = true;
+    }
+}
+
+void ADSRuntimeManager::CancelMeshOptimization()
+{
+    GetWorldTimerManager().ClearTimer(MeshOptimizationTimerHandle);
+
+    if (MeshOptimizationPass.IsValid())
+    {
+        // Queued tasks see the flag and return without optimizing
+        MeshOptimizationPass->Cancel();
+        MeshOptimizationPass.Reset();
+    }
+}
+
+FDSTaskScheduler& ADSRuntimeManager::GetTaskScheduler()
+{
+    if (!TaskScheduler.IsValid())
+    {
+        TaskScheduler = MakeShared<FDSTaskScheduler, ESPMode::ThreadSafe>(TaskSchedulerWorkerCount, TaskSchedulerReservedCores);
+    }
+    return *TaskScheduler;
+}
+
+void ADSRuntimeManager::SetTaskSchedulerWorkerCount(int32 InWorkerCount)
+{
+    TaskSchedulerWorkerCount = FMath::Clamp(InWorkerCount, 0, 64);
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Task scheduler worker count set to %d"), TaskSchedulerWorkerCount);
+    ResetIdleTaskScheduler();
+}
+
+void ADSRuntimeManager::SetTaskSchedulerReservedCores(int32 InReservedCores)
+{
+    TaskSchedulerReservedCores = FMath::Clamp(InReservedCores, 0, 16);
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Task scheduler reserved cores set to %d"), TaskSchedulerReservedCores);
+    ResetIdleTaskScheduler();
+}
+
+float ADSRuntimeManager::GetTaskSchedulerUtilization() const
+{
+    return TaskScheduler.IsValid() ? TaskScheduler->GetStats().Utilization : 0.0f;
+}
+
+int32 ADSRuntimeManager::GetTaskSchedulerQueuedTasks() const
+{
+    return TaskScheduler.IsValid() ? TaskScheduler->GetStats().GetNumQueued() : 0;
+}
+
+void ADSRuntimeManager::ResetIdleTaskScheduler()
+{
+    if (!TaskScheduler.IsValid())
+    {
+        bTaskSchedulerResetPending = false;
+        return;
+    }
+
+    // Destroying the pool would abandon queued work, so busy schedulers keep their size until the import monitor finds them idle
+    if (TaskScheduler->IsIdle())
+    {
+        TaskScheduler.Reset();
+        bTaskSchedulerResetPending = false;
+    }
+    else if (!bTaskSchedulerResetPending)
+    {
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("Task scheduler is busy, new worker settings apply once it is idle"));
+        bTaskSchedulerResetPending = true;
+    }
+}
+
+void ADSRuntimeManager::SetQuantizeImportedVertices(bool bInEnabled)
+{
+    bQuantizeImportedVertices = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Quantize imported vertices set to %s"), bQuantizeImportedVertices ? TEXT("true") : TEXT("false"));
+}
+
+int32 ADSRuntimeManager::QuantizeImportedVertices()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::QuantizeImportedVertices);
+
+    TArray<UPrimitiveComponent*> Primitives;
+    GatherImportedPrimitives(Primitives);
+    if (Primitives.Num() == 0)
+    {
+        return 0;
+    }
+
+    const FDSVertexQuantizer Quantizer(ChordTolerance, NormalTolerance);
+    const FDSVertexQuantizationReport Report = Quantizer.Apply(Primitives);
+    Report.Log();
+
+    return Report.NumLODsQuantized;
+}
+
+void ADSRuntimeManager::SetCompressImportedTextures(bool bInEnabled)
+{
+    bCompressImportedTextures = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Compress imported textures set to %s"), bCompressImportedTextures ? TEXT("true") : TEXT("false"));
+
+    if (!bCompressImportedTextures)
+    {
+        CancelTextureCompression();
+
+        // Never leave a finished back buffer waiting for textures that are no longer compressed
+        if (bSwapAfterTextureCompression)
+        {
+            bSwapAfterTextureCompression = false;
+            SwapImportBuffers();
+        }
+    }
+}
+
+bool ADSRuntimeManager::IsTextureCompressionInProgress() const
+{
+    return TextureCompressionPass.IsValid() && !TextureCompressionPass->IsComplete();
+}
+
+int32 ADSRuntimeManager::CompressImportedTextures()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::CompressImportedTextures);
+
+    // Compressed formats only matter for rendering, headless instances keep the source data unless they fill the cache for viewers
+    if (!FApp::CanEverRender() && !bSyncNode)
+    {
+        return 0;
+    }
+
+    CancelTextureCompression();
+
+    TArray<UPrimitiveComponent*> Primitives;
+    GatherImportedPrimitives(Primitives);
+
+    TextureCompressionPass = MakeShared<FDSTextureCompressionPass, ESPMode::ThreadSafe>();
+    const int32 NumQueued = TextureCompressionPass->Start(Primitives, GetTaskScheduler());
+    if (NumQueued == 0)
+    {
+        TextureCompressionPass.Reset();
+        return 0;
+    }
+
+    GetWorldTimerManager().SetTimer(TextureCompressionTimerHandle, this, &ADSRuntimeManager::PollTextureCompression, ImportMonitorInterval, true);
+    return NumQueued;
+}
+
+void ADSRuntimeManager::PollTextureCompression()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::PollTextureCompression);
+
+    if (!TextureCompressionPass.IsValid())
+    {
+        GetWorldTimerManager().ClearTimer(TextureCompressionTimerHandle);
+        return;
+    }
+
+    if (TextureCompressionPass->IsComplete())
+    {
+        GetWorldTimerManager().ClearTimer(TextureCompressionTimerHandle);
+        const FDSTextureCompressionStats Stats = TextureCompressionPass->ApplyResults();
+        TextureCompressionPass.Reset();
+
+        // The resources were recreated this frame, the back buffer never shows the uncompressed versions
+        if (bSwapAfterTextureCompression)
+        {
+            bSwapAfterTextureCompression = false;
+            SwapImportBuffers();
+        }
+
+        // Only textures with a cache entry can have their dropped mips streamed back in
+        if (bEnableTextureStreaming && Stats.CachedTextures.Num() > 0)
+        {
+            if (!TextureStreamer.IsValid())
+            {
+                TextureStreamer = MakeShared<FDSTextureStreamer, ESPMode::ThreadSafe>(CreateTextureStreamingSettings());
+            }
+
+            for (const TPair<TWeakObjectPtr<UTexture2D>, uint64>& CachedTexture : Stats.CachedTextures)
+            {
+                TextureStreamer->Register(CachedTexture.Key.Get(), CachedTexture.Value);
+            }
+
+            TArray<UPrimitiveComponent*> Primitives;
+            GatherImportedPrimitives(Primitives);
+            TextureStreamer->SetPrimitives(Primitives);
+
+            if (!GetWorldTimerManager().IsTimerActive(TextureStreamingTimerHandle))
+            {
+                GetWorldTimerManager().SetTimer(TextureStreamingTimerHandle, this, &ADSRuntimeManager::UpdateTextureStreaming, TextureStreamingUpdateInterval, true);
+            }
+        }
+    }
+}
+
+void ADSRuntimeManager::SetTextureStreamingEnabled(bool bInEnabled)
+{
+    bEnableTextureStreaming = bInEnabled;
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Texture streaming set to %s"), bEnableTextureStreaming ? TEXT("true") : TEXT("false"));
+
+    if (!bEnableTextureStreaming)
+    {
+        GetWorldTimerManager().ClearTimer(TextureStreamingTimerHandle);
+
+        // Dropped top mips are only reloaded by the streamer, without it textures would stay blurry until the next import
+        if (TextureStreamer.IsValid())
+        {
+            TextureStreamer->RestoreFullMips();
+        }
+        TextureStreamer.Reset();
+    }
+}
+
+void ADSRuntimeManager::SetTextureStreamingPoolSizeMB(int32 InPoolSizeMB)
+{
+    TextureStreamingPoolSizeMB = FMath::Clamp(InPoolSizeMB, 16, 16384);
+    UE_LOG(LogDSRuntimeManager, VeryVerbose, TEXT("Texture streaming pool size set to %d MB"), TextureStreamingPoolSizeMB);
+
+    if (TextureStreamer.IsValid())
+    {
+        TextureStreamer->SetSettings(CreateTextureStreamingSettings());
+    }
+}
+
+float ADSRuntimeManager::GetStreamedTextureMemoryMB() const
+{
+    return TextureStreamer.IsValid() ? TextureStreamer->GetResidentSize() / (1024.0f * 1024.0f) : 0.0f;
+}
+
+void ADSRuntimeManager::UpdateTextureStreaming()
+{
+    UWorld* World = GetWorld();
+    APlayerController* PlayerController = IsValid(World) ? World->GetFirstPlayerController() : nullptr;
+    if (!TextureStreamer.IsValid() || !IsValid(PlayerController) || !PlayerController->PlayerCameraManager)
+    {
+        return;
+    }
+
+    FDSTextureStreamingView View;
+    View.Origin = PlayerController->PlayerCameraManager->GetCameraLocation();
+    View.FOVDegrees = PlayerController->PlayerCameraManager->GetFOVAngle();
+
+    if (GEngine && GEngine->GameViewport)
+    {
+        FVector2D ViewportSize;
+        GEngine->GameViewport->GetViewportSize(ViewportSize);
+        View.ViewportHeight = FMath::Max(ViewportSize.Y, 1.0);
+    }
+
+    TextureStreamer->Update(View);
+}
+
+FDSTextureStreamingSettings ADSRuntimeManager::CreateTextureStreamingSettings() const
+{
+    FDSTextureStreamingSettings Settings;
+    Settings.PoolSize = (int64)TextureStreamingPoolSizeMB * 1024 * 1024;
+    Settings.DropDelay = TextureStreamingDropDelay;
+    return Settings;
+}
+
+void ADSRuntimeManager::CancelTextureCompression()
+{
+    GetWorldTimerManager().ClearTimer(TextureCompressionTimerHandle);
+
+    if (TextureCompressionPass.IsValid())
+    {
+        // Workers hold their own reference and finish quietly in the background
+        TextureCompressionPass->Cancel();
+        TextureCompressionPass.Reset();
+    }
+}
+
+void ADSRuntimeManager::RebuildVisibilityCells()
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::RebuildVisibilityCells);
+
+    // The build in flight sampled components that may have changed since, its result is dropped and
+    // this request runs once it has finished
+    if (bVisibilityBuildInFlight)
+    {
+        ++VisibilityBuildGeneration;
+        bVisibilityRebuildPending = true;
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("Visibility build already in progress, rebuilding once it finishes"));
+        return;
+    }
+
+    ClearVisibilityCulling();
+    const uint32 BuildGeneration = VisibilityBuildGeneration;
+
+    TArray<UPrimitiveComponent*> Primitives;
+    GatherImportedPrimitives(Primitives);
+    if (Primitives.Num() == 0)
+    {
+        UE_LOG(LogDSRuntimeManager, Warning, TEXT("Cannot build visibility cells - no imported components"));
+        return;
+    }
+
+    // Sort by name so component indices stay stable between sessions and the cache can be reused
+    Primitives.Sort([](const UPrimitiveComponent& A, const UPrimitiveComponent& B)
+    {
+        return A.GetName() < B.GetName();
+    });
+
+    TArray<FBox> ComponentBounds;
+    ComponentBounds.Reserve(Primitives.Num());
+    VisibilityComponents.Reset(Primitives.Num());
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+        ComponentBounds.Add(Primitive->Bounds.GetBox());
+        VisibilityComponents.Add(Primitive);
+    }
+
+    FDSVisibilityGridSettings Settings;
+    Settings.CellSize = VisibilityCellSize;
+    Settings.MaxCells = VisibilityMaxCells;
+
+    const uint32 SceneHash = FDSVisibilityGrid::ComputeSceneHash(ComponentBounds, Settings);
+    const FString CachePath = GetVisibilityCachePath(SceneHash);
+    const int32 ComponentCount = ComponentBounds.Num();
+
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Building visibility cells for %d components in the background"), ComponentCount);
+    bVisibilityBuildInFlight = true;
+
+    // Build (or load) the grid off the game thread, then hand it back for runtime culling
+    TWeakObjectPtr<ADSRuntimeManager> WeakThis(this);
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, ComponentBounds = MoveTemp(ComponentBounds), Settings, SceneHash, CachePath, BuildGeneration]()
+    {
+        TSharedPtr<FDSVisibilityGrid, ESPMode::ThreadSafe> Grid = FDSVisibilityGrid::LoadFromFile(CachePath, SceneHash);
+        if (Grid.IsValid())
+        {
+            UE_LOG(LogDSRuntimeManager, Log, TEXT("Loaded visibility cells from cache: %s"), *CachePath);
+        }
+        else
+        {
+            Grid = FDSVisibilityGrid::Build(ComponentBounds, Settings);
+            if (Grid.IsValid())
+            {
+                Grid->SaveToFile(CachePath);
+            }
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Grid, BuildGeneration]()
+        {
+            if (ADSRuntimeManager* Manager = WeakThis.Get())
+            {
+                Manager->OnVisibilityGridReady(Grid, BuildGeneration);
+            }
+        });
+    });
+}
+
+void ADSRuntimeManager::OnVisibilityGridReady(TSharedPtr<FDSVisibilityGrid, ESPMode::ThreadSafe> InGrid, uint32 InBuildGeneration)
+{
+    DS_TRACE_SCOPE(ADSRuntimeManager::OnVisibilityGridReady);
+
+    bVisibilityBuildInFlight = false;
+
+    // A rebuild requested meanwhile starts now; an import in flight rebuilds once it completes instead
+    if (bVisibilityRebuildPending)
+    {
+        bVisibilityRebuildPending = false;
+        if (bEnableVisibilityCells && !bImportInProgress)
+        {
+            RebuildVisibilityCells();
+            return;
+        }
+    }
+
+    if (!InGrid.IsValid())
+    {
+        UE_LOG(LogDSRuntimeManager, Warning, TEXT("Visibility cell build failed"));
+        return;
+    }
+
+    // Discard the result if the scene changed or the culling was cleared while it was being built
+    if (!bEnableVisibilityCells || bImportInProgress || InBuildGeneration != VisibilityBuildGeneration)
+    {
+        UE_LOG(LogDSRuntimeManager, Log, TEXT("Discarding stale visibility cells"));
+        return;
+    }
+
+    VisibilityGrid = InGrid;
+    CurrentVisibilityCell = INDEX_NONE;
+
+    UE_LOG(LogDSRuntimeManager, Log, TEXT("Visibility cells ready: %d cells for %d components"), VisibilityGrid->GetNumCells(), VisibilityGrid->GetNumComponents());
+
+    // The grid is on disk now, a sync node has no camera to cull for
+    if (bSyncNode)
+    {
+        return;
+    }
+
+    GetWorldTimerManager().SetTimer(VisibilityUpdateTimerHandle, this, &ADSRuntimeManager::UpdateVisibilityCulling, VisibilityUpdateInterval, true);
+    UpdateVisibilityCulling();
+}
+
+void ADSRuntimeManager::UpdateVisibilityCulling()
+{
+    UWorld* World = GetWorld();
+    if (!VisibilityGrid.IsValid() || !IsValid(World))
+    {
+        return;
+    }
+
+    APlayerController* PlayerController = World->GetFirstPlayerController();
+    if (!IsValid(PlayerController))
+    {
+        return;
+    }
+
+    // Use the pawn location, falling back to the camera when nothing is possessed
+    FVector ViewLocation;
+    if (const APawn* Pawn = PlayerController->GetPawn())
+    {
+        ViewLocation = Pawn->GetActorLocation();
+    }
+    else
+    {
+        FRotator ViewRotation;
+        PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+    }
+
+    const int32 NewCell = VisibilityGrid->GetCellIndex(ViewLocation);
+    if (NewCell == CurrentVisibilityCell && PlayerController == VisibilityPlayerController.Get())
+    {
+        return;
+    }
+
+    // Collect the components that cannot be seen from the new cell; outside the grid nothing is culled
+    TSet<TWeakObjectPtr<UPrimitiveComponent>> NewHiddenComponents;
+    if (NewCell != INDEX_NONE)
+    {
+        for (int32 ComponentIndex = 0; ComponentIndex < VisibilityComponents.Num(); ++ComponentIndex)
+        {
+            if (VisibilityComponents[ComponentIndex].IsValid() && !VisibilityGrid->IsComponentVisibleFromCell(NewCell, ComponentIndex))
+            {
+                NewHiddenComponents.Add(VisibilityComponents[ComponentIndex]);
+            }
+        }
+    }
+
+    // Hidden primitives are skipped per view before they reach the renderer, without touching component state
+    if (APlayerController* PreviousController = VisibilityPlayerController.Get())
+    {
+        PreviousController->HiddenPrimitiveComponents.RemoveAll([this](const TWeakObjectPtr<UPrimitiveComponent>& Component)
+        {
+            return VisibilityHiddenComponents.Contains(Component);
+        });
+    }
+
+    PlayerController->HiddenPrimitiveComponents.Append(NewHiddenComponents.Array());
+    VisibilityHiddenComponents = MoveTemp(NewHiddenComponents);
+    VisibilityPlayerController = PlayerController;
+    CurrentVisibilityCell = NewCell;
+
+    UE_LOG(LogDSRuntimeManager, Verbose, TEXT("Visibility cell %d: culled %d of %d components"),
+           CurrentVisibilityCell, VisibilityHiddenComponents.Num(), VisibilityComponents.Num());
+}
+
+void ADSRuntimeManager::ClearVisibilityCulling()
+{
+    GetWorldTimerManager().ClearTimer(VisibilityUpdateTimerHandle);
+
+    if (APlayerController* PlayerController = VisibilityPlayerController.Get())
+    {
+        PlayerController->HiddenPrimitiveComponents.RemoveAll([this](const TWeakObjectPtr<UPrimitiveComponent>& Component)
+        {
+            return VisibilityHiddenComponents.Contains(Component);
+        });
+    }
+
+    VisibilityHiddenComponents.Reset();
+    VisibilityPlayerController.Reset();
+    VisibilityGrid.Reset();
+    CurrentVisibilityCell = INDEX_NONE;
+
+    // A build still running was sampled from the components being cleared
+    ++VisibilityBuildGeneration;
+}
+
+FString ADSRuntimeManager::GetVisibilityCachePath(uint32 SceneHash) const
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("DatasmithTest"), TEXT("Visibility"), FString::Printf(TEXT("%08x.dsvis"), SceneHash));
 }
\ No newline at end of file
@@ -14,6 +14,8 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
+#include "Curves/CurveFloat.h"
+#include "Containers/Ticker.h"
 #include "DatasmithRuntime.h"
 #include "DatasmithRuntimeBlueprintLibrary.h"
 #include "DSRuntimeManager.generated.h"
@@ -21,6 +23,28 @@
 // Forward declarations
 class ADatasmithRuntimeActor;
 class UDirectLinkProxy;
+class UPrimitiveComponent;
+class APlayerController;
+class FDSVisibilityGrid;
+class FDSPSOPrecacher;
+class FDSTextureCompressionPass;
+class FDSTextureStreamer;
+class FDSTaskScheduler;
+class FDSMeshOptimizationPass;
+class FDSOptimizedMeshes;
+class FDSMeshWorkerPool;
+class FDSTessellationPredictor;
+class FDSDeferredDestroyer;
+class FDSHierarchyFlattener;
+class FDSMobilityPromoter;
+class FDSMetadataViewFilter;
+class FDSElementPicker;
+struct FDSCullDistanceOverrides;
+struct FDSDatasmithUpdate;
+class FDSGCPauseTimer;
+class UDSImportCluster;
+struct FDSSceneCostReport;
+struct FDSTextureStreamingSettings;
 
 /**
  * ADSRuntimeManager - Manages Datasmith runtime imports and DirectLink connections
@@ -43,6 +67,8 @@ class DATASMITHTEST_API ADSRuntimeManager : public AActor
 public:
     ADSRuntimeManager();
 
+    virtual void Tick(float DeltaSeconds) override;
+
 protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -96,11 +122,341 @@ private:
               meta = (AllowPrivateAccess = "true"))
     bool bImportMetaData = true;
 
+    // View Filter Settings - received elements that fail these rules are not built, built ones are hidden when the rules change
+    // Only elements matching one of these "Key=Pattern" rules stay visible, e.g. "Level=Level 3"; empty shows everything
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|View Filter", 
+              meta = (AllowPrivateAccess = "true"))
+    TArray<FString> ViewIncludeFilters;
+
+    // Elements matching any of these "Key=Pattern" rules are hidden, e.g. "Category=MEP*"
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|View Filter", 
+              meta = (AllowPrivateAccess = "true"))
+    TArray<FString> ViewExcludeFilters;
+
     // DirectLink Settings
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DirectLink", 
               meta = (AllowPrivateAccess = "true", ClampMin = "0"))
     int32 DirectLinkSourceIndex = 0;
 
+    // Startup - initializes the DirectLink endpoint and the runtime actor on the frame after BeginPlay instead of during it
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Startup", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bDeferInitialization = true;
+
+    // Sync Node - interval at which a headless sync node retries connecting to the DirectLink source
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sync Node", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0.5", ClampMax = "60.0"))
+    float SyncNodeConnectInterval = 5.0f;
+
+    // Import Monitoring - interval at which the runtime actor is polled for import start/completion
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Import Monitoring", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0.01", ClampMax = "5.0"))
+    float ImportMonitorInterval = 0.1f;
+
+    // Restarts an import that is still in flight when import options change, instead of letting it finish with stale settings
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Import Monitoring", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bRestartImportOnSettingsChange = true;
+
+    // Time to wait for further option changes before restarting, so edits made together restart the import once
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Import Monitoring", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0.0", ClampMax = "5.0"))
+    float ImportRestartDelay = 0.5f;
+
+    // Builds reimports of a finished scene in a hidden actor and swaps it in once complete, instead of rebuilding in place
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Import Monitoring", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bDoubleBufferReimports = true;
+
+    // Time per frame spent destroying the components of a swapped out scene
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Import Monitoring", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0.1", ClampMax = "50.0"))
+    float RetireTimeBudgetMs = 2.0f;
+
+    // Post Import - Precomputed Visibility Settings
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Visibility", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bEnableVisibilityCells = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Visibility", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "50.0", ClampMax = "10000.0"))
+    float VisibilityCellSize = 400.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Visibility", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "8", ClampMax = "8192"))
+    int32 VisibilityMaxCells = 1024;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Visibility", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0.05", ClampMax = "5.0"))
+    float VisibilityUpdateInterval = 0.25f;
+
+    // Post Import - Hierarchy Flattening Settings
+    // Re-attaches deep imported component trees to a few group components, keeping world transforms
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Hierarchy", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bFlattenImportedHierarchy = false;
+
+    // Depth below the root of the assemblies components are grouped under, 0 puts everything directly below the root
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Hierarchy", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0", ClampMax = "16"))
+    int32 FlattenAssemblyDepth = 1;
+
+    // Groups components by the value of this metadata key instead of by assembly, when set
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Hierarchy", 
+              meta = (AllowPrivateAccess = "true"))
+    FName FlattenGroupMetadataKey;
+
+    // Post Import - Mobility Settings
+    // Switches imported components that no update has touched for a while to static mobility
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Mobility", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bPromoteStaticMobility = false;
+
+    // Number of consecutive updates a component must stay unchanged before it is promoted
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Mobility", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "1", ClampMax = "100"))
+    int32 MobilityPromotionUpdates = 2;
+
+    // Post Import - Garbage Collection Settings
+    // Groups the assets of each import into one GC cluster so reachability passes skip them while they are unchanged.
+    // The cluster is dissolved when an update starts and rebuilt once it is processed, which costs a walk of every
+    // imported asset per update; worth it for large scenes that are rarely updated, measure with ds.GC.Measure.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Garbage Collection", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bClusterImportedAssets = false;
+
+    // Times every garbage collection pause, to compare runs with and without clustering
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Garbage Collection", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bMeasureGCPauses = false;
+
+    // Post Import - Analysis Settings
+    // Ranks the heaviest meshes, materials, textures, components and lights once a full import is complete and writes
+    // a JSON report. Walks every primitive on the game thread, so incremental updates are left to AnalyzeSceneCost.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Analysis", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bAnalyzeSceneCost = false;
+
+    // Number of entries per category written to the log
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Analysis", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "1", ClampMax = "100"))
+    int32 SceneCostLogRows = 10;
+
+    // Post Import - Picking Settings
+    // Refines picks against mesh triangles instead of stopping at component bounds; triangles are indexed on first hit per mesh
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Picking", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bPickRefineTriangles = true;
+
+    // Post Import - Size-Based Cull Distance Settings
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Cull Distance", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bEnableSizeCullDistances = false;
+
+    // Maps a component's bounds radius (cm) to its max draw distance (cm)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Cull Distance", 
+              meta = (AllowPrivateAccess = "true", XAxisName = "Bounds Radius", YAxisName = "Max Draw Distance"))
+    FRuntimeFloatCurve CullDistanceCurve;
+
+    // Components with a bounds radius at or above this value are never distance culled
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Cull Distance", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+    float CullDistanceNeverCullRadius = 150.0f;
+
+    // Viewing distances (cm) the cull distance report is computed for
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Cull Distance", 
+              meta = (AllowPrivateAccess = "true"))
+    TArray<float> CullReportViewDistances;
+
+    // Post Import - Shader/PSO Precompilation Settings
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Shaders", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bPrecompileImportedPSOs = false;
+
+    // Maximum time a newly imported scene stays hidden while its pipeline states compile, updates are never hidden
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Shaders", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0.0", ClampMax = "300.0"))
+    float PSOPrecacheTimeout = 30.0f;
+
+    // Post Import - Scheduling Settings
+    // Worker threads used for post-import work, 0 derives the count from the cores left after the reservation
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Scheduling", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0", ClampMax = "64"))
+    int32 TaskSchedulerWorkerCount = 0;
+
+    // Cores kept free for the game, render and RHI threads
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Scheduling", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0", ClampMax = "16"))
+    int32 TaskSchedulerReservedCores = 2;
+
+    // Post Import - Mesh Settings
+    // Welds seam vertices, reorders triangles for the vertex cache and overdraw, and compacts vertex buffers.
+    // Welding within the tolerance is lossy, so it is off unless opted into.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Meshes", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bOptimizeImportedMeshes = false;
+
+    // Vertices closer than this (cm) with matching normals and UVs are merged
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Meshes", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0.0", ClampMax = "1.0"))
+    float MeshWeldTolerance = 0.01f;
+
+    // Optimizes meshes in separate worker processes, keeping their memory and any crash out of the viewer
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Meshes", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bOptimizeMeshesInWorkerProcesses = false;
+
+    // Worker processes used for mesh optimization, 0 derives the count like the task scheduler does
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Meshes", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0", ClampMax = "64"))
+    int32 MeshWorkerProcessCount = 0;
+
+    // Memory a worker process may use before it is restarted, 0 for no limit
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Meshes", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0", ClampMax = "65536"))
+    int32 MeshWorkerMemoryLimitMB = 4096;
+
+    // Times a mesh is retried on a new worker after its worker crashed, hung or ran out of memory
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Meshes", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0", ClampMax = "10"))
+    int32 MeshWorkerMaxRetries = 2;
+
+    // Stores UVs and tangents of imported meshes at reduced precision when the error stays within the tessellation tolerances
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Meshes", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bQuantizeImportedVertices = false;
+
+    // Post Import - Texture Compression Settings
+    // Textures are compressed after the importer has uploaded them and swapped in place. Divides texture memory by
+    // 4 to 8 and runs on workers, but block compression is lossy, so it is off unless opted into; updates in place
+    // are never delayed by it, only hidden scenes wait for it.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Textures", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bCompressImportedTextures = false;
+
+    // Streams mips of compressed imported textures from the texture cache based on on-screen size
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Textures", 
+              meta = (AllowPrivateAccess = "true"))
+    bool bEnableTextureStreaming = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Textures", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "16", ClampMax = "16384"))
+    int32 TextureStreamingPoolSizeMB = 512;
+
+    // Time a mip must be unneeded before it is dropped
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Textures", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0.0", ClampMax = "60.0"))
+    float TextureStreamingDropDelay = 5.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Import|Textures", 
+              meta = (AllowPrivateAccess = "true", ClampMin = "0.05", ClampMax = "5.0"))
+    float TextureStreamingUpdateInterval = 0.25f;
+
+    // Sync Node State - set when running headless to warm the on-disk caches for viewers
+    bool bSyncNode = false;
+    FTimerHandle SyncNodeConnectTimerHandle;
+
+    // Import Monitoring State
+    FTimerHandle ImportMonitorTimerHandle;
+    FTimerHandle ImportRestartTimerHandle;
+    bool bServicesInitialized = false;
+    bool bImportInProgress = false;
+    double ImportStartTime = 0.0;
+    double LastImportSeconds = 0.0;
+    int32 NumImportsCompleted = 0;
+
+    // Profiling State - trace region of the import phase in flight, and the ticker recording CSV stats
+    FString ImportPhaseRegion;
+    int32 TracedImportNumber = 0;
+    FTSTicker::FDelegateHandle CsvStatsTickerHandle;
+
+    // Double Buffered Reimport State - the front actor stays on screen while DatasmithRuntimeActorRef builds hidden
+    TWeakObjectPtr<ADatasmithRuntimeActor> FrontDatasmithActorRef;
+    TSharedPtr<FDSDeferredDestroyer> DeferredDestroyer;
+    FTimerHandle DeferredDestroyTimerHandle;
+
+    // Cull Distance State - original draw distances of the components the classifier changed
+    TSharedPtr<FDSCullDistanceOverrides> CullDistanceOverrides;
+
+    // View Filter State
+    TSharedPtr<FDSMetadataViewFilter> ViewFilter;
+
+    // Hierarchy Flattening State
+    TSharedPtr<FDSHierarchyFlattener> HierarchyFlattener;
+
+    // Mobility Promotion State
+    TSharedPtr<FDSMobilityPromoter> MobilityPromoter;
+
+    // GC Clustering State - one cluster per import batch, the front actor keeps its own until it is retired
+    UPROPERTY(Transient)
+    TObjectPtr<UDSImportCluster> ImportCluster;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UDSImportCluster> FrontImportCluster;
+
+    TSharedPtr<FDSGCPauseTimer> GCPauseTimer;
+
+    // Scene Cost Analysis State
+    TSharedPtr<FDSSceneCostReport> SceneCostReport;
+    FString SceneCostReportPath;
+    int32 SceneCostReportNumber = 0;
+    bool bSceneCostPending = false;
+
+    // Element Picking State - built on the first query after the imported components changed
+    TSharedPtr<FDSElementPicker> ElementPicker;
+
+    // Precomputed Visibility State
+    TSharedPtr<FDSVisibilityGrid, ESPMode::ThreadSafe> VisibilityGrid;
+    TArray<TWeakObjectPtr<UPrimitiveComponent>> VisibilityComponents;
+    TSet<TWeakObjectPtr<UPrimitiveComponent>> VisibilityHiddenComponents;
+    TWeakObjectPtr<APlayerController> VisibilityPlayerController;
+    FTimerHandle VisibilityUpdateTimerHandle;
+    int32 CurrentVisibilityCell = INDEX_NONE;
+    uint32 VisibilityBuildGeneration = 0;
+    bool bVisibilityBuildInFlight = false;
+    bool bVisibilityRebuildPending = false;
+
+    // Shader/PSO Precompilation State
+    TSharedPtr<FDSPSOPrecacher> PSOPrecacher;
+    FTimerHandle PSOPrecacheTimerHandle;
+    double PSOPrecacheStartTime = 0.0;
+    bool bSceneHiddenForPrecache = false;
+
+    // Set when the next import builds a whole scene instead of updating the one on screen
+    bool bFullImportPending = false;
+
+    // Task Scheduling State
+    TSharedPtr<FDSTaskScheduler, ESPMode::ThreadSafe> TaskScheduler;
+
+    // Set while changed worker settings wait for the scheduler or the mesh worker pool to drain
+    bool bTaskSchedulerResetPending = false;
+    bool bMeshWorkerPoolResetPending = false;
+
+    // Tessellation Prediction State - tolerances the current scene was imported with, and the predictor sampling it
+    float ImportedChordTolerance = 0.05f;
+    float ImportedMaxEdgeLength = 0.0f;
+    float ImportedNormalTolerance = 5.0f;
+    TSharedPtr<FDSTessellationPredictor, ESPMode::ThreadSafe> TessellationPredictor;
+
+    // Mesh Optimization State
+    TSharedPtr<FDSMeshOptimizationPass, ESPMode::ThreadSafe> MeshOptimizationPass;
+    FTimerHandle MeshOptimizationTimerHandle;
+
+    // Meshes already optimized, updates only queue new or rebuilt ones
+    TSharedPtr<FDSOptimizedMeshes> OptimizedMeshes;
+    TSharedPtr<FDSMeshWorkerPool, ESPMode::ThreadSafe> MeshWorkerPool;
+
+    // Texture Compression State
+    TSharedPtr<FDSTextureCompressionPass, ESPMode::ThreadSafe> TextureCompressionPass;
+    FTimerHandle TextureCompressionTimerHandle;
+
+    // Set when a finished back buffer is swapped in as soon as its textures are compressed
+    bool bSwapAfterTextureCompression = false;
+
+    // Texture Streaming State
+    TSharedPtr<FDSTextureStreamer, ESPMode::ThreadSafe> TextureStreamer;
+    FTimerHandle TextureStreamingTimerHandle;
+
 public:
     // Core functionality
     /**
@@ -131,6 +487,16 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|DirectLink")
     int32 GetAvailableSourceCount() const;
 
+    /**
+     * Switches to headless sync node operation: keeps connecting to the DirectLink source and runs
+     * only the post-import passes that fill on-disk caches, skipping everything that only serves a viewport
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Sync Node")
+    void EnterSyncNodeMode();
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Sync Node")
+    bool IsSyncNode() const { return bSyncNode; }
+
     // Tessellation Settings - Getters
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Import Options|Tessellation")
     float GetChordTolerance() const { return ChordTolerance; }
@@ -157,6 +523,28 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Datasmith|Import Options|Tessellation")
     void SetStitchingTechnique(EDatasmithCADStitchingTechnique InStitchingTechnique);
 
+    /**
+     * Estimates the triangle count, memory and import time of the imported scene at other tolerances,
+     * from a sample of its meshes analyzed in the background; the settings are not applied. When meshes
+     * are optimized or quantized, the sample is taken before those passes, as the importer built them.
+     * @return False while importing or optimizing meshes, or if no imported mesh can be sampled
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Import Options|Tessellation")
+    bool PredictTessellationCost(float InChordTolerance, float InMaxEdgeLength, float InNormalTolerance);
+
+    /**
+     * Gets the latest tessellation cost prediction as a single line
+     * @return Empty until a prediction has been computed for the current scene
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Import Options|Tessellation")
+    FString GetTessellationPrediction() const;
+
+    /**
+     * Checks whether a tessellation cost prediction is still being computed
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Import Options|Tessellation")
+    bool IsTessellationPredictionInProgress() const;
+
     // Hierarchy Settings - Getters/Setters
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Import Options|Hierarchy")
     EBuildHierarchyMethod GetHierarchyMethod() const { return HierarchyMethod; }
@@ -184,6 +572,34 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Datasmith|Import Options|Metadata")
     void SetImportMetadata(bool bInImportMetadata);
 
+    // View Filter Settings - Getters/Setters
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|View Filter")
+    TArray<FString> GetViewIncludeFilters() const { return ViewIncludeFilters; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|View Filter")
+    void SetViewIncludeFilters(const TArray<FString>& InFilters);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|View Filter")
+    TArray<FString> GetViewExcludeFilters() const { return ViewExcludeFilters; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|View Filter")
+    void SetViewExcludeFilters(const TArray<FString>& InFilters);
+
+    /**
+     * Re-evaluates the view filters on the components already built, unregistering the ones
+     * that do not pass and restoring the ones that pass again. Received elements are filtered
+     * before they are built, this covers what was built before the rules changed
+     * @return Number of elements filtered out
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|View Filter")
+    int32 ApplyViewFilters();
+
+    /**
+     * Gets the number of imported elements currently hidden by the view filters
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|View Filter")
+    int32 GetNumFilteredComponents() const;
+
     // DirectLink Settings - Getters/Setters
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|DirectLink")
     int32 GetDirectLinkSourceIndex() const { return DirectLinkSourceIndex; }
@@ -198,6 +614,423 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Datasmith|Import Options")
     bool ApplyImportOptions();
 
+    /**
+     * Checks whether the runtime actor is currently receiving or building a scene
+     * @return True while an import or DirectLink update is in flight
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Runtime")
+    bool IsImportInProgress() const;
+
+    /**
+     * Cancels the current import, including queued tessellation, mesh builds and post-import
+     * passes, and starts a new one with the current import options. A finished scene stays on
+     * screen until the new one is ready when reimports are double buffered.
+     * @return True if the new import was requested, false if no source was connected; the current
+     *         options are then applied to the runtime actor and used by the next connection
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Runtime")
+    bool RestartImport();
+
+    /**
+     * Checks whether an import restart is waiting for further option changes
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Runtime")
+    bool IsImportRestartPending() const;
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Runtime")
+    bool GetRestartImportOnSettingsChange() const { return bRestartImportOnSettingsChange; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Runtime")
+    void SetRestartImportOnSettingsChange(bool bInEnabled);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Runtime")
+    bool GetDoubleBufferReimports() const { return bDoubleBufferReimports; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Runtime")
+    void SetDoubleBufferReimports(bool bInEnabled);
+
+    /**
+     * Checks whether a reimport is being built off screen while the previous scene stays visible
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Runtime")
+    bool IsSceneSwapPending() const;
+
+    /**
+     * Checks whether InitializeServices has completed, commands issued before that find no runtime actor
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Runtime")
+    bool IsInitialized() const { return bServicesInitialized; }
+
+    /**
+     * Checks whether nothing is running: no import, restart, post-import pass, shader precompilation,
+     * scene swap or teardown of a retired scene
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Runtime")
+    bool IsIdle() const;
+
+    /**
+     * Gets how long the last import or DirectLink update took, from the first frame the runtime actor was
+     * receiving it until it was built, before post-import passes. Time the source spends exporting and
+     * sending before the first element arrives is not included.
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Runtime")
+    float GetLastImportSeconds() const { return (float)LastImportSeconds; }
+
+    /**
+     * Gets the number of imports and DirectLink updates completed since BeginPlay
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Runtime")
+    int32 GetNumImportsCompleted() const { return NumImportsCompleted; }
+
+    /**
+     * Writes the state of the import and of every post-import pass to the log
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Runtime")
+    void LogStats() const;
+
+    // Hierarchy Flattening - Getters/Setters
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Hierarchy")
+    bool GetFlattenImportedHierarchy() const { return bFlattenImportedHierarchy; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Hierarchy")
+    void SetFlattenImportedHierarchy(bool bInEnabled);
+
+    /**
+     * Re-attaches the imported components to their assembly or metadata groups, keeping world transforms
+     * @return Number of components moved
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Hierarchy")
+    int32 FlattenImportedHierarchy();
+
+    /**
+     * Restores the imported hierarchy, required before the runtime importer applies an update
+     * @return Number of components re-attached to their original parents
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Hierarchy")
+    int32 UnflattenImportedHierarchy();
+
+    // Mobility Promotion - Getters/Setters
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Mobility")
+    bool GetPromoteStaticMobility() const { return bPromoteStaticMobility; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Mobility")
+    void SetPromoteStaticMobility(bool bInEnabled);
+
+    /**
+     * Gets the number of imported components currently promoted to static mobility
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Mobility")
+    int32 GetNumStaticPromotedComponents() const;
+
+    /**
+     * Records which imported components the last update changed and promotes the ones unchanged
+     * for enough updates to static mobility
+     * @return Number of primitives promoted by this call
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Mobility")
+    int32 UpdateMobilityPromotion();
+
+    // GC Clustering - Getters/Setters
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Garbage Collection")
+    bool GetClusterImportedAssets() const { return bClusterImportedAssets; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Garbage Collection")
+    void SetClusterImportedAssets(bool bInEnabled);
+
+    /**
+     * Groups the meshes and materials of the current import, and what they reference, into a GC cluster
+     * @return Number of objects in the cluster, 0 if clustering is disabled in the engine
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Garbage Collection")
+    int32 ClusterImportedAssets();
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Garbage Collection")
+    bool GetMeasureGCPauses() const { return bMeasureGCPauses; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Garbage Collection")
+    void SetMeasureGCPauses(bool bInEnabled);
+
+    /**
+     * Gets the garbage collection pauses measured since measuring was enabled or last reset
+     * @param OutNumCollections Number of collections measured
+     * @param OutAverageMs Mean pause in milliseconds
+     * @param OutMaxMs Longest pause in milliseconds
+     * @return False when pauses are not being measured
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Garbage Collection")
+    bool GetGCPauseStats(int32& OutNumCollections, float& OutAverageMs, float& OutMaxMs) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Garbage Collection")
+    void ResetGCPauseStats();
+
+    /**
+     * Runs a full garbage collection right away and measures its pause
+     * @return Pause in milliseconds
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Garbage Collection")
+    float MeasureGCPause();
+
+    // Scene Cost Analysis - Getters/Setters
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Analysis")
+    bool GetAnalyzeSceneCost() const { return bAnalyzeSceneCost; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Analysis")
+    void SetAnalyzeSceneCost(bool bInEnabled);
+
+    /**
+     * Ranks the heaviest contributors of the imported scene, logs them and writes the full report as JSON.
+     * Every analysis overwrites the same report file.
+     * @return Path of the JSON report, empty if it could not be written
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Analysis")
+    FString AnalyzeSceneCost();
+
+    /**
+     * Gets the path of the last JSON scene cost report
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Analysis")
+    FString GetSceneCostReportPath() const { return SceneCostReportPath; }
+
+    /**
+     * Gets the number of scene cost analyses run so far, it changes whenever a new report is available
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Analysis")
+    int32 GetSceneCostReportNumber() const { return SceneCostReportNumber; }
+
+    /**
+     * Gets the names of the scene cost categories, in the order used by the other scene cost functions
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Analysis")
+    TArray<FString> GetSceneCostCategories() const;
+
+    /**
+     * Gets the metric columns of a scene cost category
+     * @param Category Index into GetSceneCostCategories
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Analysis")
+    TArray<FString> GetSceneCostColumns(int32 Category) const;
+
+    /**
+     * Formats the last scene cost report as a text table
+     * @param Category Index into GetSceneCostCategories
+     * @param SortColumn Index into GetSceneCostColumns the rows are sorted by, most expensive first
+     * @param MaxRows Maximum number of rows
+     * @return The table, empty if no analysis has run yet
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Analysis")
+    FString GetSceneCostTable(int32 Category, int32 SortColumn, int32 MaxRows);
+
+    // Element Picking - Getters/Setters
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Picking")
+    bool GetPickRefineTriangles() const { return bPickRefineTriangles; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Picking")
+    void SetPickRefineTriangles(bool bInEnabled);
+
+    /**
+     * Finds the closest visible imported component along a ray, without physics collision
+     * @param Origin Ray origin in world space
+     * @param Direction Ray direction
+     * @param MaxDistance Hits beyond this distance are ignored
+     * @param OutHitLocation World location of the hit
+     * @return The hit component, or nullptr if nothing was hit
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Picking")
+    UPrimitiveComponent* PickImportedElement(FVector Origin, FVector Direction, float MaxDistance, FVector& OutHitLocation);
+
+    /**
+     * Collects the visible imported components whose bounds fall inside a screen rectangle
+     * @param PlayerController Player whose view the rectangle is in
+     * @param ScreenMin One corner of the rectangle in viewport pixels
+     * @param ScreenMax Opposite corner of the rectangle in viewport pixels
+     * @param OutComponents Components inside the rectangle
+     * @return Number of components selected
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Picking")
+    int32 SelectImportedElementsInScreenRect(APlayerController* PlayerController, FVector2D ScreenMin, FVector2D ScreenMax, TArray<UPrimitiveComponent*>& OutComponents);
+
+    /**
+     * Drops the picking hierarchy so the next query rebuilds it, needed after imported components move
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Picking")
+    void InvalidateElementPicker();
+
+    // Precomputed Visibility - Getters/Setters
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Visibility")
+    bool GetVisibilityCellsEnabled() const { return bEnableVisibilityCells; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Visibility")
+    void SetVisibilityCellsEnabled(bool bInEnabled);
+
+    /**
+     * Starts a background build of the cell-to-cell visibility grid for the imported scene.
+     * A cached grid is reused when the scene layout has not changed.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Visibility")
+    void RebuildVisibilityCells();
+
+    // Size-Based Cull Distances - Getters/Setters
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Cull Distance")
+    bool GetSizeCullDistancesEnabled() const { return bEnableSizeCullDistances; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Cull Distance")
+    void SetSizeCullDistancesEnabled(bool bInEnabled);
+
+    /**
+     * Classifies imported components by bounds radius, sets their max draw distances
+     * from the cull distance curve and logs how many primitives each size class removes
+     * @return Number of components whose cull distance changed
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Cull Distance")
+    int32 ApplySizeCullDistances();
+
+    // Shader/PSO Precompilation - Getters/Setters
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Shaders")
+    bool GetPrecompileImportedPSOs() const { return bPrecompileImportedPSOs; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Shaders")
+    void SetPrecompileImportedPSOs(bool bInEnabled);
+
+    /**
+     * Checks whether imported content is hidden while its pipeline states compile
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Shaders")
+    bool IsPSOPrecacheInProgress() const { return bSceneHiddenForPrecache; }
+
+    /**
+     * Gets the progress of the pipeline state precompilation for the last import
+     * @return Progress between 0 and 1, 1 when nothing is compiling
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Shaders")
+    float GetPSOPrecacheProgress() const;
+
+    // Mesh Optimization - Getters/Setters
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Meshes")
+    bool GetOptimizeImportedMeshes() const { return bOptimizeImportedMeshes; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Meshes")
+    void SetOptimizeImportedMeshes(bool bInEnabled);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Meshes")
+    float GetMeshWeldTolerance() const { return MeshWeldTolerance; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Meshes")
+    void SetMeshWeldTolerance(float InWeldTolerance);
+
+    /**
+     * Welds, reorders and compacts the imported meshes on the task scheduler; ACMR and vertex counts
+     * before and after are logged when the pass completes. Meshes optimized by an earlier pass are
+     * skipped unless an update has rebuilt them or the weld tolerance has changed
+     * @return Number of mesh LODs queued for optimization
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Meshes")
+    int32 OptimizeImportedMeshes();
+
+    /**
+     * Checks whether imported meshes are currently being optimized
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Meshes")
+    bool IsMeshOptimizationInProgress() const;
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Meshes")
+    bool GetOptimizeMeshesInWorkerProcesses() const { return bOptimizeMeshesInWorkerProcesses; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Meshes")
+    void SetOptimizeMeshesInWorkerProcesses(bool bInEnabled);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Meshes")
+    int32 GetMeshWorkerProcessCount() const { return MeshWorkerProcessCount; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Meshes")
+    void SetMeshWorkerProcessCount(int32 InProcessCount);
+
+    // Task Scheduling - Getters/Setters
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Scheduling")
+    int32 GetTaskSchedulerWorkerCount() const { return TaskSchedulerWorkerCount; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Scheduling")
+    void SetTaskSchedulerWorkerCount(int32 InWorkerCount);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Scheduling")
+    int32 GetTaskSchedulerReservedCores() const { return TaskSchedulerReservedCores; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Scheduling")
+    void SetTaskSchedulerReservedCores(int32 InReservedCores);
+
+    /**
+     * Gets the fraction of worker time spent on post-import tasks over the last second
+     * @return Utilization between 0 and 1
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Scheduling")
+    float GetTaskSchedulerUtilization() const;
+
+    /**
+     * Gets the number of post-import tasks waiting for a worker
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Scheduling")
+    int32 GetTaskSchedulerQueuedTasks() const;
+
+    // Vertex Quantization - Getters/Setters
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Meshes")
+    bool GetQuantizeImportedVertices() const { return bQuantizeImportedVertices; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Meshes")
+    void SetQuantizeImportedVertices(bool bInEnabled);
+
+    /**
+     * Requantizes the vertex attributes of imported meshes within the chord and normal tolerances
+     * and logs the memory saved
+     * @return Number of mesh LODs that were quantized
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Meshes")
+    int32 QuantizeImportedVertices();
+
+    // Texture Compression - Getters/Setters
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Textures")
+    bool GetCompressImportedTextures() const { return bCompressImportedTextures; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Textures")
+    void SetCompressImportedTextures(bool bInEnabled);
+
+    /**
+     * Block compresses the uncompressed textures of the imported materials on background threads,
+     * reusing cached results for textures whose content has been compressed before. The importer has
+     * already uploaded the textures; compressed mips replace them in place, and back buffers or scenes
+     * hidden for PSO precompilation are only shown once they have been swapped in.
+     * @return Number of textures queued for compression
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Textures")
+    int32 CompressImportedTextures();
+
+    /**
+     * Checks whether imported textures are currently being compressed
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Textures")
+    bool IsTextureCompressionInProgress() const;
+
+    // Texture Streaming - Getters/Setters
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Textures")
+    bool GetTextureStreamingEnabled() const { return bEnableTextureStreaming; }
+
+    /**
+     * Enables or disables mip streaming; when disabled, textures keep the mips they currently have resident
+     */
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Textures")
+    void SetTextureStreamingEnabled(bool bInEnabled);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Textures")
+    int32 GetTextureStreamingPoolSizeMB() const { return TextureStreamingPoolSizeMB; }
+
+    UFUNCTION(BlueprintCallable, Category = "Datasmith|Post Import|Textures")
+    void SetTextureStreamingPoolSizeMB(int32 InPoolSizeMB);
+
+    /**
+     * Gets the memory used by resident mips of streamed imported textures
+     * @return Resident size in megabytes
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Post Import|Textures")
+    float GetStreamedTextureMemoryMB() const;
+
 private:
     /**
      * Validates that all required components and references are valid
@@ -215,4 +1048,219 @@ private:
      * Logs current configuration state for debugging purposes
      */
     void LogCurrentConfiguration() const;
+
+    /**
+     * Sets up the DirectLink proxy, the runtime actor and import monitoring, run from BeginPlay or the frame after
+     */
+    void InitializeServices();
+
+    // === Sync Node ===
+
+    /**
+     * Connects to the DirectLink source when the sync node is not connected yet
+     */
+    void TickSyncNodeConnection();
+
+    // === Import Monitoring ===
+
+    /**
+     * Polls the runtime actor and detects the start and completion of imports
+     */
+    void PollImportState();
+
+    /**
+     * Ends the trace region of the current import phase and begins the next one
+     * @param Phase Name of the phase, nullptr once the import or update has been applied
+     */
+    void SetImportPhase(const TCHAR* Phase);
+
+    /**
+     * Records the per-frame import counters of the CSV profiler
+     */
+    bool RecordCsvStats(float DeltaTime);
+
+    /**
+     * Rebuilds the view filter from the current rules, hands it to the runtime actor and applies it
+     * when no import is running; reimports when elements dropped by the previous rules may pass now
+     */
+    void OnViewFiltersChanged();
+
+    /**
+     * Called by the import option setters, schedules a restart when an import is in flight
+     */
+    void OnImportSettingsChanged();
+
+    /**
+     * Restarts the import once option changes have settled
+     */
+    void OnImportRestartTimer();
+
+    /**
+     * Called once when the runtime actor starts receiving or building a scene, from the manager's tick
+     * before the runtime actor's own tick applies it; undoes the passes the importer must not see
+     */
+    void HandleImportStarted();
+
+    /**
+     * Called by the runtime actor once an update has been received and before it is applied,
+     * demotes the promoted components the update touches
+     */
+    void HandleUpdateReceived(const FDSDatasmithUpdate& Update);
+
+    /**
+     * Called once when the runtime actor has finished building the scene, runs post-import passes
+     */
+    void HandleImportCompleted();
+
+    /**
+     * Collects the primitive components created by the Datasmith runtime actor
+     * @param OutPrimitives Receives the imported primitive components
+     */
+    void GatherImportedPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+    /**
+     * Runs the passes that depend on final mesh data once mesh optimization has finished
+     */
+    void FinishMeshPasses();
+
+    // === Double Buffered Reimport ===
+
+    /**
+     * Shows the back buffer and retires the previous scene, no-op unless a reimport was built off screen
+     */
+    void SwapImportBuffers();
+
+    /**
+     * Queues a runtime actor for destruction over the next frames
+     */
+    void RetireDatasmithActor(ADatasmithRuntimeActor* RuntimeActor);
+
+    /**
+     * Destroys retired components within the per-frame budget
+     */
+    void TickDeferredDestroy();
+
+    // === GC Clustering ===
+
+    /**
+     * Dissolves a cluster so its objects can change or be collected individually, and releases its root
+     */
+    void ReleaseImportCluster(TObjectPtr<UDSImportCluster>& Cluster);
+
+    // === Element Picking ===
+
+    /**
+     * Gets the element picker, building it over the components currently on screen if needed
+     */
+    FDSElementPicker& GetElementPicker();
+
+    // === Mesh Optimization ===
+
+    /**
+     * Writes the optimized meshes back once every task has finished
+     */
+    void PollMeshOptimization();
+
+    /**
+     * Cancels a running mesh optimization without applying its results
+     */
+    void CancelMeshOptimization();
+
+    /**
+     * Gets the mesh worker pool, creating it with the current settings on first use
+     * @return Nullptr if worker processes cannot be used, meshes are then optimized in process
+     */
+    FDSMeshWorkerPool* GetMeshWorkerPool();
+
+    /**
+     * Drops the worker pool so it is recreated with new settings; a busy pool is dropped by the import monitor once idle
+     */
+    void ResetIdleMeshWorkerPool();
+
+    // === Tessellation Prediction ===
+
+    /**
+     * Snapshots a sample of the imported meshes as the baseline of predictions
+     * @return False if no imported mesh can be sampled
+     */
+    bool StartTessellationPredictor();
+
+    /**
+     * Drops the predictor, its samples no longer match the scene once an import starts
+     */
+    void CancelTessellationPrediction();
+
+    // === Task Scheduling ===
+
+    /**
+     * Gets the scheduler for post-import work, creating it with the current settings on first use
+     */
+    FDSTaskScheduler& GetTaskScheduler();
+
+    /**
+     * Drops the scheduler so it is recreated with new settings; a busy scheduler is dropped by the import monitor once idle
+     */
+    void ResetIdleTaskScheduler();
+
+    // === Shader/PSO Precompilation ===
+
+    /**
+     * Requests pipeline states for the imported materials and waits for them before revealing the scene
+     */
+    void StartPSOPrecache();
+
+    /**
+     * Reveals the scene once all requested pipeline states have compiled or the timeout elapsed
+     */
+    void PollPSOPrecache();
+
+    /**
+     * Shows the imported scene again and persists newly recorded pipeline states
+     */
+    void RevealImportedScene();
+
+    // === Texture Compression ===
+
+    /**
+     * Swaps in the compressed textures once every background job has finished
+     */
+    void PollTextureCompression();
+
+    /**
+     * Cancels a running compression pass without applying its results
+     */
+    void CancelTextureCompression();
+
+    /**
+     * Streams mips of imported textures in or out for the current camera
+     */
+    void UpdateTextureStreaming();
+
+    /**
+     * Builds the streamer settings from the current properties
+     */
+    FDSTextureStreamingSettings CreateTextureStreamingSettings() const;
+
+    // === Precomputed Visibility ===
+
+    /**
+     * Receives the grid built on the background thread and starts runtime culling
+     * @param InBuildGeneration Generation the build was started with, older ones are stale
+     */
+    void OnVisibilityGridReady(TSharedPtr<FDSVisibilityGrid, ESPMode::ThreadSafe> InGrid, uint32 InBuildGeneration);
+
+    /**
+     * Looks up the pawn's cell and hides the component groups it cannot see
+     */
+    void UpdateVisibilityCulling();
+
+    /**
+     * Stops visibility culling and restores every component hidden by it
+     */
+    void ClearVisibilityCulling();
+
+    /**
+     * Gets the cache file used for a given scene layout
+     */
+    FString GetVisibilityCachePath(uint32 SceneHash) const;
 };
\ No newline at end of file
@@ -0,0 +1,536 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSConsoleCommands.h"
+#include "../Actors/DSRuntimeManager.h"
+#include "../Actors/DSLightSyncer.h"
+#include "../Runtime/DSLightParserBenchmark.h"
+#include "../Runtime/DSStartupTimeline.h"
+#include "HAL/IConsoleManager.h"
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+// Logging category for the console commands
+DEFINE_LOG_CATEGORY_STATIC(LogDSConsoleCommands, Log, All);
+
+namespace DSConsoleCommands
+{
+    using FHandler = void(*)(const TArray<FString>& Args, UWorld* World);
+
+    struct FQueuedCommand
+    {
+        FString Name;
+        FHandler Handler = nullptr;
+        TArray<FString> Args;
+        TWeakObjectPtr<UWorld> World;
+    };
+
+    /** Commands issued during startup or while waiting for idle, run in order once the scene has settled */
+    static TArray<FQueuedCommand> QueuedCommands;
+
+    /** Startup wait state, -ExecCmds runs before the runtime manager has initialized */
+    static FTSTicker::FDelegateHandle StartupTickerHandle;
+    static double StartupWaitStartTime = 0.0;
+    static constexpr double StartupTimeoutSeconds = 120.0;
+
+    /** Import count ds.WaitForIdle waits for after a connect or restart, INDEX_NONE when none is expected */
+    static int32 ExpectedImportsCompleted = INDEX_NONE;
+
+    /** Wait state of ds.WaitForIdle, the ticker handle is valid while waiting */
+    static FTSTicker::FDelegateHandle WaitTickerHandle;
+    static TWeakObjectPtr<UWorld> WaitWorld;
+    static double WaitStartTime = 0.0;
+    static double WaitTimeoutSeconds = 0.0;
+    static double WaitSettleSeconds = 0.0;
+    static double IdleSinceTime = 0.0;
+
+    static ADSRuntimeManager* FindRuntimeManager(UWorld* World, bool bWarnIfMissing = true)
+    {
+        if (!IsValid(World))
+        {
+            return nullptr;
+        }
+
+        TActorIterator<ADSRuntimeManager> It(World);
+        if (!It)
+        {
+            UE_CLOG(bWarnIfMissing, LogDSConsoleCommands, Warning, TEXT("No DSRuntimeManager in the world"));
+            return nullptr;
+        }
+        return *It;
+    }
+
+    static ADSLightSyncer* FindLightSyncer(UWorld* World, bool bWarnIfMissing = true)
+    {
+        if (!IsValid(World))
+        {
+            return nullptr;
+        }
+
+        TActorIterator<ADSLightSyncer> It(World);
+        if (!It)
+        {
+            UE_CLOG(bWarnIfMissing, LogDSConsoleCommands, Warning, TEXT("No DSLightSyncer in the world"));
+            return nullptr;
+        }
+        return *It;
+    }
+
+    static bool ParseBool(const FString& Value)
+    {
+        return Value.ToBool() || Value.Equals(TEXT("on"), ESearchCase::IgnoreCase);
+    }
+
+    /**
+     * Joins the arguments from the given index, for values that may contain spaces
+     */
+    static FString JoinArgs(const TArray<FString>& Args, int32 FirstIndex)
+    {
+        FString Joined;
+        for (int32 ArgIndex = FirstIndex; ArgIndex < Args.Num(); ++ArgIndex)
+        {
+            Joined += (ArgIndex > FirstIndex ? TEXT(" ") : TEXT("")) + Args[ArgIndex];
+        }
+        return Joined;
+    }
+
+    template <typename EnumType>
+    static bool ParseEnum(const FString& Value, EnumType& OutValue)
+    {
+        const int64 EnumValue = StaticEnum<EnumType>()->GetValueByNameString(Value);
+        if (EnumValue == INDEX_NONE)
+        {
+            UE_LOG(LogDSConsoleCommands, Warning, TEXT("'%s' is not a value of %s"), *Value, *StaticEnum<EnumType>()->GetName());
+            return false;
+        }
+
+        OutValue = (EnumType)EnumValue;
+        return true;
+    }
+
+    static void RunQueuedCommands();
+
+    /**
+     * Checks whether startup has finished and the runtime manager of the world has initialized
+     */
+    static bool IsReady(UWorld* World)
+    {
+        const ADSRuntimeManager* Manager = FindRuntimeManager(World, false);
+        return FDSStartupTimeline::IsFinished() && Manager && Manager->IsInitialized();
+    }
+
+    static bool TickWaitForStartup(float DeltaTime)
+    {
+        UWorld* World = QueuedCommands.Num() > 0 ? QueuedCommands[0].World.Get() : nullptr;
+        const bool bTimedOut = FPlatformTime::Seconds() - StartupWaitStartTime >= StartupTimeoutSeconds;
+        if (!IsReady(World) && !bTimedOut)
+        {
+            return true;
+        }
+
+        if (bTimedOut)
+        {
+            UE_LOG(LogDSConsoleCommands, Error, TEXT("Startup did not finish within %.0f s, running queued commands anyway"), StartupTimeoutSeconds);
+        }
+
+        StartupTickerHandle.Reset();
+        RunQueuedCommands();
+        return false;
+    }
+
+    static bool TickWaitForIdle(float DeltaTime)
+    {
+        const double Now = FPlatformTime::Seconds();
+        ADSRuntimeManager* Manager = WaitWorld.IsValid() ? FindRuntimeManager(WaitWorld.Get(), false) : nullptr;
+        ADSLightSyncer* LightSyncer = WaitWorld.IsValid() ? FindLightSyncer(WaitWorld.Get(), false) : nullptr;
+
+        // A manager that does not exist or has not initialized yet has not imported anything, it is not idle.
+        // After a connect or restart the import has to complete first, the scene is idle until it starts arriving.
+        const bool bImportsDone = Manager && (ExpectedImportsCompleted == INDEX_NONE || Manager->GetNumImportsCompleted() >= ExpectedImportsCompleted);
+        const bool bIdle = bImportsDone && Manager->IsInitialized() && Manager->IsIdle()
+            && (!LightSyncer || !LightSyncer->IsReplayingCapture());
+        if (!bIdle)
+        {
+            IdleSinceTime = 0.0;
+        }
+        else if (IdleSinceTime <= 0.0)
+        {
+            IdleSinceTime = Now;
+        }
+
+        const bool bSettled = bIdle && Now - IdleSinceTime >= WaitSettleSeconds;
+        const bool bTimedOut = WaitTimeoutSeconds > 0.0 && Now - WaitStartTime >= WaitTimeoutSeconds;
+        if (!bSettled && !bTimedOut)
+        {
+            return true;
+        }
+
+        if (bSettled)
+        {
+            ExpectedImportsCompleted = INDEX_NONE;
+            UE_LOG(LogDSConsoleCommands, Log, TEXT("ds.WaitForIdle: idle after %.2f s"), IdleSinceTime - WaitStartTime);
+        }
+        else
+        {
+            UE_LOG(LogDSConsoleCommands, Error, TEXT("ds.WaitForIdle: timed out after %.0f s, continuing"), WaitTimeoutSeconds);
+        }
+
+        WaitTickerHandle.Reset();
+        RunQueuedCommands();
+        return false;
+    }
+
+    static void RunQueuedCommands()
+    {
+        while (QueuedCommands.Num() > 0 && !WaitTickerHandle.IsValid() && !StartupTickerHandle.IsValid())
+        {
+            FQueuedCommand Command = QueuedCommands[0];
+            QueuedCommands.RemoveAt(0);
+
+            UE_LOG(LogDSConsoleCommands, Log, TEXT("Running queued %s"), *Command.Name);
+            Command.Handler(Command.Args, Command.World.Get());
+        }
+    }
+
+    /**
+     * Runs a command right away, or queues it until startup has finished or while ds.WaitForIdle is waiting
+     */
+    static void Dispatch(const TCHAR* Name, FHandler Handler, const TArray<FString>& Args, UWorld* World)
+    {
+        if (!StartupTickerHandle.IsValid() && QueuedCommands.Num() == 0 && !IsReady(World))
+        {
+            StartupWaitStartTime = FPlatformTime::Seconds();
+            StartupTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickWaitForStartup));
+        }
+
+        if (WaitTickerHandle.IsValid() || StartupTickerHandle.IsValid())
+        {
+            QueuedCommands.Add({ Name, Handler, Args, World });
+            UE_LOG(LogDSConsoleCommands, Verbose, TEXT("Queued %s until %s"), Name, StartupTickerHandle.IsValid() ? TEXT("startup has finished") : TEXT("idle"));
+            return;
+        }
+
+        Handler(Args, World);
+    }
+
+    // === Import ===
+
+    static void ImportSet(const TArray<FString>& Args, UWorld* World)
+    {
+        ADSRuntimeManager* Manager = FindRuntimeManager(World);
+        if (!Manager)
+        {
+            return;
+        }
+
+        if (Args.Num() < 2)
+        {
+            UE_LOG(LogDSConsoleCommands, Warning, TEXT("Usage: ds.Import.Set <ChordTolerance|MaxEdgeLength|NormalTolerance|StitchingTechnique|HierarchyMethod|CollisionEnabled|CollisionTraceFlag|ImportMetadata|SourceIndex|ViewIncludeFilters|ViewExcludeFilters> <Value>"));
+            return;
+        }
+
+        const FString& Option = Args[0];
+        const FString Value = JoinArgs(Args, 1);
+
+        if (Option == TEXT("ChordTolerance"))
+        {
+            Manager->SetChordTolerance(FCString::Atof(*Value));
+        }
+        else if (Option == TEXT("MaxEdgeLength"))
+        {
+            Manager->SetMaxEdgeLength(FCString::Atof(*Value));
+        }
+        else if (Option == TEXT("NormalTolerance"))
+        {
+            Manager->SetNormalTolerance(FCString::Atof(*Value));
+        }
+        else if (Option == TEXT("StitchingTechnique"))
+        {
+            EDatasmithCADStitchingTechnique StitchingTechnique;
+            if (ParseEnum(Value, StitchingTechnique))
+            {
+                Manager->SetStitchingTechnique(StitchingTechnique);
+            }
+        }
+        else if (Option == TEXT("HierarchyMethod"))
+        {
+            EBuildHierarchyMethod HierarchyMethod;
+            if (ParseEnum(Value, HierarchyMethod))
+            {
+                Manager->SetHierarchyMethod(HierarchyMethod);
+            }
+        }
+        else if (Option == TEXT("CollisionEnabled"))
+        {
+            ECollisionEnabled::Type CollisionEnabled;
+            if (ParseEnum(Value, CollisionEnabled))
+            {
+                Manager->SetCollisionEnabled(CollisionEnabled);
+            }
+        }
+        else if (Option == TEXT("CollisionTraceFlag"))
+        {
+            ECollisionTraceFlag CollisionTraceFlag;
+            if (ParseEnum(Value, CollisionTraceFlag))
+            {
+                Manager->SetCollisionTraceFlag(CollisionTraceFlag);
+            }
+        }
+        else if (Option == TEXT("ImportMetadata"))
+        {
+            Manager->SetImportMetadata(ParseBool(Value));
+        }
+        else if (Option == TEXT("SourceIndex"))
+        {
+            Manager->SetDirectLinkSourceIndex(FCString::Atoi(*Value));
+        }
+        else if (Option == TEXT("ViewIncludeFilters") || Option == TEXT("ViewExcludeFilters"))
+        {
+            // Rules are separated by semicolons, -ExecCmds already splits commands at commas
+            TArray<FString> Filters;
+            Value.ParseIntoArray(Filters, TEXT(";"));
+            if (Option == TEXT("ViewIncludeFilters"))
+            {
+                Manager->SetViewIncludeFilters(Filters);
+            }
+            else
+            {
+                Manager->SetViewExcludeFilters(Filters);
+            }
+        }
+        else
+        {
+            UE_LOG(LogDSConsoleCommands, Warning, TEXT("Unknown import option '%s'"), *Option);
+            return;
+        }
+
+        UE_LOG(LogDSConsoleCommands, Log, TEXT("Set %s to %s"), *Option, *Value);
+    }
+
+    static void ImportConnect(const TArray<FString>& Args, UWorld* World)
+    {
+        if (ADSRuntimeManager* Manager = FindRuntimeManager(World))
+        {
+            if (Args.Num() > 0)
+            {
+                Manager->SetDirectLinkSourceIndex(FCString::Atoi(*Args[0]));
+            }
+            if (Manager->UpdateDirectLinkConnection())
+            {
+                ExpectedImportsCompleted = Manager->GetNumImportsCompleted() + 1;
+            }
+        }
+    }
+
+    static void ImportRestart(const TArray<FString>& Args, UWorld* World)
+    {
+        if (ADSRuntimeManager* Manager = FindRuntimeManager(World))
+        {
+            if (Manager->RestartImport())
+            {
+                ExpectedImportsCompleted = Manager->GetNumImportsCompleted() + 1;
+            }
+        }
+    }
+
+    static void ImportAnalyze(const TArray<FString>& Args, UWorld* World)
+    {
+        if (ADSRuntimeManager* Manager = FindRuntimeManager(World))
+        {
+            Manager->AnalyzeSceneCost();
+        }
+    }
+
+    // === Garbage Collection ===
+
+    static void GCMeasure(const TArray<FString>& Args, UWorld* World)
+    {
+        if (ADSRuntimeManager* Manager = FindRuntimeManager(World))
+        {
+            // Switching clustering builds or dissolves the cluster of the current scene before the collection is timed
+            if (Args.Num() > 0)
+            {
+                Manager->SetClusterImportedAssets(ParseBool(Args[0]));
+            }
+            Manager->MeasureGCPause();
+        }
+    }
+
+    // === Light Sync ===
+
+    static void LightListen(const TArray<FString>& Args, UWorld* World)
+    {
+        if (ADSLightSyncer* LightSyncer = FindLightSyncer(World))
+        {
+            if (Args.Num() > 0)
+            {
+                LightSyncer->ListeningPort = FCString::Atoi(*Args[0]);
+            }
+            LightSyncer->StartTcpListener();
+        }
+    }
+
+    static void LightStopListening(const TArray<FString>& Args, UWorld* World)
+    {
+        if (ADSLightSyncer* LightSyncer = FindLightSyncer(World))
+        {
+            LightSyncer->StopTcpListener();
+        }
+    }
+
+    static void LightClear(const TArray<FString>& Args, UWorld* World)
+    {
+        if (ADSLightSyncer* LightSyncer = FindLightSyncer(World))
+        {
+            LightSyncer->ClearExistingLights();
+        }
+    }
+
+    static void LightLoadFile(const TArray<FString>& Args, UWorld* World)
+    {
+        if (ADSLightSyncer* LightSyncer = FindLightSyncer(World))
+        {
+            LightSyncer->LoadAndSpawnLights();
+        }
+    }
+
+    static void LightRecord(const TArray<FString>& Args, UWorld* World)
+    {
+        if (Args.Num() < 1)
+        {
+            UE_LOG(LogDSConsoleCommands, Warning, TEXT("Usage: ds.Light.Record <CaptureFile>"));
+            return;
+        }
+
+        if (ADSLightSyncer* LightSyncer = FindLightSyncer(World))
+        {
+            LightSyncer->StartCapture(JoinArgs(Args, 0));
+        }
+    }
+
+    static void LightStopRecording(const TArray<FString>& Args, UWorld* World)
+    {
+        if (ADSLightSyncer* LightSyncer = FindLightSyncer(World))
+        {
+            LightSyncer->StopCapture();
+        }
+    }
+
+    static void LightReplay(const TArray<FString>& Args, UWorld* World)
+    {
+        if (Args.Num() < 1)
+        {
+            UE_LOG(LogDSConsoleCommands, Warning, TEXT("Usage: ds.Light.Replay <CaptureFile> [fast]"));
+            return;
+        }
+
+        if (ADSLightSyncer* LightSyncer = FindLightSyncer(World))
+        {
+            const bool bFast = Args.Num() > 1 && Args.Last().Equals(TEXT("fast"), ESearchCase::IgnoreCase);
+            LightSyncer->ReplayCapture(bFast ? JoinArgs(Args, 0).LeftChop(5) : JoinArgs(Args, 0), !bFast);
+        }
+    }
+
+    // === Scenario Control ===
+
+    static void Stats(const TArray<FString>& Args, UWorld* World)
+    {
+        if (ADSRuntimeManager* Manager = FindRuntimeManager(World))
+        {
+            Manager->LogStats();
+        }
+
+        if (ADSLightSyncer* LightSyncer = FindLightSyncer(World))
+        {
+            UE_LOG(LogDSConsoleCommands, Log, TEXT("Light Syncer: %d lights, listening %s, replaying %s"), LightSyncer->GetNumSpawnedLights(),
+                   LightSyncer->IsListening() ? TEXT("true") : TEXT("false"), LightSyncer->IsReplayingCapture() ? TEXT("true") : TEXT("false"));
+        }
+    }
+
+    static void BenchLightParser(const TArray<FString>& Args, UWorld* World)
+    {
+        FDSLightParserBenchmarkSettings Settings;
+        if (Args.Num() > 0)
+        {
+            Settings.NumLights = FCString::Atoi(*Args[0]);
+        }
+        if (Args.Num() > 1)
+        {
+            Settings.NumIterations = FCString::Atoi(*Args[1]);
+        }
+
+        FDSLightParserBenchmark::LogResults(FDSLightParserBenchmark::Run(Settings));
+    }
+
+    static void WaitForIdle(const TArray<FString>& Args, UWorld* World)
+    {
+        WaitWorld = World;
+        WaitStartTime = FPlatformTime::Seconds();
+        WaitTimeoutSeconds = Args.Num() > 0 ? FCString::Atod(*Args[0]) : 600.0;
+        WaitSettleSeconds = Args.Num() > 1 ? FCString::Atod(*Args[1]) : 1.0;
+        IdleSinceTime = 0.0;
+
+        // Imports are detected by polling, so the scene has to stay idle for a while to count as settled.
+        // Waiting after ds.Import.Connect also holds until the connected scene has been imported.
+        WaitTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickWaitForIdle));
+        UE_LOG(LogDSConsoleCommands, Log, TEXT("ds.WaitForIdle: waiting up to %.0f s for %.1f s of idle"), WaitTimeoutSeconds, WaitSettleSeconds);
+    }
+
+    static void Exec(const TArray<FString>& Args, UWorld* World)
+    {
+        const FString Command = JoinArgs(Args, 0);
+        if (!Command.IsEmpty() && GEngine)
+        {
+            GEngine->Exec(World, *Command);
+        }
+    }
+
+    /**
+     * Registers a command whose handler goes through Dispatch
+     */
+#define DS_CONSOLE_COMMAND(VariableName, CommandName, Help, Handler) \
+    static FAutoConsoleCommandWithWorldAndArgs VariableName(TEXT(CommandName), TEXT(Help), \
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World) \
+        { \
+            Dispatch(TEXT(CommandName), &Handler, Args, World); \
+        }))
+
+    DS_CONSOLE_COMMAND(ImportSetCommand, "ds.Import.Set", "Sets an import option: ds.Import.Set <Option> <Value>. View filter rules are separated by semicolons.", ImportSet);
+    DS_CONSOLE_COMMAND(ImportConnectCommand, "ds.Import.Connect", "Connects to a DirectLink source and starts importing: ds.Import.Connect [SourceIndex]", ImportConnect);
+    DS_CONSOLE_COMMAND(ImportRestartCommand, "ds.Import.Restart", "Restarts the import with the current options", ImportRestart);
+    DS_CONSOLE_COMMAND(ImportAnalyzeCommand, "ds.Import.Analyze", "Ranks the heaviest contributors of the imported scene and writes Saved/DatasmithTest/SceneCost.json", ImportAnalyze);
+    DS_CONSOLE_COMMAND(GCMeasureCommand, "ds.GC.Measure", "Times a full garbage collection, optionally after switching clustering of the imported assets: ds.GC.Measure [Cluster=on|off]", GCMeasure);
+    DS_CONSOLE_COMMAND(LightListenCommand, "ds.Light.Listen", "Starts the light sync listener: ds.Light.Listen [Port]", LightListen);
+    DS_CONSOLE_COMMAND(LightStopListeningCommand, "ds.Light.StopListening", "Stops the light sync listener", LightStopListening);
+    DS_CONSOLE_COMMAND(LightClearCommand, "ds.Light.Clear", "Destroys all synced lights", LightClear);
+    DS_CONSOLE_COMMAND(LightLoadFileCommand, "ds.Light.LoadFile", "Spawns the lights of the light sync file", LightLoadFile);
+    DS_CONSOLE_COMMAND(LightRecordCommand, "ds.Light.Record", "Records received light events to a capture file: ds.Light.Record <CaptureFile>", LightRecord);
+    DS_CONSOLE_COMMAND(LightStopRecordingCommand, "ds.Light.StopRecording", "Stops recording light events", LightStopRecording);
+    DS_CONSOLE_COMMAND(LightReplayCommand, "ds.Light.Replay", "Replays a light capture, with recorded timing or one event per frame: ds.Light.Replay <CaptureFile> [fast]", LightReplay);
+    DS_CONSOLE_COMMAND(StatsCommand, "ds.Stats", "Logs the state of the import, the post-import passes and the light syncer", Stats);
+    DS_CONSOLE_COMMAND(BenchLightParserCommand, "ds.Bench.LightParser", "Benchmarks the light sync parsers: ds.Bench.LightParser [Lights=64] [Iterations=200]", BenchLightParser);
+    DS_CONSOLE_COMMAND(WaitForIdleCommand, "ds.WaitForIdle", "Holds back later ds.* commands until nothing is importing or processing: ds.WaitForIdle [TimeoutSeconds=600] [SettleSeconds=1]", WaitForIdle);
+    DS_CONSOLE_COMMAND(ExecCommand, "ds.Exec", "Runs any console command, after ds.WaitForIdle has finished when it is waiting: ds.Exec <Command>", Exec);
+
+#undef DS_CONSOLE_COMMAND
+}
+
+bool FDSConsoleCommands::IsWaitingForIdle()
+{
+    return DSConsoleCommands::WaitTickerHandle.IsValid();
+}
+
+int32 FDSConsoleCommands::GetNumQueuedCommands()
+{
+    return DSConsoleCommands::QueuedCommands.Num();
+}
@@ -0,0 +1,43 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FDSConsoleCommands - ds.* console commands that drive the runtime manager and the light syncer
+ *
+ * Everything the widget can do is reachable from the console, -ExecCmds and automation, so perf
+ * runs can script a whole scenario. ds.WaitForIdle holds back every ds.* command issued after
+ * it until imports and post-import passes have settled; other console commands can be held back
+ * too by wrapping them in ds.Exec, e.g.
+ *   -ExecCmds="ds.Import.Connect 0, ds.WaitForIdle 600, ds.Stats, ds.Exec quit"
+ *
+ * Commands issued before startup has finished and the runtime manager has initialized, as
+ * -ExecCmds are, are queued until then. After ds.Import.Connect or ds.Import.Restart,
+ * ds.WaitForIdle also waits for that import to complete.
+ *
+ * The commands register themselves when the module loads. Run "help ds." for the full list.
+ */
+class DATASMITHTEST_API FDSConsoleCommands
+{
+public:
+    /**
+     * Checks whether ds.WaitForIdle is holding back commands
+     */
+    static bool IsWaitingForIdle();
+
+    /**
+     * Gets the number of commands held back until the scene is idle
+     */
+    static int32 GetNumQueuedCommands();
+};
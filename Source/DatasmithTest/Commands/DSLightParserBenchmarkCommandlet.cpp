@@ -0,0 +1,32 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSLightParserBenchmarkCommandlet.h"
+#include "../Runtime/DSLightParserBenchmark.h"
+#include "Misc/Parse.h"
+
+UDSLightParserBenchmarkCommandlet::UDSLightParserBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UDSLightParserBenchmarkCommandlet::Main(const FString& Params)
+{
+    FDSLightParserBenchmarkSettings Settings;
+    FParse::Value(*Params, TEXT("Lights="), Settings.NumLights);
+    FParse::Value(*Params, TEXT("Iterations="), Settings.NumIterations);
+
+    FDSLightParserBenchmark::LogResults(FDSLightParserBenchmark::Run(Settings));
+    return 0;
+}
@@ -0,0 +1,32 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DSLightParserBenchmarkCommandlet.generated.h"
+
+/**
+ * UDSLightParserBenchmarkCommandlet - Runs the light parser benchmark without loading a map
+ *
+ * Usage: UnrealEditor-Cmd DatasmithTest.uproject -run=DSLightParserBenchmark [-Lights=64] [-Iterations=200]
+ */
+UCLASS()
+class DATASMITHTEST_API UDSLightParserBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UDSLightParserBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,117 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSMockDirectLinkSourceCommandlet.h"
+#include "../Runtime/DSMockDirectLinkSource.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/Parse.h"
+
+// Logging category for the mock DirectLink source commandlet
+DEFINE_LOG_CATEGORY_STATIC(LogDSMockDirectLinkSourceCommandlet, Log, All);
+
+namespace DSMockDirectLinkSourceCommandlet
+{
+    /**
+     * Keeps the message bus and tickers running until the given time
+     */
+    static void PumpUntil(double EndTime)
+    {
+        double LastTime = FPlatformTime::Seconds();
+        while (FPlatformTime::Seconds() < EndTime && !IsEngineExitRequested())
+        {
+            const double Now = FPlatformTime::Seconds();
+            FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+            FTSTicker::GetCoreTicker().Tick((float)(Now - LastTime));
+            LastTime = Now;
+
+            FPlatformProcess::Sleep(FMath::Clamp((float)(EndTime - Now), 0.0f, 0.01f));
+        }
+    }
+}
+
+UDSMockDirectLinkSourceCommandlet::UDSMockDirectLinkSourceCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UDSMockDirectLinkSourceCommandlet::Main(const FString& Params)
+{
+    FString ScenePath;
+    if (!FParse::Value(*Params, TEXT("Scene="), ScenePath))
+    {
+        UE_LOG(LogDSMockDirectLinkSourceCommandlet, Error, TEXT("Missing -Scene=<File.udatasmith>"));
+        return 1;
+    }
+
+    TArray<FDSMockEditStep> Steps;
+    FString ScriptPath;
+    if (FParse::Value(*Params, TEXT("Script="), ScriptPath))
+    {
+        if (!FDSMockDirectLinkSource::LoadScript(ScriptPath, Steps))
+        {
+            return 1;
+        }
+    }
+    else
+    {
+        int32 NumUpdates = 10;
+        double Interval = 1.0;
+        int32 Counts[4] = { 100, 0, 0, 0 };
+        FParse::Value(*Params, TEXT("Updates="), NumUpdates);
+        FParse::Value(*Params, TEXT("Interval="), Interval);
+        FParse::Value(*Params, TEXT("Move="), Counts[(int32)EDSMockEditType::Move]);
+        FParse::Value(*Params, TEXT("Add="), Counts[(int32)EDSMockEditType::Add]);
+        FParse::Value(*Params, TEXT("Delete="), Counts[(int32)EDSMockEditType::Delete]);
+        FParse::Value(*Params, TEXT("Material="), Counts[(int32)EDSMockEditType::Material]);
+        Steps = FDSMockDirectLinkSource::MakeRateScript(NumUpdates, Interval, Counts);
+    }
+
+    double StartDelay = 10.0;
+    double Linger = 5.0;
+    FParse::Value(*Params, TEXT("StartDelay="), StartDelay);
+    FParse::Value(*Params, TEXT("Linger="), Linger);
+
+    FDSMockDirectLinkSource Source;
+    int32 Seed = 1;
+    if (FParse::Value(*Params, TEXT("Seed="), Seed))
+    {
+        Source.SetSeed(Seed);
+    }
+
+    if (!Source.Open(ScenePath))
+    {
+        return 1;
+    }
+
+    const double ScriptStartTime = FPlatformTime::Seconds() + StartDelay;
+    UE_LOG(LogDSMockDirectLinkSourceCommandlet, Log, TEXT("Waiting %.0f s for receivers, then sending %d updates"), StartDelay, Steps.Num());
+
+    // Steps run at their scripted times; a step that falls behind runs right away and the next ones keep their schedule
+    for (const FDSMockEditStep& Step : Steps)
+    {
+        DSMockDirectLinkSourceCommandlet::PumpUntil(ScriptStartTime + Step.Time);
+        if (IsEngineExitRequested())
+        {
+            break;
+        }
+        Source.ApplyStep(Step);
+    }
+
+    DSMockDirectLinkSourceCommandlet::PumpUntil(FPlatformTime::Seconds() + Linger);
+
+    Source.GetReport().Log();
+    return 0;
+}
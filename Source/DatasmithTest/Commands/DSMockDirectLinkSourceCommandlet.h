@@ -0,0 +1,37 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DSMockDirectLinkSourceCommandlet.generated.h"
+
+/**
+ * UDSMockDirectLinkSourceCommandlet - Serves a scene as a DirectLink source and scripts edits to it
+ *
+ * Usage: UnrealEditor-Cmd DatasmithTest.uproject -run=DSMockDirectLinkSource -messaging -Scene=<File.udatasmith>
+ *        [-Script=<File>] | [-Updates=10 -Interval=1.0 -Move=100 -Add=0 -Delete=0 -Material=0]
+ *        [-StartDelay=10] [-Linger=5] [-Seed=1]
+ * The script starts StartDelay seconds after the scene is published, giving receivers time to
+ * connect; the source stays up Linger seconds after the last update. -messaging enables the
+ * UDP message bus, which commandlets leave off by default.
+ */
+UCLASS()
+class DATASMITHTEST_API UDSMockDirectLinkSourceCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UDSMockDirectLinkSourceCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
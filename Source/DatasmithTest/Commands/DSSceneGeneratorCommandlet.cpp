@@ -0,0 +1,50 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSSceneGeneratorCommandlet.h"
+#include "../Runtime/DSSceneGenerator.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+UDSSceneGeneratorCommandlet::UDSSceneGeneratorCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UDSSceneGeneratorCommandlet::Main(const FString& Params)
+{
+    FDSSceneGeneratorSettings Settings;
+    FParse::Value(*Params, TEXT("Name="), Settings.SceneName);
+    FParse::Value(*Params, TEXT("Elements="), Settings.NumElements);
+    FParse::Value(*Params, TEXT("InstancingRatio="), Settings.InstancingRatio);
+    FParse::Value(*Params, TEXT("Depth="), Settings.HierarchyDepth);
+    FParse::Value(*Params, TEXT("Materials="), Settings.NumMaterials);
+    FParse::Value(*Params, TEXT("Metadata="), Settings.MetadataPerElement);
+    FParse::Value(*Params, TEXT("Lights="), Settings.NumLights);
+    FParse::Value(*Params, TEXT("LightEvents="), Settings.NumLightEvents);
+    FParse::Value(*Params, TEXT("LightInterval="), Settings.LightEventInterval);
+    FParse::Value(*Params, TEXT("Seed="), Settings.Seed);
+
+    FString OutputDirectory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("DatasmithTest"), TEXT("Synthetic"));
+    FParse::Value(*Params, TEXT("Output="), OutputDirectory);
+
+    FDSSceneGeneratorReport Report;
+    if (!FDSSceneGenerator::Generate(Settings, OutputDirectory, Report))
+    {
+        return 1;
+    }
+
+    Report.Log();
+    return 0;
+}
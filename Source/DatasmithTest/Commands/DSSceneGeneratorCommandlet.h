@@ -0,0 +1,35 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DSSceneGeneratorCommandlet.generated.h"
+
+/**
+ * UDSSceneGeneratorCommandlet - Writes a synthetic Datasmith scene and its light sync payloads
+ *
+ * Usage: UnrealEditor-Cmd DatasmithTest.uproject -run=DSSceneGenerator [-Output=<Dir>] [-Name=Synthetic]
+ *        [-Elements=1000] [-InstancingRatio=0.9] [-Depth=3] [-Materials=16] [-Metadata=4]
+ *        [-Lights=16] [-LightEvents=20] [-LightInterval=0.5] [-Seed=1]
+ * Output defaults to Saved/DatasmithTest/Synthetic.
+ */
+UCLASS()
+class DATASMITHTEST_API UDSSceneGeneratorCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UDSSceneGeneratorCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
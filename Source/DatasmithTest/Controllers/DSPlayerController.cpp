@@ -11,8 +11,15 @@
 // Contact: rudraojhaif@gmail.com for licensing inquiries.
 #include "DSPlayerController.h"
 #include "../Widgets/DSRuntimeWidget.h"
+#include "../Actors/DSRuntimeManager.h"
+#include "../Modes/DSGameMode.h"
 #include "Blueprint/UserWidget.h"
 #include "Engine/Engine.h"
+#include "EngineUtils.h"
+#include "Components/PrimitiveComponent.h"
+#include "DatasmithAssetUserData.h"
+#include "../Runtime/DSStartupTimeline.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 // Logging category for this player controller
 DEFINE_LOG_CATEGORY_STATIC(LogDSPlayerController, Log, All);
@@ -54,6 +61,9 @@ void ADSPlayerController::SetupInputComponent()
     {
         InputComponent->BindAction("Settings", IE_Pressed, this, &ADSPlayerController::OnToggleWidget);
         UE_LOG(LogDSPlayerController, Log, TEXT("Bound Settings action to toggle widget"));
+
+        InputComponent->BindAction("PickElement", IE_Pressed, this, &ADSPlayerController::OnPickElement);
+        UE_LOG(LogDSPlayerController, Log, TEXT("Bound PickElement action to element picking"));
     }
     else
     {
@@ -69,6 +79,12 @@ bool ADSPlayerController::EnsureWidgetExists()
         return true;
     }
 
+    // A sync node has no viewport to show it in
+    if (ADSGameMode::IsSyncNode())
+    {
+        return false;
+    }
+
     // No widget class specified
     if (!DSRuntimeWidgetClass)
     {
@@ -94,6 +110,55 @@ void ADSPlayerController::OnToggleWidget()
     }
 }
 
+void ADSPlayerController::OnPickElement()
+{
+    FVector2D ScreenPosition;
+    if (!bShowMouseCursor || !GetMousePosition(ScreenPosition.X, ScreenPosition.Y))
+    {
+        int32 ViewportSizeX = 0;
+        int32 ViewportSizeY = 0;
+        GetViewportSize(ViewportSizeX, ViewportSizeY);
+        ScreenPosition = FVector2D(ViewportSizeX * 0.5, ViewportSizeY * 0.5);
+    }
+
+    FVector RayOrigin;
+    FVector RayDirection;
+    if (!DeprojectScreenPositionToWorld(ScreenPosition.X, ScreenPosition.Y, RayOrigin, RayDirection))
+    {
+        return;
+    }
+
+    TActorIterator<ADSRuntimeManager> ManagerIt(GetWorld());
+    if (!ManagerIt)
+    {
+        UE_LOG(LogDSPlayerController, Verbose, TEXT("No DSRuntimeManager in the world, nothing to pick"));
+        return;
+    }
+
+    FVector HitLocation;
+    UPrimitiveComponent* Picked = ManagerIt->PickImportedElement(RayOrigin, RayDirection, PickMaxDistance, HitLocation);
+    if (!Picked)
+    {
+        UE_LOG(LogDSPlayerController, Verbose, TEXT("Pick hit no imported element"));
+        return;
+    }
+
+    UE_LOG(LogDSPlayerController, Log, TEXT("Picked %s at %s"), *Picked->GetName(), *HitLocation.ToCompactString());
+
+    // Metadata is attached to the imported element, which may be an ancestor of the picked component
+    for (const USceneComponent* Current = Picked; Current; Current = Current->GetAttachParent())
+    {
+        if (const UDatasmithAssetUserData* UserData = Current->GetAssetUserData<UDatasmithAssetUserData>())
+        {
+            for (const TPair<FName, FString>& Entry : UserData->MetaData)
+            {
+                UE_LOG(LogDSPlayerController, Log, TEXT("  %s = %s"), *Entry.Key.ToString(), *Entry.Value);
+            }
+            break;
+        }
+    }
+}
+
 bool ADSPlayerController::ShowDSRuntimeWidget()
 {
     if (!EnsureWidgetExists())
@@ -130,6 +195,8 @@ void ADSPlayerController::ToggleDSRuntimeWidget()
 
 bool ADSPlayerController::CreateDSRuntimeWidget()
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(ADSPlayerController::CreateDSRuntimeWidget);
+
     // Destroy existing widget first
     if (IsValid(DSRuntimeWidgetInstance))
     {
@@ -156,6 +223,7 @@ bool ADSPlayerController::CreateDSRuntimeWidget()
     DSRuntimeWidgetInstance->SetVisibility(ESlateVisibility::Hidden);
 
     UE_LOG(LogDSPlayerController, Log, TEXT("Successfully created DSRuntimeWidget"));
+    FDSStartupTimeline::Mark(TEXT("Runtime widget built"));
     return true;
 }
 
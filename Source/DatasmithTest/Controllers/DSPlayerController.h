@@ -28,7 +28,8 @@ class UDSRuntimeWidget;
  * 
  * Key Features:
  * - Escape key input action to toggle the configuration widget
- * - Automatic widget creation and management
+ * - Click to pick an imported element and log its metadata, without physics collision
+ * - Widget built on first use, so startup does not pay for it
  * - Proper input mode switching for UI interaction
  */
 UCLASS(BlueprintType, Blueprintable)
@@ -58,10 +59,16 @@ protected:
     TObjectPtr<UDSRuntimeWidget> DSRuntimeWidgetInstance;
 
     /**
-     * Whether to automatically create the widget on BeginPlay
+     * Whether to create the widget on BeginPlay instead of the first time it is shown
      */
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UI")
-    bool bAutoCreateWidget = true;
+    bool bAutoCreateWidget = false;
+
+    /**
+     * Maximum distance of imported elements picked by clicking
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Picking", meta = (ClampMin = "100.0"))
+    float PickMaxDistance = 1000000.0f;
 
 private:
     /**
@@ -79,6 +86,13 @@ public:
     UFUNCTION()
     void OnToggleWidget();
 
+    /**
+     * Called when the pick element input action is triggered (left mouse button pressed)
+     * Picks under the cursor when it is shown, at the screen center otherwise
+     */
+    UFUNCTION()
+    void OnPickElement();
+
     // === Widget Interface ===
 
     /**
@@ -20,7 +20,7 @@ public class DatasmithTest : ModuleRules
             "PhysicsCore"
         });
 
-        PrivateDependencyModuleNames.AddRange(new string[] {  });
+        PrivateDependencyModuleNames.AddRange(new string[] { "RenderCore", "RHI", "MeshDescription", "StaticMeshDescription", "DirectLink" });
 
 		// Uncomment if you are using Slate UI
 		PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
@@ -1,6 +1,33 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "DatasmithTest.h"
+#include "Runtime/DSMeshWorkerPool.h"
+#include "Runtime/DSStartupTimeline.h"
+#include "Misc/CoreDelegates.h"
 #include "Modules/ModuleManager.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, DatasmithTest, "DatasmithTest" );
+/**
+ * Game module; processes started as mesh workers run the worker loop instead of the game
+ */
+class FDatasmithTestModule : public FDefaultGameModuleImpl
+{
+public:
+    virtual void StartupModule() override
+    {
+        if (FDSMeshWorkerPool::IsWorkerProcess())
+        {
+            // Exits before the engine finishes starting, a worker needs neither a world nor a renderer
+            const int32 ExitCode = FDSMeshWorkerPool::RunWorker();
+            FPlatformMisc::RequestExitWithStatus(true, (uint8)ExitCode);
+            return;
+        }
+
+        FDSStartupTimeline::Mark(TEXT("Game module loaded"));
+        FCoreDelegates::OnFEngineLoopInitComplete.AddLambda([]()
+        {
+            FDSStartupTimeline::Mark(TEXT("Engine initialized"));
+        });
+    }
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FDatasmithTestModule, DatasmithTest, "DatasmithTest" );
@@ -16,6 +16,9 @@
 #include "Engine/World.h"
 #include "EngineUtils.h"
 #include "DatasmithTest/Actors/DSLightSyncer.h"
+#include "../Runtime/DSStartupTimeline.h"
+#include "TimerManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 // Logging category for this game mode
 DEFINE_LOG_CATEGORY_STATIC(LogDSGameMode, Log, All);
@@ -43,20 +46,78 @@ void ADSGameMode::BeginPlay()
     Super::BeginPlay();
 
     UE_LOG(LogDSGameMode, Log, TEXT("DSGameMode: BeginPlay started"));
+    FDSStartupTimeline::Mark(TEXT("Game mode BeginPlay"));
+
+    if (IsSyncNode())
+    {
+        UE_LOG(LogDSGameMode, Log, TEXT("DSGameMode: Running as headless sync node"));
+    }
+
+    if (bStaggerServiceSpawning)
+    {
+        // The map renders its first frame while the services come up one per frame
+        GetWorldTimerManager().SetTimerForNextTick(this, &ADSGameMode::SpawnRuntimeManagerStage);
+    }
+    else
+    {
+        SpawnRuntimeManagerStage();
+    }
+
+    UE_LOG(LogDSGameMode, Log, TEXT("DSGameMode: BeginPlay completed"));
+}
+
+void ADSGameMode::SpawnRuntimeManagerStage()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(ADSGameMode::SpawnRuntimeManagerStage);
 
     // Ensure a DSRuntimeManager exists in the world
     if (bAutoSpawnDSRuntimeManager)
     {
         EnsureDSRuntimeManagerExists();
+        FDSStartupTimeline::Mark(TEXT("Runtime manager spawned"));
+    }
+
+    // Before the manager's deferred initialization, so its first import already runs the sync node passes only
+    ADSRuntimeManager* Manager = GetDSRuntimeManager();
+    if (IsSyncNode() && IsValid(Manager))
+    {
+        Manager->EnterSyncNodeMode();
+    }
+
+    if (bStaggerServiceSpawning)
+    {
+        GetWorldTimerManager().SetTimerForNextTick(this, &ADSGameMode::SpawnLightSyncerStage);
+    }
+    else
+    {
+        SpawnLightSyncerStage();
     }
+}
+
+void ADSGameMode::SpawnLightSyncerStage()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(ADSGameMode::SpawnLightSyncerStage);
 
     // Ensure a DSLightSyncer exists in the world
     if (bAutoSpawnDSLightSyncer)
     {
         EnsureDSLightSyncerExists();
+        FDSStartupTimeline::Mark(TEXT("Light syncer spawned"));
     }
 
-    UE_LOG(LogDSGameMode, Log, TEXT("DSGameMode: BeginPlay completed"));
+    ADSLightSyncer* LightSyncer = GetDSLightSyncer();
+    if (IsSyncNode() && IsValid(LightSyncer))
+    {
+        LightSyncer->EnterSyncNodeMode();
+    }
+
+    // The runtime manager initializes on the frame after it is spawned, which is this one at the latest
+    GetWorldTimerManager().SetTimerForNextTick(this, &ADSGameMode::CompleteStartupStage);
+}
+
+void ADSGameMode::CompleteStartupStage()
+{
+    FDSStartupTimeline::Finish();
 }
 
 bool ADSGameMode::EnsureDSRuntimeManagerExists()
@@ -114,6 +175,11 @@ bool ADSGameMode::EnsureDSLightSyncerExists()
 }
 
 
+bool ADSGameMode::IsSyncNode()
+{
+    return FParse::Param(FCommandLine::Get(), TEXT("DSSyncNode")) || !FApp::CanEverRender();
+}
+
 ADSRuntimeManager* ADSGameMode::GetDSRuntimeManager() const
 {
     UWorld* World = GetWorld();
@@ -30,6 +30,14 @@ class ADSLightSyncer;
  * 
  * The game mode also automatically spawns a DSRuntimeManager instance
  * if one doesn't exist in the world when the game starts.
+ * 
+ * Services are spawned one per frame after BeginPlay, so the first frame of the map is
+ * not held up by them, and the startup timeline is logged once the last one is up.
+ * 
+ * Sync node mode runs the same services headless, as a cache warmer for interactive viewers:
+ * it receives DirectLink and light sync data and writes the visibility, texture and light
+ * caches to disk. It is enabled with -DSSyncNode or whenever the process cannot render, e.g.
+ *   DatasmithTest -DSSyncNode -nullrhi -unattended -nosound
  */
 UCLASS(BlueprintType, Blueprintable)
 class DATASMITHTEST_API ADSGameMode : public AGameModeBase
@@ -72,7 +80,29 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Datasmith")
     bool bAutoSpawnDSLightSyncer = true;
 
+    /**
+     * Whether to spawn the services on the frames after BeginPlay instead of during it
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Datasmith|Startup")
+    bool bStaggerServiceSpawning = true;
+
 private:
+    /**
+     * First startup stage, spawns the runtime manager and queues the next stage
+     */
+    void SpawnRuntimeManagerStage();
+
+    /**
+     * Second startup stage, spawns the light syncer and queues the next stage
+     */
+    void SpawnLightSyncerStage();
+
+    /**
+     * Last startup stage, runs once the services have initialized and logs the startup timeline
+     */
+    void CompleteStartupStage();
+
+
     /**
      * Spawns a DSRuntimeManager if none exists and auto-spawn is enabled
      * @return True if a manager was spawned or already exists
@@ -86,6 +116,12 @@ private:
     bool EnsureDSLightSyncerExists();
 
 public:
+    /**
+     * Checks whether the app runs as a headless sync node (-DSSyncNode, or no rendering at all)
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Datasmith|Sync Node")
+    static bool IsSyncNode();
+
     /**
      * Gets the DSRuntimeManager instance in the world
      * @return Pointer to DSRuntimeManager, or nullptr if none exists
@@ -0,0 +1,315 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSBoundsBVH.h"
+#include "ConvexVolume.h"
+#include "Algo/Sort.h"
+
+namespace DSBoundsBVH
+{
+    static constexpr int32 MaxDepth = 64;
+
+    /**
+     * Slab test of a ray against a box
+     * @return False if the ray misses the box before MaxDistance
+     */
+    static bool IntersectRayBox(const FBox& Box, const FVector& Origin, const FVector& InvDirection, double MaxDistance, double& OutEntry)
+    {
+        double Entry = 0.0;
+        double Exit = MaxDistance;
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            double Near = (Box.Min[Axis] - Origin[Axis]) * InvDirection[Axis];
+            double Far = (Box.Max[Axis] - Origin[Axis]) * InvDirection[Axis];
+            if (Near > Far)
+            {
+                Swap(Near, Far);
+            }
+
+            // NaN from 0 * inf (ray in the slab plane) fails both comparisons and leaves the range unchanged
+            Entry = Near > Entry ? Near : Entry;
+            Exit = Far < Exit ? Far : Exit;
+            if (Entry > Exit)
+            {
+                return false;
+            }
+        }
+
+        OutEntry = Entry;
+        return true;
+    }
+}
+
+void FDSBoundsBVH::Build(const TArray<FBox>& ItemBounds, int32 MaxLeafItems)
+{
+    Nodes.Reset();
+    ItemIndices.Reset(ItemBounds.Num());
+    ItemBoxes = ItemBounds;
+
+    for (int32 Item = 0; Item < ItemBounds.Num(); ++Item)
+    {
+        ItemIndices.Add(Item);
+    }
+
+    if (ItemIndices.Num() == 0)
+    {
+        return;
+    }
+
+    MaxLeafItems = FMath::Max(MaxLeafItems, 1);
+    Nodes.Reserve(FMath::Max(2 * ItemIndices.Num() / MaxLeafItems, 1));
+
+    struct FPending
+    {
+        int32 NodeIndex;
+        int32 Begin;
+        int32 End;
+    };
+
+    TArray<FPending> Stack;
+    Nodes.AddDefaulted();
+    Stack.Add({ 0, 0, ItemIndices.Num() });
+
+    while (Stack.Num() > 0)
+    {
+        const FPending Pending = Stack.Pop(EAllowShrinking::No);
+
+        FBox Bounds(ForceInit);
+        FBox CentroidBounds(ForceInit);
+        for (int32 Index = Pending.Begin; Index < Pending.End; ++Index)
+        {
+            const FBox& ItemBox = ItemBounds[ItemIndices[Index]];
+            Bounds += ItemBox;
+            CentroidBounds += ItemBox.GetCenter();
+        }
+
+        const int32 Count = Pending.End - Pending.Begin;
+        const FVector CentroidExtent = CentroidBounds.GetSize();
+
+        // Coincident centroids cannot be separated, such items share a leaf however many there are
+        if (Count <= MaxLeafItems || CentroidExtent.GetMax() <= UE_KINDA_SMALL_NUMBER)
+        {
+            FNode& Leaf = Nodes[Pending.NodeIndex];
+            Leaf.Bounds = Bounds;
+            Leaf.First = Pending.Begin;
+            Leaf.NumItems = Count;
+            continue;
+        }
+
+        const int32 Axis = CentroidExtent.X >= CentroidExtent.Y
+            ? (CentroidExtent.X >= CentroidExtent.Z ? 0 : 2)
+            : (CentroidExtent.Y >= CentroidExtent.Z ? 1 : 2);
+
+        TArrayView<int32> Range(ItemIndices.GetData() + Pending.Begin, Count);
+        Algo::Sort(Range, [&ItemBounds, Axis](int32 A, int32 B)
+        {
+            return ItemBounds[A].GetCenter()[Axis] < ItemBounds[B].GetCenter()[Axis];
+        });
+
+        const int32 Middle = Pending.Begin + Count / 2;
+        const int32 FirstChild = Nodes.Num();
+        Nodes.AddDefaulted(2);
+
+        FNode& Interior = Nodes[Pending.NodeIndex];
+        Interior.Bounds = Bounds;
+        Interior.First = FirstChild;
+        Interior.NumItems = 0;
+
+        Stack.Add({ FirstChild, Pending.Begin, Middle });
+        Stack.Add({ FirstChild + 1, Middle, Pending.End });
+    }
+}
+
+int32 FDSBoundsBVH::Raycast(const FVector& Origin, const FVector& Direction, double MaxDistance, FRayHitTest HitTest, double& OutDistance) const
+{
+    int32 BestItem = INDEX_NONE;
+    double BestDistance = MaxDistance;
+
+    if (Nodes.Num() == 0)
+    {
+        return BestItem;
+    }
+
+    const FVector InvDirection(
+        Direction.X != 0.0 ? 1.0 / Direction.X : UE_BIG_NUMBER,
+        Direction.Y != 0.0 ? 1.0 / Direction.Y : UE_BIG_NUMBER,
+        Direction.Z != 0.0 ? 1.0 / Direction.Z : UE_BIG_NUMBER);
+
+    double RootEntry = 0.0;
+    if (!DSBoundsBVH::IntersectRayBox(Nodes[0].Bounds, Origin, InvDirection, BestDistance, RootEntry))
+    {
+        return BestItem;
+    }
+
+    // Entry distances are kept with the nodes so subtrees behind a closer hit are skipped when popped
+    TPair<int32, double> Stack[DSBoundsBVH::MaxDepth * 2];
+    int32 StackSize = 0;
+    Stack[StackSize++] = { 0, RootEntry };
+
+    while (StackSize > 0)
+    {
+        const TPair<int32, double> Entry = Stack[--StackSize];
+        if (Entry.Value > BestDistance)
+        {
+            continue;
+        }
+
+        const FNode& Node = Nodes[Entry.Key];
+        if (Node.NumItems > 0)
+        {
+            for (int32 Index = Node.First; Index < Node.First + Node.NumItems; ++Index)
+            {
+                const int32 Item = ItemIndices[Index];
+                double ItemEntry = 0.0;
+                if (!DSBoundsBVH::IntersectRayBox(ItemBoxes[Item], Origin, InvDirection, BestDistance, ItemEntry))
+                {
+                    continue;
+                }
+
+                const double HitDistance = HitTest(Item, ItemEntry, BestDistance);
+                if (HitDistance >= 0.0 && HitDistance < BestDistance)
+                {
+                    BestDistance = HitDistance;
+                    BestItem = Item;
+                }
+            }
+            continue;
+        }
+
+        double NearEntry = 0.0;
+        double FarEntry = 0.0;
+        int32 Near = Node.First;
+        int32 Far = Node.First + 1;
+        bool bHitNear = DSBoundsBVH::IntersectRayBox(Nodes[Near].Bounds, Origin, InvDirection, BestDistance, NearEntry);
+        bool bHitFar = DSBoundsBVH::IntersectRayBox(Nodes[Far].Bounds, Origin, InvDirection, BestDistance, FarEntry);
+
+        if (bHitNear && bHitFar && FarEntry < NearEntry)
+        {
+            Swap(Near, Far);
+            Swap(NearEntry, FarEntry);
+        }
+
+        // Far child first, so the near one is popped and tested next
+        if (bHitNear && bHitFar && StackSize + 2 <= UE_ARRAY_COUNT(Stack))
+        {
+            Stack[StackSize++] = { Far, FarEntry };
+            Stack[StackSize++] = { Near, NearEntry };
+        }
+        else if (bHitNear || bHitFar)
+        {
+            Stack[StackSize++] = bHitNear ? TPair<int32, double>(Near, NearEntry) : TPair<int32, double>(Far, FarEntry);
+        }
+    }
+
+    OutDistance = BestDistance;
+    return BestItem;
+}
+
+void FDSBoundsBVH::QueryConvex(const FConvexVolume& Volume, TArray<int32>& OutItems) const
+{
+    if (Nodes.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<int32, TInlineAllocator<DSBoundsBVH::MaxDepth * 2>> Stack;
+    Stack.Add(0);
+
+    while (Stack.Num() > 0)
+    {
+        const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+        const FNode& Node = Nodes[NodeIndex];
+
+        const FOutcode Outcode = Volume.GetBoxIntersectionOutcode(Node.Bounds.GetCenter(), Node.Bounds.GetExtent());
+        if (!Outcode.GetInside())
+        {
+            continue;
+        }
+
+        // Entirely inside, every item below is selected without testing it
+        if (!Outcode.GetOutside())
+        {
+            GatherItems(NodeIndex, OutItems);
+            continue;
+        }
+
+        if (Node.NumItems > 0)
+        {
+            for (int32 Index = Node.First; Index < Node.First + Node.NumItems; ++Index)
+            {
+                const FBox& ItemBox = ItemBoxes[ItemIndices[Index]];
+                if (Volume.IntersectBox(ItemBox.GetCenter(), ItemBox.GetExtent()))
+                {
+                    OutItems.Add(ItemIndices[Index]);
+                }
+            }
+            continue;
+        }
+
+        Stack.Add(Node.First);
+        Stack.Add(Node.First + 1);
+    }
+}
+
+void FDSBoundsBVH::QueryBox(const FBox& Box, TArray<int32>& OutItems) const
+{
+    if (Nodes.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<int32, TInlineAllocator<DSBoundsBVH::MaxDepth * 2>> Stack;
+    Stack.Add(0);
+
+    while (Stack.Num() > 0)
+    {
+        const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+        if (!Node.Bounds.Intersect(Box))
+        {
+            continue;
+        }
+
+        if (Node.NumItems > 0)
+        {
+            for (int32 Index = Node.First; Index < Node.First + Node.NumItems; ++Index)
+            {
+                if (ItemBoxes[ItemIndices[Index]].Intersect(Box))
+                {
+                    OutItems.Add(ItemIndices[Index]);
+                }
+            }
+            continue;
+        }
+
+        Stack.Add(Node.First);
+        Stack.Add(Node.First + 1);
+    }
+}
+
+void FDSBoundsBVH::GatherItems(int32 NodeIndex, TArray<int32>& OutItems) const
+{
+    // Every leaf below a node covers a contiguous range of ItemIndices
+    int32 First = NodeIndex;
+    int32 Last = NodeIndex;
+    while (Nodes[First].NumItems == 0)
+    {
+        First = Nodes[First].First;
+    }
+    while (Nodes[Last].NumItems == 0)
+    {
+        Last = Nodes[Last].First + 1;
+    }
+
+    for (int32 Index = Nodes[First].First; Index < Nodes[Last].First + Nodes[Last].NumItems; ++Index)
+    {
+        OutItems.Add(ItemIndices[Index]);
+    }
+}
@@ -0,0 +1,99 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+struct FConvexVolume;
+
+/**
+ * FDSBoundsBVH - Bounding volume hierarchy over axis aligned boxes
+ *
+ * Items are identified by their index in the array the hierarchy was built from. Nodes are
+ * split at the centroid median of their longest axis, which builds quickly and queries well
+ * enough for the mostly uniform part sizes of CAD scenes. The hierarchy holds no reference to
+ * what the boxes describe; ray queries hand candidate items to a callback for exact testing.
+ */
+class DATASMITHTEST_API FDSBoundsBVH
+{
+public:
+    /**
+     * Callback testing a single item against a ray
+     * @param Item Index of the item
+     * @param EntryDistance Distance at which the ray enters the item's box
+     * @param MaxDistance Distance of the closest hit found so far
+     * @return Hit distance, or a negative value if the item is missed
+     */
+    using FRayHitTest = TFunctionRef<double(int32 Item, double EntryDistance, double MaxDistance)>;
+
+    /**
+     * Builds the hierarchy, replacing any previous one
+     * @param ItemBounds Bounds of each item
+     * @param MaxLeafItems Maximum number of items per leaf
+     */
+    void Build(const TArray<FBox>& ItemBounds, int32 MaxLeafItems = 4);
+
+    /**
+     * Finds the closest item hit by a ray
+     * @param Origin Ray origin
+     * @param Direction Ray direction, distances are in units of its length
+     * @param MaxDistance Hits beyond this distance are ignored
+     * @param HitTest Exact test for items whose box the ray enters
+     * @param OutDistance Distance of the hit
+     * @return Index of the hit item, or INDEX_NONE
+     */
+    int32 Raycast(const FVector& Origin, const FVector& Direction, double MaxDistance, FRayHitTest HitTest, double& OutDistance) const;
+
+    /**
+     * Collects every item whose box intersects a convex volume, such as a selection frustum
+     */
+    void QueryConvex(const FConvexVolume& Volume, TArray<int32>& OutItems) const;
+
+    /**
+     * Collects every item whose box intersects a box
+     */
+    void QueryBox(const FBox& Box, TArray<int32>& OutItems) const;
+
+    /**
+     * Gets the number of items the hierarchy was built from
+     */
+    int32 GetNumItems() const { return ItemIndices.Num(); }
+
+    /**
+     * Gets the memory used by the hierarchy in bytes
+     */
+    SIZE_T GetAllocatedSize() const { return Nodes.GetAllocatedSize() + ItemIndices.GetAllocatedSize() + ItemBoxes.GetAllocatedSize(); }
+
+private:
+    struct FNode
+    {
+        FBox Bounds;
+
+        /** First child for interior nodes (the second one follows it), first entry of ItemIndices for leaves */
+        int32 First = 0;
+
+        /** Number of items of a leaf, 0 for interior nodes */
+        int32 NumItems = 0;
+    };
+
+    /**
+     * Collects the items of a node and all its descendants
+     */
+    void GatherItems(int32 NodeIndex, TArray<int32>& OutItems) const;
+
+    TArray<FNode> Nodes;
+    TArray<int32> ItemIndices;
+
+    /** Bounds of each item, indexed by item */
+    TArray<FBox> ItemBoxes;
+};
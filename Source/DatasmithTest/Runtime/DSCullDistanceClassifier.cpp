@@ -0,0 +1,164 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSCullDistanceClassifier.h"
+#include "Components/PrimitiveComponent.h"
+#include "Curves/RichCurve.h"
+
+// Logging category for the cull distance classifier
+DEFINE_LOG_CATEGORY_STATIC(LogDSCullDistance, Log, All);
+
+namespace DSCullDistance
+{
+    // Size class boundaries on bounds radius in centimeters
+    struct FSizeClassDefinition
+    {
+        const TCHAR* Name;
+        float MaxRadius;
+    };
+
+    static const FSizeClassDefinition SizeClasses[] =
+    {
+        { TEXT("Tiny"), 5.0f },
+        { TEXT("Small"), 25.0f },
+        { TEXT("Medium"), 100.0f },
+        { TEXT("Large"), MAX_flt }
+    };
+}
+
+void FDSCullDistanceReport::Log() const
+{
+    UE_LOG(LogDSCullDistance, Log, TEXT("=== Cull Distance Report (%d primitives changed) ==="), NumPrimitivesChanged);
+
+    for (const FDSCullDistanceSizeClass& SizeClass : SizeClasses)
+    {
+        FString Line = FString::Printf(TEXT("%-6s (r <= %s): %6d primitives"),
+            *SizeClass.Name,
+            SizeClass.MaxRadius < MAX_flt ? *FString::Printf(TEXT("%.0f"), SizeClass.MaxRadius) : TEXT("inf"),
+            SizeClass.NumPrimitives);
+
+        for (int32 DistanceIndex = 0; DistanceIndex < ViewDistances.Num(); ++DistanceIndex)
+        {
+            Line += FString::Printf(TEXT(" | culled at %.0fm: %d"), ViewDistances[DistanceIndex] / 100.0f, SizeClass.NumCulledAtDistance[DistanceIndex]);
+        }
+
+        UE_LOG(LogDSCullDistance, Log, TEXT("%s"), *Line);
+    }
+}
+
+FDSCullDistanceClassifier::FDSCullDistanceClassifier(const FRichCurve& InRadiusToDistance, float InNeverCullRadius)
+    : RadiusToDistance(InRadiusToDistance)
+    , NeverCullRadius(InNeverCullRadius)
+{
+}
+
+float FDSCullDistanceClassifier::EvaluateMaxDrawDistance(float BoundsRadius) const
+{
+    if (BoundsRadius >= NeverCullRadius || RadiusToDistance.GetNumKeys() == 0)
+    {
+        return 0.0f;
+    }
+
+    return FMath::Max(RadiusToDistance.Eval(BoundsRadius), 0.0f);
+}
+
+void FDSCullDistanceOverrides::RemoveStale()
+{
+    for (auto It = Components.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+FDSCullDistanceReport FDSCullDistanceClassifier::Apply(const TArray<UPrimitiveComponent*>& Primitives, const TArray<float>& ViewDistances, FDSCullDistanceOverrides& Overrides) const
+{
+    // Components replaced by earlier reimports would otherwise stay in the map forever
+    Overrides.RemoveStale();
+
+    FDSCullDistanceReport Report;
+    Report.ViewDistances = ViewDistances;
+
+    for (const DSCullDistance::FSizeClassDefinition& Definition : DSCullDistance::SizeClasses)
+    {
+        FDSCullDistanceSizeClass& SizeClass = Report.SizeClasses.AddDefaulted_GetRef();
+        SizeClass.Name = Definition.Name;
+        SizeClass.MaxRadius = Definition.MaxRadius;
+        SizeClass.NumCulledAtDistance.Init(0, ViewDistances.Num());
+    }
+
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+        if (!IsValid(Primitive))
+        {
+            continue;
+        }
+
+        const float Radius = Primitive->Bounds.SphereRadius;
+        const float MaxDrawDistance = EvaluateMaxDrawDistance(Radius);
+
+        // Only touch the render state when the distance actually changes
+        if (!FMath::IsNearlyEqual(Primitive->LDMaxDrawDistance, MaxDrawDistance, 1.0f))
+        {
+            // The first original is the one restored, later passes only replace their own value
+            FDSCullDistanceOverrides::FOverride* Override = Overrides.Components.Find(Primitive);
+            if (!Override)
+            {
+                Override = &Overrides.Components.Add(Primitive);
+                Override->OriginalDistance = Primitive->LDMaxDrawDistance;
+            }
+            Override->AppliedDistance = MaxDrawDistance;
+
+            Primitive->SetCullDistance(MaxDrawDistance);
+            ++Report.NumPrimitivesChanged;
+        }
+
+        const int32 ClassIndex = Report.SizeClasses.IndexOfByPredicate([Radius](const FDSCullDistanceSizeClass& SizeClass)
+        {
+            return Radius <= SizeClass.MaxRadius;
+        });
+
+        FDSCullDistanceSizeClass& SizeClass = Report.SizeClasses[ClassIndex];
+        ++SizeClass.NumPrimitives;
+
+        if (MaxDrawDistance > 0.0f)
+        {
+            for (int32 DistanceIndex = 0; DistanceIndex < ViewDistances.Num(); ++DistanceIndex)
+            {
+                if (MaxDrawDistance < ViewDistances[DistanceIndex])
+                {
+                    ++SizeClass.NumCulledAtDistance[DistanceIndex];
+                }
+            }
+        }
+    }
+
+    return Report;
+}
+
+int32 FDSCullDistanceClassifier::Reset(FDSCullDistanceOverrides& Overrides)
+{
+    int32 NumRestored = 0;
+    for (const TPair<TWeakObjectPtr<UPrimitiveComponent>, FDSCullDistanceOverrides::FOverride>& Pair : Overrides.Components)
+    {
+        UPrimitiveComponent* Primitive = Pair.Key.Get();
+        if (IsValid(Primitive) && FMath::IsNearlyEqual(Primitive->LDMaxDrawDistance, Pair.Value.AppliedDistance, 1.0f))
+        {
+            Primitive->SetCullDistance(Pair.Value.OriginalDistance);
+            ++NumRestored;
+        }
+    }
+
+    Overrides.Components.Reset();
+    return NumRestored;
+}
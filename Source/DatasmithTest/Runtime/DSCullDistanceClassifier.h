@@ -0,0 +1,115 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class UPrimitiveComponent;
+struct FRichCurve;
+
+/**
+ * Per size class statistics produced by the cull distance classifier
+ */
+struct FDSCullDistanceSizeClass
+{
+    FString Name;
+
+    /** Upper bound of the bounds radius for this class, inclusive */
+    float MaxRadius = 0.0f;
+
+    /** Number of primitives falling into this class */
+    int32 NumPrimitives = 0;
+
+    /** For each report view distance, how many primitives of this class are culled beyond it */
+    TArray<int32> NumCulledAtDistance;
+};
+
+/**
+ * Summary of what the size-based cull distances remove at typical viewing distances
+ */
+struct FDSCullDistanceReport
+{
+    TArray<float> ViewDistances;
+    TArray<FDSCullDistanceSizeClass> SizeClasses;
+    int32 NumPrimitivesChanged = 0;
+
+    /**
+     * Writes the report to the log, one line per size class
+     */
+    void Log() const;
+};
+
+/**
+ * Draw distances the classifier replaced, so they can be restored when it is switched off
+ */
+struct FDSCullDistanceOverrides
+{
+    struct FOverride
+    {
+        /** Max draw distance the component had before it was classified */
+        float OriginalDistance = 0.0f;
+
+        /** Max draw distance the classifier set */
+        float AppliedDistance = 0.0f;
+    };
+
+    TMap<TWeakObjectPtr<UPrimitiveComponent>, FOverride> Components;
+
+    /**
+     * Drops components that have been destroyed
+     */
+    void RemoveStale();
+};
+
+/**
+ * FDSCullDistanceClassifier - Assigns max draw distances to imported components from their size
+ *
+ * CAD imports contain many tiny parts (screws, fittings, text) that cost draw calls at any
+ * distance. The classifier maps each component's bounds radius through a curve to a max draw
+ * distance; components above the never-cull radius keep unlimited draw distance.
+ */
+class DATASMITHTEST_API FDSCullDistanceClassifier
+{
+public:
+    /**
+     * @param InRadiusToDistance Curve mapping bounds radius (cm) to max draw distance (cm)
+     * @param InNeverCullRadius Components at least this large are never distance culled
+     */
+    FDSCullDistanceClassifier(const FRichCurve& InRadiusToDistance, float InNeverCullRadius);
+
+    /**
+     * Evaluates the max draw distance for a given bounds radius
+     * @return Max draw distance, 0 meaning unlimited
+     */
+    float EvaluateMaxDrawDistance(float BoundsRadius) const;
+
+    /**
+     * Applies cull distances to the given primitives and builds a report
+     * @param Primitives Components to classify
+     * @param ViewDistances Viewing distances the report is computed for
+     * @param Overrides Receives the original distance of every component changed for the first time
+     * @return Report with per size class statistics
+     */
+    FDSCullDistanceReport Apply(const TArray<UPrimitiveComponent*>& Primitives, const TArray<float>& ViewDistances, FDSCullDistanceOverrides& Overrides) const;
+
+    /**
+     * Restores the original draw distances of the components the classifier changed; distances
+     * changed by anything else since are left alone
+     * @return Number of components restored
+     */
+    static int32 Reset(FDSCullDistanceOverrides& Overrides);
+
+private:
+    const FRichCurve& RadiusToDistance;
+    float NeverCullRadius;
+};
@@ -0,0 +1,118 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSDeferredDestroyer.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
+#include "Algo/Sort.h"
+
+// Logging category for the deferred destroyer
+DEFINE_LOG_CATEGORY_STATIC(LogDSDeferredDestroyer, Log, All);
+
+namespace DSDeferredDestroyer
+{
+    static int32 GetAttachDepth(const UActorComponent* Component)
+    {
+        int32 Depth = 0;
+        if (const USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+        {
+            for (const USceneComponent* Parent = SceneComponent->GetAttachParent(); Parent; Parent = Parent->GetAttachParent())
+            {
+                ++Depth;
+            }
+        }
+        return Depth;
+    }
+}
+
+void FDSDeferredDestroyer::Add(AActor* Actor)
+{
+    if (!IsValid(Actor))
+    {
+        return;
+    }
+
+    Actor->SetActorHiddenInGame(true);
+    Actor->SetActorEnableCollision(false);
+
+    TArray<UActorComponent*> Components;
+    Actor->GetComponents(Components);
+
+    // The root goes last with the actor, every other component is destroyed individually
+    USceneComponent* RootComponent = Actor->GetRootComponent();
+    Components.Remove(RootComponent);
+
+    // Children first, so destroying a parent never re-attaches or re-registers its children
+    TArray<TPair<int32, UActorComponent*>> SortedComponents;
+    SortedComponents.Reserve(Components.Num());
+    for (UActorComponent* Component : Components)
+    {
+        SortedComponents.Emplace(DSDeferredDestroyer::GetAttachDepth(Component), Component);
+    }
+    Algo::SortBy(SortedComponents, [](const TPair<int32, UActorComponent*>& Entry) { return Entry.Key; }, TGreater<int32>());
+
+    FRetiredActor& Retired = Actors.AddDefaulted_GetRef();
+    Retired.Actor = Actor;
+    Retired.Components.Reserve(SortedComponents.Num());
+    for (const TPair<int32, UActorComponent*>& Entry : SortedComponents)
+    {
+        Retired.Components.Add(Entry.Value);
+    }
+
+    UE_LOG(LogDSDeferredDestroyer, Log, TEXT("Retiring %s with %d components"), *Actor->GetName(), Retired.Components.Num());
+}
+
+bool FDSDeferredDestroyer::Tick(double BudgetSeconds)
+{
+    const double EndTime = FPlatformTime::Seconds() + BudgetSeconds;
+
+    while (Actors.Num() > 0)
+    {
+        FRetiredActor& Retired = Actors[0];
+        while (Retired.NextComponent < Retired.Components.Num())
+        {
+            if (UActorComponent* Component = Retired.Components[Retired.NextComponent++].Get())
+            {
+                Component->DestroyComponent();
+            }
+
+            // Checked after each component so at least one is destroyed per tick
+            if (FPlatformTime::Seconds() >= EndTime)
+            {
+                return false;
+            }
+        }
+
+        if (AActor* Actor = Retired.Actor.Get())
+        {
+            Actor->Destroy();
+            UE_LOG(LogDSDeferredDestroyer, Log, TEXT("Destroyed retired actor %s"), *Actor->GetName());
+        }
+        Actors.RemoveAt(0);
+    }
+
+    return true;
+}
+
+void FDSDeferredDestroyer::Flush()
+{
+    Tick(TNumericLimits<double>::Max());
+}
+
+int32 FDSDeferredDestroyer::GetNumPendingComponents() const
+{
+    int32 NumPending = 0;
+    for (const FRetiredActor& Retired : Actors)
+    {
+        NumPending += Retired.Components.Num() - Retired.NextComponent;
+    }
+    return NumPending;
+}
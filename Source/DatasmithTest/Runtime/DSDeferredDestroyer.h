@@ -0,0 +1,70 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class AActor;
+class UActorComponent;
+
+/**
+ * FDSDeferredDestroyer - Tears actors down over several frames under a time budget
+ *
+ * An imported scene easily owns tens of thousands of components, and destroying them in one
+ * frame unregisters every render proxy and physics body at once. Retired actors are queued
+ * instead; each Tick destroys components, deepest in the attachment hierarchy first, until
+ * the budget is spent, and the actor itself once it is empty.
+ */
+class DATASMITHTEST_API FDSDeferredDestroyer
+{
+public:
+    /**
+     * Queues an actor for destruction; it is hidden right away and destroyed over the next ticks
+     * @param Actor Actor to retire
+     */
+    void Add(AActor* Actor);
+
+    /**
+     * Destroys queued components until the budget is spent
+     * @param BudgetSeconds Time allowed for this tick
+     * @return True when nothing is left to destroy
+     */
+    bool Tick(double BudgetSeconds);
+
+    /**
+     * Destroys everything still queued immediately
+     */
+    void Flush();
+
+    /**
+     * Checks whether anything is still queued
+     */
+    bool IsEmpty() const { return Actors.Num() == 0; }
+
+    /**
+     * Gets the number of components still waiting to be destroyed
+     */
+    int32 GetNumPendingComponents() const;
+
+private:
+    struct FRetiredActor
+    {
+        TWeakObjectPtr<AActor> Actor;
+
+        /** Components in destruction order, children before their parents */
+        TArray<TWeakObjectPtr<UActorComponent>> Components;
+        int32 NextComponent = 0;
+    };
+
+    TArray<FRetiredActor> Actors;
+};
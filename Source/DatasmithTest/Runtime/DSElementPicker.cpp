@@ -0,0 +1,256 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSElementPicker.h"
+#include "DSStaticMeshRebuild.h"
+#include "ConvexVolume.h"
+#include "GameFramework/Actor.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+
+// Logging category for the element picker
+DEFINE_LOG_CATEGORY_STATIC(LogDSElementPicker, Log, All);
+
+namespace DSElementPicker
+{
+    /**
+     * Moller-Trumbore intersection of a ray with a triangle, both faces count
+     * @return Distance along the ray in units of the direction's length, or a negative value if it misses
+     */
+    static double IntersectRayTriangle(const FVector& Origin, const FVector& Direction, const FVector& A, const FVector& B, const FVector& C)
+    {
+        const FVector EdgeAB = B - A;
+        const FVector EdgeAC = C - A;
+        const FVector P = FVector::CrossProduct(Direction, EdgeAC);
+        const double Determinant = FVector::DotProduct(EdgeAB, P);
+        if (FMath::Abs(Determinant) < UE_DOUBLE_SMALL_NUMBER)
+        {
+            return -1.0;
+        }
+
+        const double InvDeterminant = 1.0 / Determinant;
+        const FVector T = Origin - A;
+        const double U = FVector::DotProduct(T, P) * InvDeterminant;
+        if (U < 0.0 || U > 1.0)
+        {
+            return -1.0;
+        }
+
+        const FVector Q = FVector::CrossProduct(T, EdgeAB);
+        const double V = FVector::DotProduct(Direction, Q) * InvDeterminant;
+        if (V < 0.0 || U + V > 1.0)
+        {
+            return -1.0;
+        }
+
+        return FVector::DotProduct(EdgeAC, Q) * InvDeterminant;
+    }
+}
+
+void FDSElementPicker::Build(const TArray<UPrimitiveComponent*>& Primitives)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    Components.Reset(Primitives.Num());
+    TArray<FBox> Bounds;
+    Bounds.Reserve(Primitives.Num());
+
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+        if (!IsValid(Primitive))
+        {
+            continue;
+        }
+
+        Components.Add(Primitive);
+        Bounds.Add(Primitive->Bounds.GetBox());
+    }
+
+    ComponentBVH.Build(Bounds);
+
+    // Meshes may have been replaced by an update, their triangles are rebuilt on demand
+    TriangleMeshes.Reset();
+
+    UE_LOG(LogDSElementPicker, Log, TEXT("Built picking hierarchy over %d components in %.2f ms"),
+        Components.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+bool FDSElementPicker::Raycast(const FVector& Origin, const FVector& Direction, double MaxDistance, bool bRefineTriangles, FDSElementHit& OutHit)
+{
+    bool bBestOnTriangle = false;
+
+    double HitDistance = 0.0;
+    const int32 HitItem = ComponentBVH.Raycast(Origin, Direction, MaxDistance,
+        [this, &Origin, &Direction, bRefineTriangles, &bBestOnTriangle](int32 Item, double EntryDistance, double BestDistance) -> double
+        {
+            const UPrimitiveComponent* Component = Components[Item].Get();
+            if (!IsPickable(Component))
+            {
+                return -1.0;
+            }
+
+            // Instanced components would need one test per instance, their bounds are close enough for picking
+            const UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Component);
+            if (bRefineTriangles && MeshComponent && !MeshComponent->IsA<UInstancedStaticMeshComponent>())
+            {
+                if (const FTriangleMesh* Mesh = FindOrBuildTriangleMesh(MeshComponent->GetStaticMesh()))
+                {
+                    const double Distance = RaycastTriangles(*Component, *Mesh, Origin, Direction, BestDistance);
+                    if (Distance >= 0.0 && Distance < BestDistance)
+                    {
+                        bBestOnTriangle = true;
+                    }
+                    return Distance;
+                }
+            }
+
+            if (EntryDistance < BestDistance)
+            {
+                bBestOnTriangle = false;
+            }
+            return EntryDistance;
+        },
+        HitDistance);
+
+    if (HitItem == INDEX_NONE)
+    {
+        return false;
+    }
+
+    // The flag is only updated by hits closer than the best so far, so it describes the final hit
+    OutHit.Component = Components[HitItem].Get();
+    OutHit.Distance = HitDistance;
+    OutHit.Location = Origin + Direction * HitDistance;
+    OutHit.bOnTriangle = bBestOnTriangle;
+    return true;
+}
+
+void FDSElementPicker::QueryConvex(const FConvexVolume& Volume, TArray<UPrimitiveComponent*>& OutComponents) const
+{
+    TArray<int32> Items;
+    ComponentBVH.QueryConvex(Volume, Items);
+
+    OutComponents.Reset(Items.Num());
+    for (const int32 Item : Items)
+    {
+        UPrimitiveComponent* Component = Components[Item].Get();
+        if (IsPickable(Component))
+        {
+            OutComponents.Add(Component);
+        }
+    }
+}
+
+SIZE_T FDSElementPicker::GetAllocatedSize() const
+{
+    SIZE_T Size = Components.GetAllocatedSize() + ComponentBVH.GetAllocatedSize() + TriangleMeshes.GetAllocatedSize();
+    for (const TPair<TObjectKey<UStaticMesh>, TSharedPtr<FTriangleMesh>>& Pair : TriangleMeshes)
+    {
+        if (Pair.Value.IsValid())
+        {
+            Size += Pair.Value->Positions.GetAllocatedSize() + Pair.Value->Indices.GetAllocatedSize() + Pair.Value->BVH.GetAllocatedSize();
+        }
+    }
+    return Size;
+}
+
+const FDSElementPicker::FTriangleMesh* FDSElementPicker::FindOrBuildTriangleMesh(UStaticMesh* StaticMesh)
+{
+    if (!StaticMesh)
+    {
+        return nullptr;
+    }
+
+    if (const TSharedPtr<FTriangleMesh>* Existing = TriangleMeshes.Find(StaticMesh))
+    {
+        return Existing->Get();
+    }
+
+    // Cached even when empty so meshes without CPU data are not retried on every pick
+    TSharedPtr<FTriangleMesh>& Entry = TriangleMeshes.Add(StaticMesh);
+
+    const FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+    if (!RenderData || RenderData->LODResources.Num() == 0 || !FDSStaticMeshRebuild::HasCPUData(RenderData->LODResources[0]))
+    {
+        UE_LOG(LogDSElementPicker, Verbose, TEXT("Mesh %s has no CPU data, picking falls back to its bounds"), *StaticMesh->GetName());
+        return nullptr;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    const FStaticMeshLODResources& LOD = RenderData->LODResources[0];
+
+    TSharedPtr<FTriangleMesh> Mesh = MakeShared<FTriangleMesh>();
+
+    const FPositionVertexBuffer& PositionBuffer = LOD.VertexBuffers.PositionVertexBuffer;
+    Mesh->Positions.SetNumUninitialized(PositionBuffer.GetNumVertices());
+    for (uint32 VertexIndex = 0; VertexIndex < PositionBuffer.GetNumVertices(); ++VertexIndex)
+    {
+        Mesh->Positions[VertexIndex] = PositionBuffer.VertexPosition(VertexIndex);
+    }
+
+    LOD.IndexBuffer.GetCopy(Mesh->Indices);
+
+    const int32 NumTriangles = Mesh->Indices.Num() / 3;
+    TArray<FBox> TriangleBounds;
+    TriangleBounds.SetNumUninitialized(NumTriangles);
+    for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+    {
+        FBox Box(ForceInit);
+        Box += FVector(Mesh->Positions[Mesh->Indices[Triangle * 3 + 0]]);
+        Box += FVector(Mesh->Positions[Mesh->Indices[Triangle * 3 + 1]]);
+        Box += FVector(Mesh->Positions[Mesh->Indices[Triangle * 3 + 2]]);
+        TriangleBounds[Triangle] = Box;
+    }
+
+    Mesh->BVH.Build(TriangleBounds);
+    Entry = Mesh;
+
+    UE_LOG(LogDSElementPicker, Verbose, TEXT("Built triangle hierarchy of %s (%d triangles) in %.2f ms"),
+        *StaticMesh->GetName(), NumTriangles, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+    return Entry.Get();
+}
+
+double FDSElementPicker::RaycastTriangles(const UPrimitiveComponent& Component, const FTriangleMesh& Mesh, const FVector& Origin, const FVector& Direction, double MaxDistance) const
+{
+    // The direction is not renormalized, so distances along the local ray equal world distances even under scale
+    const FTransform& ComponentTransform = Component.GetComponentTransform();
+    const FVector LocalOrigin = ComponentTransform.InverseTransformPosition(Origin);
+    const FVector LocalDirection = ComponentTransform.InverseTransformVector(Direction);
+
+    double Distance = -1.0;
+    const int32 HitTriangle = Mesh.BVH.Raycast(LocalOrigin, LocalDirection, MaxDistance,
+        [&Mesh, &LocalOrigin, &LocalDirection](int32 Triangle, double EntryDistance, double BestDistance) -> double
+        {
+            return DSElementPicker::IntersectRayTriangle(LocalOrigin, LocalDirection,
+                FVector(Mesh.Positions[Mesh.Indices[Triangle * 3 + 0]]),
+                FVector(Mesh.Positions[Mesh.Indices[Triangle * 3 + 1]]),
+                FVector(Mesh.Positions[Mesh.Indices[Triangle * 3 + 2]]));
+        },
+        Distance);
+
+    return HitTriangle != INDEX_NONE ? Distance : -1.0;
+}
+
+bool FDSElementPicker::IsPickable(const UPrimitiveComponent* Component)
+{
+    if (!IsValid(Component) || !Component->IsRegistered() || !Component->IsVisible() || Component->bHiddenInGame)
+    {
+        return false;
+    }
+
+    // Covers the hidden back buffer of a double buffered reimport
+    const AActor* Owner = Component->GetOwner();
+    return !Owner || !Owner->IsHidden();
+}
@@ -0,0 +1,122 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DSBoundsBVH.h"
+#include "UObject/ObjectKey.h"
+
+// Forward declarations
+class UPrimitiveComponent;
+class UStaticMesh;
+struct FConvexVolume;
+
+/**
+ * Result of a pick
+ */
+struct FDSElementHit
+{
+    UPrimitiveComponent* Component = nullptr;
+    FVector Location = FVector::ZeroVector;
+    double Distance = 0.0;
+
+    /** False when the hit is on the component's bounds because its mesh has no CPU triangle data */
+    bool bOnTriangle = false;
+};
+
+/**
+ * FDSElementPicker - Ray and frustum queries against imported components without physics
+ *
+ * Imported components have collision disabled, so line traces cannot find them. The picker
+ * keeps a bounds hierarchy over the world bounds of the components and refines ray hits
+ * against the actual triangles of static meshes. Triangle hierarchies are built per mesh in
+ * local space the first time a ray reaches one of its components, so instances share them and
+ * meshes nobody points at cost nothing.
+ *
+ * Bounds are captured when the picker is built; it must be rebuilt once components move.
+ */
+class DATASMITHTEST_API FDSElementPicker
+{
+public:
+    /**
+     * Builds the bounds hierarchy, replacing any previous one
+     * @param Primitives Components that can be picked
+     */
+    void Build(const TArray<UPrimitiveComponent*>& Primitives);
+
+    /**
+     * Finds the closest visible component hit by a ray
+     * @param Origin Ray origin
+     * @param Direction Ray direction, normalized
+     * @param MaxDistance Hits beyond this distance are ignored
+     * @param bRefineTriangles Tests the triangles of static meshes instead of stopping at their bounds
+     * @param OutHit The hit, valid when the function returns true
+     * @return True if a component was hit
+     */
+    bool Raycast(const FVector& Origin, const FVector& Direction, double MaxDistance, bool bRefineTriangles, FDSElementHit& OutHit);
+
+    /**
+     * Collects the visible components whose bounds intersect a convex volume
+     * @param Volume Volume in world space, usually a selection frustum
+     * @param OutComponents Components found
+     */
+    void QueryConvex(const FConvexVolume& Volume, TArray<UPrimitiveComponent*>& OutComponents) const;
+
+    /**
+     * Gets the number of components in the hierarchy
+     */
+    int32 GetNumComponents() const { return Components.Num(); }
+
+    /**
+     * Gets the number of meshes with a triangle hierarchy built so far
+     */
+    int32 GetNumTriangleMeshes() const { return TriangleMeshes.Num(); }
+
+    /**
+     * Gets the memory used by the picker in bytes
+     */
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    /**
+     * Local space triangles of one static mesh LOD with their hierarchy
+     */
+    struct FTriangleMesh
+    {
+        TArray<FVector3f> Positions;
+        TArray<uint32> Indices;
+        FDSBoundsBVH BVH;
+    };
+
+    /**
+     * Gets the triangle hierarchy of a mesh, building it on first use
+     * @return Nullptr if the mesh has no CPU data to build from
+     */
+    const FTriangleMesh* FindOrBuildTriangleMesh(UStaticMesh* StaticMesh);
+
+    /**
+     * Intersects a ray with the triangles of a component
+     * @return Hit distance along the ray, or a negative value if it misses
+     */
+    double RaycastTriangles(const UPrimitiveComponent& Component, const FTriangleMesh& Mesh, const FVector& Origin, const FVector& Direction, double MaxDistance) const;
+
+    /**
+     * Checks whether a component is currently pickable
+     */
+    static bool IsPickable(const UPrimitiveComponent* Component);
+
+    TArray<TWeakObjectPtr<UPrimitiveComponent>> Components;
+    FDSBoundsBVH ComponentBVH;
+
+    /** Triangle hierarchies per mesh, a null entry marks a mesh without CPU data */
+    TMap<TObjectKey<UStaticMesh>, TSharedPtr<FTriangleMesh>> TriangleMeshes;
+};
@@ -0,0 +1,132 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSGCClusterer.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
+#include "UObject/UObjectArray.h"
+#include "HAL/IConsoleManager.h"
+
+// Logging category for the GC clusterer
+DEFINE_LOG_CATEGORY_STATIC(LogDSGCClusterer, Log, All);
+
+void FDSGCClusterReport::Log() const
+{
+    UE_LOG(LogDSGCClusterer, Log, TEXT("GC cluster: %d of %d assets added as roots (%d skipped), %d objects clustered, %d mutable, %d referenced clusters, built in %.1f ms"),
+           NumCandidates - NumSkipped, NumCandidates, NumSkipped, NumClustered, NumMutable, NumReferencedClusters, BuildMs);
+}
+
+bool FDSGCClusterer::IsClusteringEnabled()
+{
+    const IConsoleVariable* CreateClustersVar = IConsoleManager::Get().FindConsoleVariable(TEXT("gc.CreateGCClusters"));
+    return CreateClustersVar && CreateClustersVar->GetBool();
+}
+
+bool FDSGCClusterer::CanCluster(const UObject* Object)
+{
+    if (!IsValid(Object) || Object->IsRooted() || GUObjectArray.IsDisregardForGC(Object) || !Object->CanBeInCluster())
+    {
+        return false;
+    }
+
+    // Assets loaded from packages belong to the clusters created when they were loaded
+    if (Object->HasAnyFlags(RF_WasLoaded))
+    {
+        return false;
+    }
+
+    const FUObjectItem* ObjectItem = GUObjectArray.ObjectToObjectItem(Object);
+    return ObjectItem->GetOwnerIndex() == 0 && !ObjectItem->HasAnyFlags(EInternalObjectFlags::ClusterRoot);
+}
+
+UDSImportCluster* FDSGCClusterer::CreateCluster(const TArray<UPrimitiveComponent*>& Primitives, FDSGCClusterReport& OutReport)
+{
+    OutReport = FDSGCClusterReport();
+
+    if (!IsClusteringEnabled())
+    {
+        UE_LOG(LogDSGCClusterer, Verbose, TEXT("GC clusters are disabled (gc.CreateGCClusters), imported assets stay unclustered"));
+        return nullptr;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    TSet<UObject*> Candidates;
+    TArray<UMaterialInterface*> Materials;
+    for (const UPrimitiveComponent* Primitive : Primitives)
+    {
+        if (!IsValid(Primitive))
+        {
+            continue;
+        }
+
+        if (const UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Primitive))
+        {
+            Candidates.Add(MeshComponent->GetStaticMesh());
+        }
+
+        Materials.Reset();
+        Primitive->GetUsedMaterials(Materials);
+        for (UMaterialInterface* Material : Materials)
+        {
+            Candidates.Add(Material);
+        }
+    }
+    Candidates.Remove(nullptr);
+
+    UDSImportCluster* Cluster = NewObject<UDSImportCluster>(GetTransientPackage(), NAME_None, RF_Transient);
+    Cluster->Objects.Reserve(Candidates.Num());
+
+    for (UObject* Candidate : Candidates)
+    {
+        ++OutReport.NumCandidates;
+        if (CanCluster(Candidate))
+        {
+            Cluster->Objects.Add(Candidate);
+        }
+        else
+        {
+            ++OutReport.NumSkipped;
+        }
+    }
+
+    if (Cluster->Objects.Num() == 0)
+    {
+        OutReport.BuildMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+        return nullptr;
+    }
+
+    // Walks the root's references and pulls in every clusterable object it reaches
+    Cluster->CreateCluster();
+
+    if (const FUObjectCluster* ObjectCluster = GUObjectClusters.GetObjectCluster(Cluster))
+    {
+        OutReport.NumClustered = ObjectCluster->Objects.Num();
+        OutReport.NumMutable = ObjectCluster->MutableObjects.Num();
+        OutReport.NumReferencedClusters = ObjectCluster->ReferencedClusters.Num();
+    }
+
+    OutReport.BuildMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    return Cluster;
+}
+
+void FDSGCClusterer::DissolveCluster(UDSImportCluster* Cluster)
+{
+    if (!IsValid(Cluster) || !Cluster->HasAnyInternalFlags(EInternalObjectFlags::ClusterRoot))
+    {
+        return;
+    }
+
+    GUObjectClusters.DissolveCluster(Cluster);
+    UE_LOG(LogDSGCClusterer, Verbose, TEXT("Dissolved GC cluster %s"), *Cluster->GetName());
+}
@@ -0,0 +1,95 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "DSGCClusterer.generated.h"
+
+// Forward declarations
+class UPrimitiveComponent;
+
+/**
+ * Root of the GC cluster of one import batch. Its only job is to reference the batch's assets so
+ * they are gathered into its cluster when it is created.
+ */
+UCLASS(Transient)
+class DATASMITHTEST_API UDSImportCluster : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool CanBeClusterRoot() const override { return true; }
+
+    /** Assets of the batch, whatever they reference is pulled into the cluster as well */
+    UPROPERTY()
+    TArray<TObjectPtr<UObject>> Objects;
+};
+
+/**
+ * Summary of a GC cluster creation
+ */
+struct FDSGCClusterReport
+{
+    int32 NumCandidates = 0;
+    int32 NumSkipped = 0;
+    int32 NumClustered = 0;
+    int32 NumMutable = 0;
+    int32 NumReferencedClusters = 0;
+    double BuildMs = 0.0;
+
+    /**
+     * Writes the report to the log
+     */
+    void Log() const;
+};
+
+/**
+ * FDSGCClusterer - Groups the assets of an import batch into a single garbage collection cluster
+ *
+ * Every import creates meshes, materials, textures and body setups by the hundreds of thousands,
+ * and each of them is visited on every reachability pass. Objects in a cluster are not visited
+ * individually: the collector only checks the root and the few objects outside the cluster its
+ * members reference. Imported assets do not change their references between DirectLink updates,
+ * so the cluster stays valid until the next update, which dissolves it before touching them.
+ *
+ * Components and actors cannot join: actors only opt into clustering when their level is loaded,
+ * and components are clusterable only when their owner is.
+ */
+class DATASMITHTEST_API FDSGCClusterer
+{
+public:
+    /**
+     * Checks whether the engine allows GC clusters (gc.CreateGCClusters)
+     */
+    static bool IsClusteringEnabled();
+
+    /**
+     * Creates a cluster holding the meshes and materials used by the primitives, and what they reference
+     * @param Primitives Imported components of one batch
+     * @param OutReport Object counts and build time
+     * @return Cluster root, nullptr if clustering is disabled or nothing could be clustered. The caller keeps it referenced.
+     */
+    static UDSImportCluster* CreateCluster(const TArray<UPrimitiveComponent*>& Primitives, FDSGCClusterReport& OutReport);
+
+    /**
+     * Dissolves a cluster so its objects are tracked individually again; must be called before
+     * any of them gains or loses references
+     */
+    static void DissolveCluster(UDSImportCluster* Cluster);
+
+private:
+    /**
+     * Checks whether an object can join a new cluster
+     */
+    static bool CanCluster(const UObject* Object);
+};
@@ -0,0 +1,63 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSGCPauseTimer.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectArray.h"
+
+// Logging category for the GC pause timer
+DEFINE_LOG_CATEGORY_STATIC(LogDSGCPauseTimer, Log, All);
+
+FString FDSGCPauseStats::ToString() const
+{
+    return FString::Printf(TEXT("GC pauses: %d collections, last %.2f ms, average %.2f ms, max %.2f ms, %d objects"),
+        NumCollections, LastMs, GetAverageMs(), MaxMs, NumObjects);
+}
+
+FDSGCPauseTimer::FDSGCPauseTimer()
+{
+    PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddRaw(this, &FDSGCPauseTimer::HandlePreGarbageCollect);
+    PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FDSGCPauseTimer::HandlePostGarbageCollect);
+}
+
+FDSGCPauseTimer::~FDSGCPauseTimer()
+{
+    FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+}
+
+void FDSGCPauseTimer::Reset()
+{
+    Stats = FDSGCPauseStats();
+}
+
+void FDSGCPauseTimer::HandlePreGarbageCollect()
+{
+    CollectStartTime = FPlatformTime::Seconds();
+    Stats.NumObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+}
+
+void FDSGCPauseTimer::HandlePostGarbageCollect()
+{
+    // Created between the two delegates, the first collection cannot be timed
+    if (CollectStartTime <= 0.0)
+    {
+        return;
+    }
+
+    Stats.LastMs = (FPlatformTime::Seconds() - CollectStartTime) * 1000.0;
+    Stats.MaxMs = FMath::Max(Stats.MaxMs, Stats.LastMs);
+    Stats.TotalMs += Stats.LastMs;
+    ++Stats.NumCollections;
+    CollectStartTime = 0.0;
+
+    UE_LOG(LogDSGCPauseTimer, Verbose, TEXT("GC pause %.2f ms with %d objects"), Stats.LastMs, Stats.NumObjects);
+}
@@ -0,0 +1,75 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Garbage collection pauses measured since the timer was created or last reset
+ */
+struct FDSGCPauseStats
+{
+    int32 NumCollections = 0;
+    double LastMs = 0.0;
+    double MaxMs = 0.0;
+    double TotalMs = 0.0;
+
+    /** Live UObjects when the last collection started */
+    int32 NumObjects = 0;
+
+    /**
+     * Gets the mean pause, 0 before the first collection
+     */
+    double GetAverageMs() const { return NumCollections > 0 ? TotalMs / NumCollections : 0.0; }
+
+    /**
+     * Formats the stats as a single log line
+     */
+    FString ToString() const;
+};
+
+/**
+ * FDSGCPauseTimer - Measures the game thread pause of every garbage collection
+ *
+ * Times the span between the engine's pre and post collection delegates, which covers the
+ * reachability analysis and the unhashing of unreachable objects; incremental purging that
+ * runs over later frames is not included.
+ */
+class DATASMITHTEST_API FDSGCPauseTimer
+{
+public:
+    FDSGCPauseTimer();
+    ~FDSGCPauseTimer();
+
+    FDSGCPauseTimer(const FDSGCPauseTimer&) = delete;
+    FDSGCPauseTimer& operator=(const FDSGCPauseTimer&) = delete;
+
+    /**
+     * Gets the pauses measured so far
+     */
+    const FDSGCPauseStats& GetStats() const { return Stats; }
+
+    /**
+     * Starts a new measurement, e.g. before and after a change to compare both
+     */
+    void Reset();
+
+private:
+    void HandlePreGarbageCollect();
+    void HandlePostGarbageCollect();
+
+    FDelegateHandle PreGarbageCollectHandle;
+    FDelegateHandle PostGarbageCollectHandle;
+
+    double CollectStartTime = 0.0;
+    FDSGCPauseStats Stats;
+};
@@ -0,0 +1,238 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSHierarchyFlattener.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
+#include "DatasmithAssetUserData.h"
+#include "Algo/Sort.h"
+
+// Logging category for the hierarchy flattener
+DEFINE_LOG_CATEGORY_STATIC(LogDSHierarchyFlattener, Log, All);
+
+namespace DSHierarchyFlattener
+{
+    static int32 GetDepth(const USceneComponent* Component)
+    {
+        int32 Depth = 0;
+        for (const USceneComponent* Parent = Component->GetAttachParent(); Parent; Parent = Parent->GetAttachParent())
+        {
+            ++Depth;
+        }
+        return Depth;
+    }
+
+    static const TCHAR* UngroupedName = TEXT("Ungrouped");
+}
+
+void FDSHierarchyFlattenReport::Log() const
+{
+    UE_LOG(LogDSHierarchyFlattener, Log, TEXT("Hierarchy flattening: %d of %d components moved into %d groups, max depth %d -> %d"),
+           NumMoved, NumComponents, NumGroups, MaxDepthBefore, MaxDepthAfter);
+}
+
+FDSHierarchyFlattener::FDSHierarchyFlattener(int32 InAssemblyDepth, FName InMetadataKey)
+    : AssemblyDepth(FMath::Max(InAssemblyDepth, 0))
+    , MetadataKey(InMetadataKey)
+{
+}
+
+int32 FDSHierarchyFlattener::GetMaxDepth(const AActor* Actor)
+{
+    int32 MaxDepth = 0;
+    if (IsValid(Actor))
+    {
+        TArray<USceneComponent*> Components;
+        Actor->GetComponents(Components);
+        for (const USceneComponent* Component : Components)
+        {
+            MaxDepth = FMath::Max(MaxDepth, DSHierarchyFlattener::GetDepth(Component));
+        }
+    }
+    return MaxDepth;
+}
+
+FDSHierarchyFlattenReport FDSHierarchyFlattener::Flatten(AActor* Actor)
+{
+    Unflatten();
+
+    FDSHierarchyFlattenReport Report;
+    USceneComponent* Root = IsValid(Actor) ? Actor->GetRootComponent() : nullptr;
+    if (!Root)
+    {
+        return Report;
+    }
+
+    TArray<USceneComponent*> Components;
+    Actor->GetComponents(Components);
+    Components.Remove(Root);
+    Report.NumComponents = Components.Num();
+
+    // Deepest first, so each re-attachment only updates the component itself and not a long chain of descendants
+    TArray<TPair<int32, USceneComponent*>> SortedComponents;
+    SortedComponents.Reserve(Components.Num());
+    for (USceneComponent* Component : Components)
+    {
+        const int32 Depth = DSHierarchyFlattener::GetDepth(Component);
+        Report.MaxDepthBefore = FMath::Max(Report.MaxDepthBefore, Depth);
+        SortedComponents.Emplace(Depth, Component);
+    }
+    Algo::SortBy(SortedComponents, [](const TPair<int32, USceneComponent*>& Entry) { return Entry.Key; }, TGreater<int32>());
+
+    // Groups are resolved against the original tree before anything moves
+    TArray<TPair<USceneComponent*, USceneComponent*>> Moves;
+    TSet<USceneComponent*> Groups;
+    for (const TPair<int32, USceneComponent*>& Entry : SortedComponents)
+    {
+        USceneComponent* Component = Entry.Value;
+        USceneComponent* Group = FindGroup(Component, Root, Entry.Key);
+        if (Group && Group != Component && Group != Component->GetAttachParent())
+        {
+            Moves.Emplace(Component, Group);
+            Groups.Add(Group);
+        }
+    }
+
+    FlattenedActor = Actor;
+    OriginalAttachments.Reserve(Moves.Num());
+    for (const TPair<USceneComponent*, USceneComponent*>& Move : Moves)
+    {
+        USceneComponent* Component = Move.Key;
+        USceneComponent* Group = Move.Value;
+
+        // A static component cannot hang below a movable one, groups follow their least mobile member
+        if (Component->Mobility < Group->Mobility)
+        {
+            if (!OriginalMobilities.ContainsByPredicate([Group](const FOriginalMobility& Original) { return Original.Group == Group; }))
+            {
+                OriginalMobilities.Add({ Group, Group->Mobility });
+            }
+            Group->SetMobility(Component->Mobility);
+        }
+
+        FOriginalAttachment& Original = OriginalAttachments.AddDefaulted_GetRef();
+        Original.Component = Component;
+        Original.Parent = Component->GetAttachParent();
+        Original.SocketName = Component->GetAttachSocketName();
+
+        Component->AttachToComponent(Group, FAttachmentTransformRules::KeepWorldTransform);
+    }
+
+    Report.NumMoved = Moves.Num();
+    Report.NumGroups = Groups.Num();
+    Report.MaxDepthAfter = GetMaxDepth(Actor);
+    return Report;
+}
+
+int32 FDSHierarchyFlattener::Unflatten()
+{
+    if (!FlattenedActor.IsValid())
+    {
+        OriginalAttachments.Reset();
+        OriginalMobilities.Reset();
+        MetadataGroups.Reset();
+        return 0;
+    }
+
+    // Reverse order re-attaches shallow components before the deep ones that may end up below them again
+    int32 NumRestored = 0;
+    for (int32 Index = OriginalAttachments.Num() - 1; Index >= 0; --Index)
+    {
+        const FOriginalAttachment& Original = OriginalAttachments[Index];
+        USceneComponent* Component = Original.Component.Get();
+        USceneComponent* Parent = Original.Parent.Get();
+        if (Component && Parent)
+        {
+            Component->AttachToComponent(Parent, FAttachmentTransformRules::KeepWorldTransform, Original.SocketName);
+            ++NumRestored;
+        }
+    }
+
+    // Assemblies get back the mobility the importer gave them once their members hang below their own parents again
+    for (const FOriginalMobility& Original : OriginalMobilities)
+    {
+        if (USceneComponent* Group = Original.Group.Get())
+        {
+            Group->SetMobility(Original.Mobility);
+        }
+    }
+
+    for (const TPair<FString, TWeakObjectPtr<USceneComponent>>& Group : MetadataGroups)
+    {
+        if (USceneComponent* GroupComponent = Group.Value.Get())
+        {
+            GroupComponent->DestroyComponent();
+        }
+    }
+
+    UE_LOG(LogDSHierarchyFlattener, Verbose, TEXT("Restored %d of %d original attachments"), NumRestored, OriginalAttachments.Num());
+
+    FlattenedActor.Reset();
+    OriginalAttachments.Reset();
+    OriginalMobilities.Reset();
+    MetadataGroups.Reset();
+    return NumRestored;
+}
+
+USceneComponent* FDSHierarchyFlattener::FindGroup(USceneComponent* Component, USceneComponent* Root, int32 Depth)
+{
+    if (MetadataKey.IsNone())
+    {
+        // Components at or above the assembly depth are groups themselves and stay where they are
+        if (Depth <= AssemblyDepth)
+        {
+            return nullptr;
+        }
+
+        USceneComponent* Assembly = Component;
+        for (int32 Level = Depth; Level > AssemblyDepth; --Level)
+        {
+            Assembly = Assembly->GetAttachParent();
+        }
+        return Assembly;
+    }
+
+    const FString Value = FindMetadataValue(Component);
+    const FString GroupName = Value.IsEmpty() ? FString(DSHierarchyFlattener::UngroupedName) : Value;
+
+    if (const TWeakObjectPtr<USceneComponent>* Existing = MetadataGroups.Find(GroupName))
+    {
+        if (Existing->IsValid())
+        {
+            return Existing->Get();
+        }
+    }
+
+    AActor* Owner = Root->GetOwner();
+    const FName ComponentName = MakeUniqueObjectName(Owner, USceneComponent::StaticClass(), *FString::Printf(TEXT("DSGroup_%s"), *GroupName));
+    USceneComponent* Group = NewObject<USceneComponent>(Owner, ComponentName, RF_Transient);
+    Group->SetMobility(EComponentMobility::Movable);
+    Group->SetupAttachment(Root);
+    Group->RegisterComponent();
+
+    MetadataGroups.Add(GroupName, Group);
+    return Group;
+}
+
+FString FDSHierarchyFlattener::FindMetadataValue(const USceneComponent* Component) const
+{
+    for (const USceneComponent* Current = Component; Current; Current = Current->GetAttachParent())
+    {
+        if (const UDatasmithAssetUserData* UserData = Current->GetAssetUserData<UDatasmithAssetUserData>())
+        {
+            if (const FString* Value = UserData->MetaData.Find(MetadataKey))
+            {
+                return *Value;
+            }
+        }
+    }
+    return FString();
+}
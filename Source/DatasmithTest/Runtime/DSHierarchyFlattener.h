@@ -0,0 +1,115 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class AActor;
+class USceneComponent;
+
+/**
+ * Summary of a flattening pass
+ */
+struct FDSHierarchyFlattenReport
+{
+    int32 NumComponents = 0;
+    int32 NumMoved = 0;
+    int32 NumGroups = 0;
+    int32 MaxDepthBefore = 0;
+    int32 MaxDepthAfter = 0;
+
+    /**
+     * Writes the report to the log
+     */
+    void Log() const;
+};
+
+/**
+ * FDSHierarchyFlattener - Bakes deep imported component trees into a shallow hierarchy
+ *
+ * Unfiltered CAD hierarchies nest components dozens of levels deep, so every transform update
+ * walks long parent chains. The flattener re-attaches every component below the group level
+ * directly to its group with its world transform preserved. Groups are either the assemblies
+ * at a fixed depth below the root, or one new scene component per value of a metadata key.
+ *
+ * The original parent of every moved component, and the original mobility of every group whose
+ * mobility had to change, are recorded. Unflatten restores the imported tree exactly, which must happen before the runtime importer applies a DirectLink update:
+ * it addresses elements by their original parents and relative transforms. Destroying the
+ * flattener without unflattening simply forgets the recorded attachments.
+ */
+class DATASMITHTEST_API FDSHierarchyFlattener
+{
+public:
+    /**
+     * @param InAssemblyDepth Depth below the root of the assemblies used as groups, 0 groups everything under the root
+     * @param InMetadataKey Metadata key whose values define the groups, None to group by assembly instead
+     */
+    FDSHierarchyFlattener(int32 InAssemblyDepth, FName InMetadataKey);
+
+    /**
+     * Flattens the components of an actor, restoring any previous flattening first
+     * @param Actor Actor owning the imported components
+     * @return Before/after metrics
+     */
+    FDSHierarchyFlattenReport Flatten(AActor* Actor);
+
+    /**
+     * Restores the original hierarchy and group mobilities, and removes the group components
+     * @return Number of components re-attached to their original parents
+     */
+    int32 Unflatten();
+
+    /**
+     * Checks whether a flattened hierarchy is currently applied
+     */
+    bool IsFlattened() const { return FlattenedActor.IsValid(); }
+
+    /**
+     * Gets the depth of the deepest component below the actor's root
+     */
+    static int32 GetMaxDepth(const AActor* Actor);
+
+private:
+    struct FOriginalAttachment
+    {
+        TWeakObjectPtr<USceneComponent> Component;
+        TWeakObjectPtr<USceneComponent> Parent;
+        FName SocketName;
+    };
+
+    /**
+     * Finds the group a component belongs to, creating metadata groups on demand
+     */
+    USceneComponent* FindGroup(USceneComponent* Component, USceneComponent* Root, int32 Depth);
+
+    /**
+     * Gets the metadata value of a component or its closest ancestor that has the key
+     */
+    FString FindMetadataValue(const USceneComponent* Component) const;
+
+    int32 AssemblyDepth;
+    FName MetadataKey;
+
+    struct FOriginalMobility
+    {
+        TWeakObjectPtr<USceneComponent> Group;
+        EComponentMobility::Type Mobility = EComponentMobility::Movable;
+    };
+
+    TWeakObjectPtr<AActor> FlattenedActor;
+    TArray<FOriginalAttachment> OriginalAttachments;
+    TArray<FOriginalMobility> OriginalMobilities;
+
+    /** Scene components created for metadata groups, keyed by metadata value */
+    TMap<FString, TWeakObjectPtr<USceneComponent>> MetadataGroups;
+};
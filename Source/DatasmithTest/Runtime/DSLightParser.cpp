@@ -0,0 +1,254 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSLightParser.h"
+#include "Json.h"
+
+// Logging category for the light parser
+DEFINE_LOG_CATEGORY_STATIC(LogDSLightParser, Log, All);
+
+FDSRhinoLightData FDSLightParser::ParseJsonLightData(const FString& JsonData)
+{
+    FDSRhinoLightData Result;
+
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonData);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        UE_LOG(LogDSLightParser, Error, TEXT("Failed to parse JSON data from Rhino"));
+        return Result;
+    }
+
+    Result.EventType = JsonObject->GetStringField(TEXT("event"));
+    Result.LightCount = JsonObject->GetIntegerField(TEXT("lightCount"));
+
+    UE_LOG(LogDSLightParser, Verbose, TEXT("Parsing Rhino event: %s with %d lights"), *Result.EventType, Result.LightCount);
+
+    const TArray<TSharedPtr<FJsonValue>>* LightsArray;
+    if (JsonObject->TryGetArrayField(TEXT("lights"), LightsArray))
+    {
+        Result.Lights.Reserve(LightsArray->Num());
+        for (const TSharedPtr<FJsonValue>& LightValue : *LightsArray)
+        {
+            TSharedPtr<FJsonObject> LightObject = LightValue->AsObject();
+            if (LightObject.IsValid())
+            {
+                FDSLightData LightData = ParseJsonLight(LightObject);
+                if (LightData.bIsValid)
+                {
+                    Result.Lights.Add(MoveTemp(LightData));
+                }
+            }
+        }
+    }
+
+    // The event is only trusted when every announced light parsed
+    Result.bIsValid = (Result.Lights.Num() == Result.LightCount);
+    if (!Result.bIsValid)
+    {
+        UE_LOG(LogDSLightParser, Error, TEXT("Light count mismatch: expected %d, parsed %d"), Result.LightCount, Result.Lights.Num());
+    }
+
+    return Result;
+}
+
+FDSLightData FDSLightParser::ParseJsonLight(const TSharedPtr<FJsonObject>& LightObject)
+{
+    FDSLightData Result;
+
+    if (!LightObject.IsValid())
+    {
+        return Result;
+    }
+
+    Result.LightType = LightObject->GetStringField(TEXT("type"));
+
+    // Rhino location in meters, Y negated for Unreal's left-handed axes
+    const TSharedPtr<FJsonObject>* LocationObject;
+    if (LightObject->TryGetObjectField(TEXT("location"), LocationObject) && LocationObject->IsValid())
+    {
+        const float RhinoX = (*LocationObject)->GetNumberField(TEXT("x"));
+        const float RhinoY = (*LocationObject)->GetNumberField(TEXT("y"));
+        const float RhinoZ = (*LocationObject)->GetNumberField(TEXT("z"));
+
+        Result.Location = FVector(RhinoX * 100.0f, -RhinoY * 100.0f, RhinoZ * 100.0f);
+    }
+
+    // Rotation in degrees, yaw negated for the same axis flip
+    const TSharedPtr<FJsonObject>* RotationObject;
+    if (LightObject->TryGetObjectField(TEXT("rotation"), RotationObject) && RotationObject->IsValid())
+    {
+        const float Pitch = (*RotationObject)->GetNumberField(TEXT("pitch"));
+        const float Yaw = (*RotationObject)->GetNumberField(TEXT("yaw"));
+        const float Roll = (*RotationObject)->GetNumberField(TEXT("roll"));
+
+        Result.Rotation = FRotator(Pitch, -Yaw, Roll);
+    }
+
+    Result.Intensity = LightObject->GetNumberField(TEXT("intensity"));
+
+    // Color components in the 0-255 range
+    const TSharedPtr<FJsonObject>* ColorObject;
+    if (LightObject->TryGetObjectField(TEXT("color"), ColorObject) && ColorObject->IsValid())
+    {
+        const int32 R = (*ColorObject)->GetIntegerField(TEXT("r"));
+        const int32 G = (*ColorObject)->GetIntegerField(TEXT("g"));
+        const int32 B = (*ColorObject)->GetIntegerField(TEXT("b"));
+
+        Result.Color = FLinearColor(R / 255.0f, G / 255.0f, B / 255.0f, 1.0f);
+    }
+
+    const TSharedPtr<FJsonObject>* SpotLightObject;
+    if (LightObject->TryGetObjectField(TEXT("spotLight"), SpotLightObject) && SpotLightObject->IsValid())
+    {
+        Result.InnerAngle = (*SpotLightObject)->GetNumberField(TEXT("innerAngle"));
+        Result.OuterAngle = (*SpotLightObject)->GetNumberField(TEXT("outerAngle"));
+    }
+
+    Result.bIsValid = true;
+    UE_LOG(LogDSLightParser, VeryVerbose, TEXT("Parsed %s light at location %s with rotation %s"),
+           *Result.LightType, *Result.Location.ToString(), *Result.Rotation.ToString());
+
+    return Result;
+}
+
+FDSLightData FDSLightParser::ParseLightLine(const FString& Line)
+{
+    FDSLightData Result;
+
+    // Split at spaces outside parentheses
+    TArray<FString> Components;
+    FString CurrentComponent;
+    bool bInParentheses = false;
+
+    for (const TCHAR Char : Line)
+    {
+        if (Char == TEXT('('))
+        {
+            bInParentheses = true;
+            CurrentComponent += Char;
+        }
+        else if (Char == TEXT(')'))
+        {
+            bInParentheses = false;
+            CurrentComponent += Char;
+        }
+        else if (Char == TEXT(' ') && !bInParentheses)
+        {
+            if (!CurrentComponent.IsEmpty())
+            {
+                Components.Add(CurrentComponent.TrimStartAndEnd());
+                CurrentComponent.Reset();
+            }
+        }
+        else
+        {
+            CurrentComponent += Char;
+        }
+    }
+
+    if (!CurrentComponent.IsEmpty())
+    {
+        Components.Add(CurrentComponent.TrimStartAndEnd());
+    }
+
+    // Expected format: Type Location Rotation Intensity Color [InnerAngle OuterAngle]
+    if (Components.Num() < 5)
+    {
+        UE_LOG(LogDSLightParser, Warning, TEXT("Not enough components in line. Found %d, expected at least 5"), Components.Num());
+        return Result;
+    }
+
+    Result.LightType = Components[0];
+
+    const FVector Location = ParseVectorString(Components[1]);
+    if (Location == FVector::ZeroVector && Components[1] != TEXT("(0,0,0)"))
+    {
+        UE_LOG(LogDSLightParser, Warning, TEXT("Failed to parse location: %s"), *Components[1]);
+        return Result;
+    }
+
+    // Same conversion as the JSON format
+    Result.Location = FVector(Location.X * 100.0f, -Location.Y * 100.0f, Location.Z * 100.0f);
+    Result.Rotation = ParseRotationString(Components[2]);
+    Result.Intensity = FCString::Atof(*Components[3]);
+    Result.Color = ParseColorString(Components[4]);
+
+    if (Result.LightType == TEXT("Spot") && Components.Num() >= 7)
+    {
+        Result.InnerAngle = FCString::Atof(*Components[5].Replace(TEXT("°"), TEXT("")));
+        Result.OuterAngle = FCString::Atof(*Components[6].Replace(TEXT("°"), TEXT("")));
+    }
+
+    Result.bIsValid = true;
+    return Result;
+}
+
+FVector FDSLightParser::ParseVectorString(const FString& VectorStr)
+{
+    FString CleanStr = VectorStr.Replace(TEXT("("), TEXT("")).Replace(TEXT(")"), TEXT(""));
+
+    TArray<FString> VectorParts;
+    CleanStr.ParseIntoArray(VectorParts, TEXT(","));
+
+    if (VectorParts.Num() != 3)
+    {
+        UE_LOG(LogDSLightParser, Warning, TEXT("Invalid vector format: %s"), *VectorStr);
+        return FVector::ZeroVector;
+    }
+
+    return FVector(
+        FCString::Atof(*VectorParts[0].TrimStartAndEnd()),
+        FCString::Atof(*VectorParts[1].TrimStartAndEnd()),
+        FCString::Atof(*VectorParts[2].TrimStartAndEnd()));
+}
+
+FRotator FDSLightParser::ParseRotationString(const FString& RotationStr)
+{
+    FString CleanStr = RotationStr.Replace(TEXT("("), TEXT("")).Replace(TEXT(")"), TEXT("")).Replace(TEXT("°"), TEXT(""));
+
+    TArray<FString> RotationParts;
+    CleanStr.ParseIntoArray(RotationParts, TEXT(","));
+
+    if (RotationParts.Num() != 3)
+    {
+        UE_LOG(LogDSLightParser, Warning, TEXT("Invalid rotation format: %s"), *RotationStr);
+        return FRotator::ZeroRotator;
+    }
+
+    const float Pitch = FCString::Atof(*RotationParts[0].TrimStartAndEnd());
+    const float Yaw = FCString::Atof(*RotationParts[1].TrimStartAndEnd());
+    const float Roll = FCString::Atof(*RotationParts[2].TrimStartAndEnd());
+
+    // Same conversion as the JSON format
+    return FRotator(Pitch, -Yaw, Roll);
+}
+
+FLinearColor FDSLightParser::ParseColorString(const FString& ColorStr)
+{
+    FString CleanStr = ColorStr.Replace(TEXT("RGB("), TEXT("")).Replace(TEXT(")"), TEXT(""));
+
+    TArray<FString> ColorParts;
+    CleanStr.ParseIntoArray(ColorParts, TEXT(","));
+
+    if (ColorParts.Num() != 3)
+    {
+        UE_LOG(LogDSLightParser, Warning, TEXT("Invalid color format: %s, using white"), *ColorStr);
+        return FLinearColor::White;
+    }
+
+    return FLinearColor(
+        FCString::Atof(*ColorParts[0].TrimStartAndEnd()) / 255.0f,
+        FCString::Atof(*ColorParts[1].TrimStartAndEnd()) / 255.0f,
+        FCString::Atof(*ColorParts[2].TrimStartAndEnd()) / 255.0f,
+        1.0f);
+}
@@ -0,0 +1,86 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class FJsonObject;
+
+/**
+ * One light received from Rhino, already converted to Unreal units and axes
+ */
+struct FDSLightData
+{
+    bool bIsValid = false;
+    FString LightType;
+    FVector Location = FVector::ZeroVector;
+    FRotator Rotation = FRotator::ZeroRotator;
+    float Intensity = 1.0f;
+    FLinearColor Color = FLinearColor::White;
+    float InnerAngle = 0.0f;  // For spot lights
+    float OuterAngle = 45.0f; // For spot lights
+};
+
+/**
+ * One light event received from Rhino
+ */
+struct FDSRhinoLightData
+{
+    FString EventType;
+    FString Timestamp;
+    int32 LightCount = 0;
+    TArray<FDSLightData> Lights;
+    bool bIsValid = false;
+};
+
+/**
+ * FDSLightParser - Parses the light sync formats sent by Rhino
+ *
+ * Pure functions without a world or actor, so the light syncer and the parser benchmark share
+ * the same code. Rhino coordinates (meters, X right, Y forward) are converted to Unreal
+ * coordinates (centimeters, X forward, Y right) while parsing.
+ */
+class DATASMITHTEST_API FDSLightParser
+{
+public:
+    /**
+     * Parses a JSON light event received over TCP
+     * @return Parsed event, invalid if the JSON is malformed or the light count does not match
+     */
+    static FDSRhinoLightData ParseJsonLightData(const FString& JsonData);
+
+    /**
+     * Parses one light object of a JSON light event
+     */
+    static FDSLightData ParseJsonLight(const TSharedPtr<FJsonObject>& LightObject);
+
+    /**
+     * Parses one line of the legacy text format: Type (x,y,z) (pitch°,yaw°,roll°) Intensity RGB(r,g,b) [Inner° Outer°]
+     */
+    static FDSLightData ParseLightLine(const FString& Line);
+
+    /**
+     * Parses a legacy vector: (x,y,z), returns zero when malformed
+     */
+    static FVector ParseVectorString(const FString& VectorStr);
+
+    /**
+     * Parses a legacy rotation: (pitch°,yaw°,roll°), converted to Unreal axes
+     */
+    static FRotator ParseRotationString(const FString& RotationStr);
+
+    /**
+     * Parses a legacy color: RGB(r,g,b) with 0-255 components, returns white when malformed
+     */
+    static FLinearColor ParseColorString(const FString& ColorStr);
+};
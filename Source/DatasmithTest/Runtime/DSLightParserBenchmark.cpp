@@ -0,0 +1,242 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSLightParserBenchmark.h"
+#include "DSLightParser.h"
+#include "DSSceneGenerator.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTLS.h"
+#include <atomic>
+
+// Logging category for the light parser benchmark
+DEFINE_LOG_CATEGORY_STATIC(LogDSLightParserBenchmark, Log, All);
+
+namespace DSLightParserBenchmark
+{
+    /**
+     * Forwards to the real allocator and counts what the measuring thread requests
+     */
+    class FCountingMalloc final : public FMalloc
+    {
+    public:
+        explicit FCountingMalloc(FMalloc* InInner)
+            : Inner(InInner)
+        {
+        }
+
+        /**
+         * Clears the counters and counts the calling thread from now on
+         */
+        void Reset()
+        {
+            ThreadId = FPlatformTLS::GetCurrentThreadId();
+            Bytes = 0;
+            Allocations = 0;
+        }
+
+        virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+        {
+            Record(Count);
+            return Inner->Malloc(Count, Alignment);
+        }
+
+        virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+        {
+            Record(Count);
+            return Inner->TryMalloc(Count, Alignment);
+        }
+
+        virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+        {
+            Record(Count);
+            return Inner->Realloc(Original, Count, Alignment);
+        }
+
+        virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+        {
+            Record(Count);
+            return Inner->TryRealloc(Original, Count, Alignment);
+        }
+
+        virtual void Free(void* Original) override { Inner->Free(Original); }
+        virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+        virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+        virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+        virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+        virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+        virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+        virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+        virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+        int64 GetBytes() const { return Bytes.load(); }
+        int64 GetAllocations() const { return Allocations.load(); }
+
+    private:
+        void Record(SIZE_T Count)
+        {
+            if (FPlatformTLS::GetCurrentThreadId() == ThreadId.load(std::memory_order_relaxed))
+            {
+                Bytes += (int64)Count;
+                ++Allocations;
+            }
+        }
+
+        FMalloc* Inner;
+        std::atomic<uint32> ThreadId{ 0 };
+        std::atomic<int64> Bytes{ 0 };
+        std::atomic<int64> Allocations{ 0 };
+    };
+
+#if !PLATFORM_USES_FIXED_GMalloc_CLASS
+    /**
+     * Gets the counting proxy of the real allocator; never destroyed, since another thread may
+     * still be inside it right after it is swapped out
+     */
+    static FCountingMalloc* GetCountingMalloc()
+    {
+        static FCountingMalloc* CountingMalloc = new FCountingMalloc(GMalloc);
+        return CountingMalloc;
+    }
+#endif
+
+    /**
+     * Times a kernel over all iterations, then counts the allocations of one more pass
+     * @param Kernel Runs one pass and returns the number of operations it performed
+     */
+    template <typename KernelType>
+    static FDSLightParserBenchmarkResult Measure(const TCHAR* Name, int32 NumIterations, KernelType&& Kernel)
+    {
+        FDSLightParserBenchmarkResult Result;
+        Result.Kernel = Name;
+
+        // Warm-up pass, so first-use allocations of the JSON reader and string tables are not counted
+        Kernel();
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            Result.NumOps += Kernel();
+        }
+        const uint64 ElapsedCycles = FPlatformTime::Cycles64() - StartCycles;
+        Result.NanosecondsPerOp = FPlatformTime::ToSeconds64(ElapsedCycles) * 1.0e9 / FMath::Max<double>(Result.NumOps, 1.0);
+
+#if PLATFORM_USES_FIXED_GMalloc_CLASS
+        // FMemory calls the allocator directly, a proxy would never see the allocations
+        Result.BytesPerOp = -1.0;
+        Result.AllocationsPerOp = -1.0;
+#else
+        // Allocations are counted in one extra pass, so the proxy does not skew the timing
+        FCountingMalloc* const CountingMalloc = GetCountingMalloc();
+        FMalloc* const PreviousMalloc = GMalloc;
+        CountingMalloc->Reset();
+        GMalloc = CountingMalloc;
+
+        const double NumCountedOps = FMath::Max<double>(Kernel(), 1.0);
+
+        GMalloc = PreviousMalloc;
+        Result.BytesPerOp = CountingMalloc->GetBytes() / NumCountedOps;
+        Result.AllocationsPerOp = CountingMalloc->GetAllocations() / NumCountedOps;
+#endif
+
+        return Result;
+    }
+}
+
+TArray<FDSLightParserBenchmarkResult> FDSLightParserBenchmark::Run(const FDSLightParserBenchmarkSettings& Settings)
+{
+    check(IsInGameThread());
+
+    const int32 NumLights = FMath::Max(Settings.NumLights, 1);
+    const int32 NumIterations = FMath::Max(Settings.NumIterations, 1);
+
+    const TArray<FDSSyntheticLight> Lights = FDSSceneGenerator::GenerateLights(NumLights, 1);
+    const FString JsonEvent = FDSSceneGenerator::MakeLightEvent(Lights);
+    const TArray<FString> LegacyLines = FDSSceneGenerator::MakeLegacyLightLines(Lights);
+
+    // Field strings of the legacy format, taken from the generated lines
+    TArray<FString> Vectors;
+    TArray<FString> Rotations;
+    TArray<FString> Colors;
+    for (const FString& Line : LegacyLines)
+    {
+        TArray<FString> Fields;
+        Line.ParseIntoArrayWS(Fields);
+        Vectors.Add(Fields[1]);
+        Rotations.Add(Fields[2]);
+        Colors.Add(Fields[4]);
+    }
+
+    // Folded into a checksum so the optimizer cannot drop the parsing
+    double Checksum = 0.0;
+
+    TArray<FDSLightParserBenchmarkResult> Results;
+    Results.Add(DSLightParserBenchmark::Measure(TEXT("JSON event (per light)"), NumIterations, [&]()
+    {
+        const FDSRhinoLightData Event = FDSLightParser::ParseJsonLightData(JsonEvent);
+        Checksum += Event.Lights.Num() > 0 ? Event.Lights.Last().Location.X : 0.0;
+        return (int64)Event.Lights.Num();
+    }));
+
+    Results.Add(DSLightParserBenchmark::Measure(TEXT("Legacy line (per light)"), NumIterations, [&]()
+    {
+        for (const FString& Line : LegacyLines)
+        {
+            Checksum += FDSLightParser::ParseLightLine(Line).Intensity;
+        }
+        return (int64)LegacyLines.Num();
+    }));
+
+    Results.Add(DSLightParserBenchmark::Measure(TEXT("Vector string"), NumIterations, [&]()
+    {
+        for (const FString& Vector : Vectors)
+        {
+            Checksum += FDSLightParser::ParseVectorString(Vector).X;
+        }
+        return (int64)Vectors.Num();
+    }));
+
+    Results.Add(DSLightParserBenchmark::Measure(TEXT("Rotation string"), NumIterations, [&]()
+    {
+        for (const FString& Rotation : Rotations)
+        {
+            Checksum += FDSLightParser::ParseRotationString(Rotation).Yaw;
+        }
+        return (int64)Rotations.Num();
+    }));
+
+    Results.Add(DSLightParserBenchmark::Measure(TEXT("Color string"), NumIterations, [&]()
+    {
+        for (const FString& Color : Colors)
+        {
+            Checksum += FDSLightParser::ParseColorString(Color).R;
+        }
+        return (int64)Colors.Num();
+    }));
+
+    UE_LOG(LogDSLightParserBenchmark, Verbose, TEXT("Checksum: %f"), Checksum);
+    return Results;
+}
+
+void FDSLightParserBenchmark::LogResults(const TArray<FDSLightParserBenchmarkResult>& Results)
+{
+    UE_LOG(LogDSLightParserBenchmark, Display, TEXT("%-26s %12s %12s %12s %12s"), TEXT("Kernel"), TEXT("Ops"), TEXT("ns/op"), TEXT("bytes/op"), TEXT("allocs/op"));
+    for (const FDSLightParserBenchmarkResult& Result : Results)
+    {
+        if (Result.BytesPerOp < 0.0)
+        {
+            UE_LOG(LogDSLightParserBenchmark, Display, TEXT("%-26s %12lld %12.1f %12s %12s"), *Result.Kernel, Result.NumOps, Result.NanosecondsPerOp, TEXT("n/a"), TEXT("n/a"));
+        }
+        else
+        {
+            UE_LOG(LogDSLightParserBenchmark, Display, TEXT("%-26s %12lld %12.1f %12.1f %12.2f"), *Result.Kernel, Result.NumOps, Result.NanosecondsPerOp, Result.BytesPerOp, Result.AllocationsPerOp);
+        }
+    }
+}
@@ -0,0 +1,63 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Tunables of the light parser benchmark
+ */
+struct FDSLightParserBenchmarkSettings
+{
+    /** Lights per generated event and legacy file */
+    int32 NumLights = 64;
+
+    /** Timed passes over the generated input, after one warm-up pass */
+    int32 NumIterations = 200;
+};
+
+/**
+ * Cost of one parser kernel
+ */
+struct FDSLightParserBenchmarkResult
+{
+    FString Kernel;
+    int64 NumOps = 0;
+    double NanosecondsPerOp = 0.0;
+
+    /** Bytes and allocations requested from the allocator by the benchmark thread, negative when they could not be counted */
+    double BytesPerOp = 0.0;
+    double AllocationsPerOp = 0.0;
+};
+
+/**
+ * FDSLightParserBenchmark - Microbenchmarks of the light sync parsers
+ *
+ * Runs FDSLightParser over generated Rhino events and legacy light files and reports the time
+ * and allocations per light (per call for the legacy field parsers). Allocations are counted in
+ * one extra pass of each kernel with a counting proxy in front of GMalloc that only sees the
+ * calling thread. Needs no world, so it runs from the DSLightParserBenchmark commandlet in a few
+ * seconds as well as from ds.Bench.LightParser in a running app.
+ */
+class DATASMITHTEST_API FDSLightParserBenchmark
+{
+public:
+    /**
+     * Runs every kernel, must run on the game thread
+     */
+    static TArray<FDSLightParserBenchmarkResult> Run(const FDSLightParserBenchmarkSettings& Settings);
+
+    /**
+     * Writes results to the log as a table
+     */
+    static void LogResults(const TArray<FDSLightParserBenchmarkResult>& Results);
+};
@@ -0,0 +1,968 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSMeshOptimizer.h"
+#include "DSStaticMeshRebuild.h"
+#include "DSTaskScheduler.h"
+#include "DSMeshWorkerPool.h"
+#include "Algo/StableSort.h"
+#include "Async/ParallelFor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+// Logging category for the mesh optimizer
+DEFINE_LOG_CATEGORY_STATIC(LogDSMeshOptimizer, Log, All);
+
+namespace DSMeshOptimizer
+{
+    // Forsyth vertex cache optimization parameters
+    static constexpr int32 MaxCacheSize = 32;
+    static constexpr float CacheDecayPower = 1.5f;
+    static constexpr float LastTriangleScore = 0.75f;
+    static constexpr float ValenceBoostScale = 2.0f;
+    static constexpr float ValenceBoostPower = 0.5f;
+
+    static float ComputeVertexScore(int32 CachePosition, int32 RemainingValence)
+    {
+        if (RemainingValence == 0)
+        {
+            return -1.0f;
+        }
+
+        float Score = 0.0f;
+        if (CachePosition >= 0)
+        {
+            // The three vertices of the last triangle get a fixed score so the next triangle does not just reuse its edge
+            Score = CachePosition < 3
+                ? LastTriangleScore
+                : FMath::Pow(1.0f - (float)(CachePosition - 3) / (MaxCacheSize - 3), CacheDecayPower);
+        }
+
+        // Boost vertices with few remaining triangles so they are finished off instead of left as stragglers
+        return Score + ValenceBoostScale * FMath::Pow((float)RemainingValence, -ValenceBoostPower);
+    }
+
+    // Reorders a per vertex array so entry i holds the old entry OldIndexOf[i]
+    template<typename T>
+    static void PermuteVertices(TArray<T>& Array, const TArray<int32>& OldIndexOf, int32 Stride = 1)
+    {
+        if (Array.Num() == 0)
+        {
+            return;
+        }
+
+        TArray<T> Permuted;
+        Permuted.SetNumUninitialized(OldIndexOf.Num() * Stride);
+        for (int32 NewIndex = 0; NewIndex < OldIndexOf.Num(); ++NewIndex)
+        {
+            for (int32 Element = 0; Element < Stride; ++Element)
+            {
+                Permuted[NewIndex * Stride + Element] = Array[OldIndexOf[NewIndex] * Stride + Element];
+            }
+        }
+        Array = MoveTemp(Permuted);
+    }
+
+    // Serializes an array of plain values as raw memory, much faster than per element for large vertex buffers
+    template<typename T>
+    static void SerializeRaw(FArchive& Ar, TArray<T>& Array)
+    {
+        int32 Num = Array.Num();
+        Ar << Num;
+        if (Ar.IsLoading())
+        {
+            if (Num < 0 || (int64)Num * sizeof(T) > Ar.TotalSize() - Ar.Tell())
+            {
+                Ar.SetError();
+                return;
+            }
+            Array.SetNumUninitialized(Num);
+        }
+        Ar.Serialize(Array.GetData(), (int64)Num * sizeof(T));
+    }
+
+    static void SerializeMesh(FArchive& Ar, FDSMeshBuffers& Mesh)
+    {
+        SerializeRaw(Ar, Mesh.Positions);
+        SerializeRaw(Ar, Mesh.TangentX);
+        SerializeRaw(Ar, Mesh.TangentY);
+        SerializeRaw(Ar, Mesh.TangentZ);
+        SerializeRaw(Ar, Mesh.UVs);
+        Ar << Mesh.NumTexCoords;
+        SerializeRaw(Ar, Mesh.Colors);
+        SerializeRaw(Ar, Mesh.Indices);
+        SerializeRaw(Ar, Mesh.Sections);
+    }
+}
+
+void FDSMeshOptimizeReport::Append(const FDSMeshOptimizeReport& Other)
+{
+    NumLODsOptimized += Other.NumLODsOptimized;
+    NumLODsSkipped += Other.NumLODsSkipped;
+    VerticesBefore += Other.VerticesBefore;
+    VerticesAfter += Other.VerticesAfter;
+    TrianglesBefore += Other.TrianglesBefore;
+    TrianglesAfter += Other.TrianglesAfter;
+    CacheMissesBefore += Other.CacheMissesBefore;
+    CacheMissesAfter += Other.CacheMissesAfter;
+}
+
+void FDSMeshOptimizeReport::Log() const
+{
+    const double ACMRBefore = TrianglesBefore > 0 ? (double)CacheMissesBefore / TrianglesBefore : 0.0;
+    const double ACMRAfter = TrianglesAfter > 0 ? (double)CacheMissesAfter / TrianglesAfter : 0.0;
+
+    UE_LOG(LogDSMeshOptimizer, Log, TEXT("=== Mesh Optimization Report ==="));
+    UE_LOG(LogDSMeshOptimizer, Log, TEXT("Meshes: %d, LODs optimized: %d, LODs skipped: %d"), NumMeshes, NumLODsOptimized, NumLODsSkipped);
+    UE_LOG(LogDSMeshOptimizer, Log, TEXT("Vertices: %lld -> %lld, Triangles: %lld -> %lld"), VerticesBefore, VerticesAfter, TrianglesBefore, TrianglesAfter);
+    UE_LOG(LogDSMeshOptimizer, Log, TEXT("ACMR: %.3f -> %.3f"), ACMRBefore, ACMRAfter);
+}
+
+FDSMeshOptimizeReport FDSMeshOptimizer::Optimize(FDSMeshBuffers& Mesh, const FDSMeshOptimizeSettings& Settings)
+{
+    FDSMeshOptimizeReport Report;
+    Report.NumLODsOptimized = 1;
+    Report.VerticesBefore = Mesh.GetNumVertices();
+    Report.TrianglesBefore = Mesh.Indices.Num() / 3;
+    Report.CacheMissesBefore = CountCacheMisses(Mesh.Indices, Settings.CacheSize);
+
+    WeldVertices(Mesh, Settings);
+    RemoveDegenerateTriangles(Mesh);
+
+    // Triangles may only move within their section, sections map to material draws
+    for (const FDSMeshBuffers::FSectionRange& Section : Mesh.Sections)
+    {
+        TArrayView<uint32> SectionIndices(Mesh.Indices.GetData() + Section.FirstIndex, Section.NumTriangles * 3);
+        OptimizeVertexCache(SectionIndices, Mesh.GetNumVertices());
+        OptimizeOverdraw(SectionIndices, Mesh.Positions, Mesh.TangentZ, Settings.CacheSize);
+    }
+
+    CompactVertices(Mesh);
+
+    Report.VerticesAfter = Mesh.GetNumVertices();
+    Report.TrianglesAfter = Mesh.Indices.Num() / 3;
+    Report.CacheMissesAfter = CountCacheMisses(Mesh.Indices, Settings.CacheSize);
+    return Report;
+}
+
+int32 FDSMeshOptimizer::CountCacheMisses(TArrayView<const uint32> Indices, int32 CacheSize)
+{
+    TArray<uint32, TInlineAllocator<32>> Cache;
+    int32 Head = 0;
+    int32 NumMisses = 0;
+
+    for (const uint32 Index : Indices)
+    {
+        if (!Cache.Contains(Index))
+        {
+            ++NumMisses;
+            if (Cache.Num() < CacheSize)
+            {
+                Cache.Add(Index);
+            }
+            else
+            {
+                Cache[Head] = Index;
+                Head = (Head + 1) % CacheSize;
+            }
+        }
+    }
+
+    return NumMisses;
+}
+
+void FDSMeshOptimizer::WeldVertices(FDSMeshBuffers& Mesh, const FDSMeshOptimizeSettings& Settings)
+{
+    const int32 NumVertices = Mesh.GetNumVertices();
+    const float Tolerance = FMath::Max(Settings.WeldTolerance, UE_KINDA_SMALL_NUMBER);
+    const float ToleranceSquared = Tolerance * Tolerance;
+    const float MinNormalCosine = FMath::Cos(FMath::DegreesToRadians(Settings.WeldNormalTolerance));
+
+    auto CanWeld = [&Mesh, ToleranceSquared, MinNormalCosine, &Settings](int32 A, int32 B)
+    {
+        if (FVector3f::DistSquared(Mesh.Positions[A], Mesh.Positions[B]) > ToleranceSquared
+            || FVector3f::DotProduct(Mesh.TangentZ[A], Mesh.TangentZ[B]) < MinNormalCosine
+            || FVector3f::DotProduct(Mesh.TangentY[A], Mesh.TangentY[B]) <= 0.0f)
+        {
+            return false;
+        }
+
+        for (int32 UVIndex = 0; UVIndex < Mesh.NumTexCoords; ++UVIndex)
+        {
+            const FVector2f Delta = Mesh.UVs[A * Mesh.NumTexCoords + UVIndex] - Mesh.UVs[B * Mesh.NumTexCoords + UVIndex];
+            if (Delta.GetAbsMax() > Settings.WeldUVTolerance)
+            {
+                return false;
+            }
+        }
+
+        return Mesh.Colors.Num() == 0 || Mesh.Colors[A] == Mesh.Colors[B];
+    };
+
+    // Spatial hash of representative vertices, one tolerance per cell so neighbors are within one cell
+    TMap<FIntVector, TArray<int32>> Grid;
+    Grid.Reserve(NumVertices);
+
+    TArray<int32> Remap;
+    Remap.SetNumUninitialized(NumVertices);
+
+    for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+    {
+        const FVector3f& Position = Mesh.Positions[VertexIndex];
+        const FIntVector Cell(FMath::FloorToInt(Position.X / Tolerance), FMath::FloorToInt(Position.Y / Tolerance), FMath::FloorToInt(Position.Z / Tolerance));
+
+        Remap[VertexIndex] = VertexIndex;
+        for (int32 Z = -1; Z <= 1 && Remap[VertexIndex] == VertexIndex; ++Z)
+        {
+            for (int32 Y = -1; Y <= 1 && Remap[VertexIndex] == VertexIndex; ++Y)
+            {
+                for (int32 X = -1; X <= 1 && Remap[VertexIndex] == VertexIndex; ++X)
+                {
+                    if (const TArray<int32>* Bucket = Grid.Find(Cell + FIntVector(X, Y, Z)))
+                    {
+                        for (const int32 Candidate : *Bucket)
+                        {
+                            if (CanWeld(Candidate, VertexIndex))
+                            {
+                                Remap[VertexIndex] = Candidate;
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        if (Remap[VertexIndex] == VertexIndex)
+        {
+            Grid.FindOrAdd(Cell).Add(VertexIndex);
+        }
+    }
+
+    // Merged vertices become unreferenced and are dropped by CompactVertices
+    for (uint32& Index : Mesh.Indices)
+    {
+        Index = Remap[Index];
+    }
+}
+
+void FDSMeshOptimizer::RemoveDegenerateTriangles(FDSMeshBuffers& Mesh)
+{
+    TArray<uint32> NewIndices;
+    NewIndices.Reserve(Mesh.Indices.Num());
+
+    for (FDSMeshBuffers::FSectionRange& Section : Mesh.Sections)
+    {
+        const uint32 NewFirstIndex = NewIndices.Num();
+        for (uint32 Triangle = 0; Triangle < Section.NumTriangles; ++Triangle)
+        {
+            const uint32* Corners = Mesh.Indices.GetData() + Section.FirstIndex + Triangle * 3;
+            if (Corners[0] != Corners[1] && Corners[1] != Corners[2] && Corners[0] != Corners[2])
+            {
+                NewIndices.Append(Corners, 3);
+            }
+        }
+
+        Section.FirstIndex = NewFirstIndex;
+        Section.NumTriangles = (NewIndices.Num() - NewFirstIndex) / 3;
+    }
+
+    Mesh.Indices = MoveTemp(NewIndices);
+}
+
+void FDSMeshOptimizer::OptimizeVertexCache(TArrayView<uint32> Indices, int32 NumVertices)
+{
+    using namespace DSMeshOptimizer;
+
+    const int32 NumTriangles = Indices.Num() / 3;
+    if (NumTriangles <= 1)
+    {
+        return;
+    }
+
+    // Triangle adjacency per vertex; the live part of each list shrinks as triangles are emitted
+    TArray<int32> RemainingValence;
+    RemainingValence.SetNumZeroed(NumVertices);
+    for (const uint32 Index : Indices)
+    {
+        ++RemainingValence[Index];
+    }
+
+    TArray<int32> AdjacencyOffset;
+    AdjacencyOffset.SetNumUninitialized(NumVertices + 1);
+    AdjacencyOffset[0] = 0;
+    for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+    {
+        AdjacencyOffset[VertexIndex + 1] = AdjacencyOffset[VertexIndex] + RemainingValence[VertexIndex];
+    }
+
+    TArray<int32> Adjacency;
+    Adjacency.SetNumUninitialized(Indices.Num());
+    {
+        TArray<int32> Cursor(AdjacencyOffset.GetData(), NumVertices);
+        for (int32 Corner = 0; Corner < Indices.Num(); ++Corner)
+        {
+            Adjacency[Cursor[Indices[Corner]]++] = Corner / 3;
+        }
+    }
+
+    TArray<int32> CachePosition;
+    CachePosition.Init(INDEX_NONE, NumVertices);
+
+    TArray<float> VertexScore;
+    VertexScore.SetNumUninitialized(NumVertices);
+    for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+    {
+        VertexScore[VertexIndex] = ComputeVertexScore(INDEX_NONE, RemainingValence[VertexIndex]);
+    }
+
+    TArray<float> TriangleScore;
+    TriangleScore.SetNumUninitialized(NumTriangles);
+    TBitArray<> TriangleAdded(false, NumTriangles);
+
+    int32 BestTriangle = 0;
+    for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+    {
+        TriangleScore[Triangle] = VertexScore[Indices[Triangle * 3]] + VertexScore[Indices[Triangle * 3 + 1]] + VertexScore[Indices[Triangle * 3 + 2]];
+        if (TriangleScore[Triangle] > TriangleScore[BestTriangle])
+        {
+            BestTriangle = Triangle;
+        }
+    }
+
+    TArray<uint32> Output;
+    Output.Reserve(Indices.Num());
+
+    int32 Cache[MaxCacheSize + 3];
+    int32 CacheCount = 0;
+    int32 ScanCursor = 0;
+
+    for (int32 Emitted = 0; Emitted < NumTriangles; ++Emitted)
+    {
+        // Nothing adjacent to the cache is left, continue with the next unprocessed triangle
+        if (BestTriangle == INDEX_NONE)
+        {
+            while (TriangleAdded[ScanCursor])
+            {
+                ++ScanCursor;
+            }
+            BestTriangle = ScanCursor;
+        }
+
+        TriangleAdded[BestTriangle] = true;
+        const uint32* Corners = &Indices[BestTriangle * 3];
+        Output.Append(Corners, 3);
+
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            const int32 VertexIndex = Corners[Corner];
+            const int32 Begin = AdjacencyOffset[VertexIndex];
+            const int32 End = Begin + RemainingValence[VertexIndex];
+            for (int32 Slot = Begin; Slot < End; ++Slot)
+            {
+                if (Adjacency[Slot] == BestTriangle)
+                {
+                    Adjacency[Slot] = Adjacency[End - 1];
+                    break;
+                }
+            }
+            --RemainingValence[VertexIndex];
+        }
+
+        // New cache: the emitted triangle first, then the previous entries it did not use
+        int32 NewCache[MaxCacheSize + 3];
+        int32 NewCacheCount = 0;
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            NewCache[NewCacheCount++] = Corners[Corner];
+        }
+        for (int32 Entry = 0; Entry < CacheCount; ++Entry)
+        {
+            const int32 VertexIndex = Cache[Entry];
+            if (VertexIndex != (int32)Corners[0] && VertexIndex != (int32)Corners[1] && VertexIndex != (int32)Corners[2])
+            {
+                NewCache[NewCacheCount++] = VertexIndex;
+            }
+        }
+
+        for (int32 Entry = 0; Entry < NewCacheCount; ++Entry)
+        {
+            const int32 VertexIndex = NewCache[Entry];
+            CachePosition[VertexIndex] = Entry < MaxCacheSize ? Entry : INDEX_NONE;
+            VertexScore[VertexIndex] = ComputeVertexScore(CachePosition[VertexIndex], RemainingValence[VertexIndex]);
+        }
+
+        // Rescore the triangles touching the cache, including vertices that were just evicted
+        BestTriangle = INDEX_NONE;
+        float BestScore = -1.0f;
+        for (int32 Entry = 0; Entry < NewCacheCount; ++Entry)
+        {
+            const int32 VertexIndex = NewCache[Entry];
+            const int32 Begin = AdjacencyOffset[VertexIndex];
+            const int32 End = Begin + RemainingValence[VertexIndex];
+            for (int32 Slot = Begin; Slot < End; ++Slot)
+            {
+                const int32 Triangle = Adjacency[Slot];
+                const float Score = VertexScore[Indices[Triangle * 3]] + VertexScore[Indices[Triangle * 3 + 1]] + VertexScore[Indices[Triangle * 3 + 2]];
+                TriangleScore[Triangle] = Score;
+                if (Score > BestScore)
+                {
+                    BestScore = Score;
+                    BestTriangle = Triangle;
+                }
+            }
+        }
+
+        CacheCount = FMath::Min(NewCacheCount, MaxCacheSize);
+        FMemory::Memcpy(Cache, NewCache, CacheCount * sizeof(int32));
+    }
+
+    FMemory::Memcpy(Indices.GetData(), Output.GetData(), Output.Num() * sizeof(uint32));
+}
+
+void FDSMeshOptimizer::OptimizeOverdraw(TArrayView<uint32> Indices, const TArray<FVector3f>& Positions, const TArray<FVector3f>& Normals, int32 CacheSize)
+{
+    const int32 NumTriangles = Indices.Num() / 3;
+    if (NumTriangles <= 1)
+    {
+        return;
+    }
+
+    // Split the cache-optimized order into clusters wherever a triangle misses the cache entirely,
+    // so moving whole clusters around keeps almost all of the vertex reuse
+    TArray<int32> ClusterStarts;
+    {
+        TArray<uint32, TInlineAllocator<32>> Cache;
+        int32 Head = 0;
+        for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+        {
+            int32 NumMisses = 0;
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const uint32 Index = Indices[Triangle * 3 + Corner];
+                if (!Cache.Contains(Index))
+                {
+                    ++NumMisses;
+                    if (Cache.Num() < CacheSize)
+                    {
+                        Cache.Add(Index);
+                    }
+                    else
+                    {
+                        Cache[Head] = Index;
+                        Head = (Head + 1) % CacheSize;
+                    }
+                }
+            }
+
+            if (Triangle == 0 || NumMisses == 3)
+            {
+                ClusterStarts.Add(Triangle);
+            }
+        }
+        ClusterStarts.Add(NumTriangles);
+    }
+
+    const int32 NumClusters = ClusterStarts.Num() - 1;
+    if (NumClusters <= 1)
+    {
+        return;
+    }
+
+    // Area weighted centroid and normal per cluster
+    TArray<FVector3f> ClusterCentroids;
+    TArray<FVector3f> ClusterNormals;
+    ClusterCentroids.SetNumZeroed(NumClusters);
+    ClusterNormals.SetNumZeroed(NumClusters);
+
+    FVector3f MeshCentroid = FVector3f::ZeroVector;
+    float MeshArea = 0.0f;
+
+    for (int32 Cluster = 0; Cluster < NumClusters; ++Cluster)
+    {
+        float ClusterArea = 0.0f;
+        for (int32 Triangle = ClusterStarts[Cluster]; Triangle < ClusterStarts[Cluster + 1]; ++Triangle)
+        {
+            const uint32 A = Indices[Triangle * 3];
+            const uint32 B = Indices[Triangle * 3 + 1];
+            const uint32 C = Indices[Triangle * 3 + 2];
+
+            const float Area = 0.5f * FVector3f::CrossProduct(Positions[B] - Positions[A], Positions[C] - Positions[A]).Size();
+            const FVector3f Centroid = (Positions[A] + Positions[B] + Positions[C]) / 3.0f;
+
+            ClusterCentroids[Cluster] += Centroid * Area;
+            ClusterNormals[Cluster] += (Normals[A] + Normals[B] + Normals[C]) * Area;
+            ClusterArea += Area;
+        }
+
+        MeshCentroid += ClusterCentroids[Cluster];
+        MeshArea += ClusterArea;
+        ClusterCentroids[Cluster] /= FMath::Max(ClusterArea, UE_SMALL_NUMBER);
+    }
+    MeshCentroid /= FMath::Max(MeshArea, UE_SMALL_NUMBER);
+
+    // Clusters facing away from the mesh center are most likely to occlude the rest, draw them first
+    TArray<int32> ClusterOrder;
+    TArray<float> ClusterSortKeys;
+    ClusterOrder.SetNumUninitialized(NumClusters);
+    ClusterSortKeys.SetNumUninitialized(NumClusters);
+    for (int32 Cluster = 0; Cluster < NumClusters; ++Cluster)
+    {
+        ClusterOrder[Cluster] = Cluster;
+        ClusterSortKeys[Cluster] = FVector3f::DotProduct(ClusterCentroids[Cluster] - MeshCentroid, ClusterNormals[Cluster].GetSafeNormal());
+    }
+
+    Algo::StableSort(ClusterOrder, [&ClusterSortKeys](int32 A, int32 B)
+    {
+        return ClusterSortKeys[A] > ClusterSortKeys[B];
+    });
+
+    TArray<uint32> Output;
+    Output.Reserve(Indices.Num());
+    for (const int32 Cluster : ClusterOrder)
+    {
+        Output.Append(&Indices[ClusterStarts[Cluster] * 3], (ClusterStarts[Cluster + 1] - ClusterStarts[Cluster]) * 3);
+    }
+
+    FMemory::Memcpy(Indices.GetData(), Output.GetData(), Output.Num() * sizeof(uint32));
+}
+
+void FDSMeshOptimizer::CompactVertices(FDSMeshBuffers& Mesh)
+{
+    // New vertex order is the order of first use, unreferenced vertices are dropped
+    TArray<int32> NewIndexOf;
+    NewIndexOf.Init(INDEX_NONE, Mesh.GetNumVertices());
+
+    TArray<int32> OldIndexOf;
+    OldIndexOf.Reserve(Mesh.GetNumVertices());
+
+    for (uint32& Index : Mesh.Indices)
+    {
+        if (NewIndexOf[Index] == INDEX_NONE)
+        {
+            NewIndexOf[Index] = OldIndexOf.Num();
+            OldIndexOf.Add(Index);
+        }
+        Index = NewIndexOf[Index];
+    }
+
+    DSMeshOptimizer::PermuteVertices(Mesh.Positions, OldIndexOf);
+    DSMeshOptimizer::PermuteVertices(Mesh.TangentX, OldIndexOf);
+    DSMeshOptimizer::PermuteVertices(Mesh.TangentY, OldIndexOf);
+    DSMeshOptimizer::PermuteVertices(Mesh.TangentZ, OldIndexOf);
+    DSMeshOptimizer::PermuteVertices(Mesh.UVs, OldIndexOf, Mesh.NumTexCoords);
+    DSMeshOptimizer::PermuteVertices(Mesh.Colors, OldIndexOf);
+}
+
+bool FDSMeshOptimizer::ReadLOD(const FStaticMeshLODResources& LOD, FDSMeshBuffers& OutMesh)
+{
+    // Depth-only and reversed index buffers would need the same remapping, such LODs are left alone
+    if (!FDSStaticMeshRebuild::HasCPUData(LOD) || LOD.AdditionalIndexBuffers != nullptr || LOD.DepthOnlyIndexBuffer.GetNumIndices() > 0)
+    {
+        return false;
+    }
+
+    const FPositionVertexBuffer& PositionBuffer = LOD.VertexBuffers.PositionVertexBuffer;
+    const FStaticMeshVertexBuffer& VertexBuffer = LOD.VertexBuffers.StaticMeshVertexBuffer;
+    const FColorVertexBuffer& ColorBuffer = LOD.VertexBuffers.ColorVertexBuffer;
+
+    const int32 NumVertices = PositionBuffer.GetNumVertices();
+    const bool bHasColors = ColorBuffer.GetNumVertices() == (uint32)NumVertices && ColorBuffer.GetVertexData() != nullptr;
+
+    OutMesh.NumTexCoords = VertexBuffer.GetNumTexCoords();
+    OutMesh.Positions.SetNumUninitialized(NumVertices);
+    OutMesh.TangentX.SetNumUninitialized(NumVertices);
+    OutMesh.TangentY.SetNumUninitialized(NumVertices);
+    OutMesh.TangentZ.SetNumUninitialized(NumVertices);
+    OutMesh.UVs.SetNumUninitialized(NumVertices * OutMesh.NumTexCoords);
+    OutMesh.Colors.SetNumUninitialized(bHasColors ? NumVertices : 0);
+
+    for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+    {
+        OutMesh.Positions[VertexIndex] = PositionBuffer.VertexPosition(VertexIndex);
+        OutMesh.TangentX[VertexIndex] = FVector3f(VertexBuffer.VertexTangentX(VertexIndex));
+        OutMesh.TangentY[VertexIndex] = VertexBuffer.VertexTangentY(VertexIndex);
+        OutMesh.TangentZ[VertexIndex] = FVector3f(VertexBuffer.VertexTangentZ(VertexIndex));
+
+        for (int32 UVIndex = 0; UVIndex < OutMesh.NumTexCoords; ++UVIndex)
+        {
+            OutMesh.UVs[VertexIndex * OutMesh.NumTexCoords + UVIndex] = VertexBuffer.GetVertexUV(VertexIndex, UVIndex);
+        }
+
+        if (bHasColors)
+        {
+            OutMesh.Colors[VertexIndex] = ColorBuffer.VertexColor(VertexIndex);
+        }
+    }
+
+    LOD.IndexBuffer.GetCopy(OutMesh.Indices);
+
+    for (const FStaticMeshSection& Section : LOD.Sections)
+    {
+        OutMesh.Sections.Add({ Section.FirstIndex, Section.NumTriangles });
+    }
+
+    return true;
+}
+
+void FDSMeshOptimizer::SerializeJob(FArchive& Ar, FDSMeshBuffers& Mesh, FDSMeshOptimizeSettings& Settings)
+{
+    Ar << Settings.WeldTolerance;
+    Ar << Settings.WeldNormalTolerance;
+    Ar << Settings.WeldUVTolerance;
+    Ar << Settings.CacheSize;
+    DSMeshOptimizer::SerializeMesh(Ar, Mesh);
+}
+
+void FDSMeshOptimizer::SerializeResult(FArchive& Ar, FDSMeshBuffers& Mesh, FDSMeshOptimizeReport& Report)
+{
+    Ar << Report.NumLODsOptimized;
+    Ar << Report.NumLODsSkipped;
+    Ar << Report.VerticesBefore;
+    Ar << Report.VerticesAfter;
+    Ar << Report.TrianglesBefore;
+    Ar << Report.TrianglesAfter;
+    Ar << Report.CacheMissesBefore;
+    Ar << Report.CacheMissesAfter;
+    DSMeshOptimizer::SerializeMesh(Ar, Mesh);
+}
+
+bool FDSMeshOptimizer::IsConsistent(const FDSMeshBuffers& Mesh)
+{
+    const int32 NumVertices = Mesh.GetNumVertices();
+    if (Mesh.TangentX.Num() != NumVertices || Mesh.TangentY.Num() != NumVertices || Mesh.TangentZ.Num() != NumVertices
+        || Mesh.NumTexCoords < 0 || Mesh.UVs.Num() != NumVertices * Mesh.NumTexCoords
+        || (Mesh.Colors.Num() != 0 && Mesh.Colors.Num() != NumVertices)
+        || Mesh.Indices.Num() % 3 != 0)
+    {
+        return false;
+    }
+
+    for (const uint32 Index : Mesh.Indices)
+    {
+        if (Index >= (uint32)NumVertices)
+        {
+            return false;
+        }
+    }
+
+    for (const FDSMeshBuffers::FSectionRange& Section : Mesh.Sections)
+    {
+        if ((uint64)Section.FirstIndex + (uint64)Section.NumTriangles * 3 > (uint64)Mesh.Indices.Num())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void FDSMeshOptimizer::WriteLOD(const FDSMeshBuffers& Mesh, FStaticMeshLODResources& LOD)
+{
+    const int32 NumVertices = Mesh.GetNumVertices();
+
+    LOD.VertexBuffers.PositionVertexBuffer.Init(Mesh.Positions, true);
+
+    // Init keeps the buffer's current UV and tangent precision
+    FStaticMeshVertexBuffer& VertexBuffer = LOD.VertexBuffers.StaticMeshVertexBuffer;
+    VertexBuffer.Init(NumVertices, Mesh.NumTexCoords, true);
+    for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+    {
+        VertexBuffer.SetVertexTangents(VertexIndex, Mesh.TangentX[VertexIndex], Mesh.TangentY[VertexIndex], Mesh.TangentZ[VertexIndex]);
+        for (int32 UVIndex = 0; UVIndex < Mesh.NumTexCoords; ++UVIndex)
+        {
+            VertexBuffer.SetVertexUV(VertexIndex, UVIndex, Mesh.UVs[VertexIndex * Mesh.NumTexCoords + UVIndex]);
+        }
+    }
+
+    if (Mesh.Colors.Num() > 0)
+    {
+        LOD.VertexBuffers.ColorVertexBuffer.InitFromColorArray(Mesh.Colors);
+    }
+
+    LOD.IndexBuffer.SetIndices(Mesh.Indices, EIndexBufferStride::AutoDetect);
+
+    for (int32 SectionIndex = 0; SectionIndex < LOD.Sections.Num(); ++SectionIndex)
+    {
+        const FDSMeshBuffers::FSectionRange& Range = Mesh.Sections[SectionIndex];
+        FStaticMeshSection& Section = LOD.Sections[SectionIndex];
+        Section.FirstIndex = Range.FirstIndex;
+        Section.NumTriangles = Range.NumTriangles;
+
+        uint32 MinVertexIndex = Range.NumTriangles > 0 ? MAX_uint32 : 0;
+        uint32 MaxVertexIndex = 0;
+        for (uint32 Corner = 0; Corner < Range.NumTriangles * 3; ++Corner)
+        {
+            const uint32 Index = Mesh.Indices[Range.FirstIndex + Corner];
+            MinVertexIndex = FMath::Min(MinVertexIndex, Index);
+            MaxVertexIndex = FMath::Max(MaxVertexIndex, Index);
+        }
+
+        Section.MinVertexIndex = MinVertexIndex;
+        Section.MaxVertexIndex = MaxVertexIndex;
+    }
+}
+
+bool FDSOptimizedMeshes::Contains(const UStaticMesh* StaticMesh) const
+{
+    const uint32* OptimizedFingerprint = StaticMesh ? Fingerprints.Find(StaticMesh) : nullptr;
+    return OptimizedFingerprint && *OptimizedFingerprint == Fingerprint(*StaticMesh);
+}
+
+void FDSOptimizedMeshes::Add(const UStaticMesh* StaticMesh)
+{
+    if (StaticMesh && StaticMesh->GetRenderData())
+    {
+        Fingerprints.Add(StaticMesh, Fingerprint(*StaticMesh));
+    }
+}
+
+void FDSOptimizedMeshes::RemoveStale()
+{
+    for (auto It = Fingerprints.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+uint32 FDSOptimizedMeshes::Fingerprint(const UStaticMesh& StaticMesh)
+{
+    // Rebuilt meshes get new render data; the buffer sizes catch LODs rewritten in place by someone else
+    const FStaticMeshRenderData* RenderData = StaticMesh.GetRenderData();
+    uint32 Hash = GetTypeHash(RenderData);
+    if (RenderData)
+    {
+        for (const FStaticMeshLODResources& LOD : RenderData->LODResources)
+        {
+            Hash = HashCombine(Hash, HashCombine(LOD.VertexBuffers.PositionVertexBuffer.GetNumVertices(), LOD.IndexBuffer.GetNumIndices()));
+        }
+    }
+    return Hash;
+}
+
+int32 FDSMeshOptimizationPass::Start(const TArray<UPrimitiveComponent*>& Primitives, const FDSMeshOptimizeSettings& InSettings, FDSTaskScheduler& Scheduler,
+                                     FDSMeshWorkerPool* InWorkerPool, const FDSOptimizedMeshes* OptimizedMeshes)
+{
+    Jobs.Reset();
+    Settings = InSettings;
+    bCancelled = false;
+
+    TArray<UStaticMesh*> Meshes;
+    FDSStaticMeshRebuild::GatherStaticMeshes(Primitives, Meshes);
+    if (OptimizedMeshes)
+    {
+        const int32 NumGathered = Meshes.Num();
+        Meshes.RemoveAll([OptimizedMeshes](const UStaticMesh* StaticMesh)
+        {
+            return OptimizedMeshes->Contains(StaticMesh);
+        });
+        UE_LOG(LogDSMeshOptimizer, Log, TEXT("Skipping %d meshes optimized by an earlier pass"), NumGathered - Meshes.Num());
+    }
+    NumMeshes = Meshes.Num();
+
+    TSet<UStaticMesh*> VisibleMeshes;
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+        const UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Primitive);
+        if (MeshComponent && MeshComponent->WasRecentlyRendered())
+        {
+            VisibleMeshes.Add(MeshComponent->GetStaticMesh());
+        }
+    }
+
+    for (UStaticMesh* StaticMesh : Meshes)
+    {
+        for (int32 LODIndex = 0; LODIndex < StaticMesh->GetRenderData()->LODResources.Num(); ++LODIndex)
+        {
+            TSharedPtr<FLODJob, ESPMode::ThreadSafe> Job = MakeShared<FLODJob, ESPMode::ThreadSafe>();
+            Job->StaticMesh = StaticMesh;
+            Job->LODIndex = LODIndex;
+            Job->bVisible = VisibleMeshes.Contains(StaticMesh);
+            Jobs.Add(Job);
+        }
+    }
+
+    // Snapshot on the game thread so workers never read render data that may be rebuilt meanwhile
+    ParallelFor(Jobs.Num(), [this](int32 JobIndex)
+    {
+        FLODJob& Job = *Jobs[JobIndex];
+        const FStaticMeshLODResources& LOD = Job.StaticMesh->GetRenderData()->LODResources[Job.LODIndex];
+        Job.NumVertices = LOD.VertexBuffers.PositionVertexBuffer.GetNumVertices();
+        Job.NumIndices = LOD.IndexBuffer.GetNumIndices();
+        Job.NumSections = LOD.Sections.Num();
+        Job.bValid = FDSMeshOptimizer::ReadLOD(LOD, Job.Buffers);
+    });
+
+    TArray<TSharedPtr<FLODJob, ESPMode::ThreadSafe>> ValidJobs = Jobs.FilterByPredicate([](const TSharedPtr<FLODJob, ESPMode::ThreadSafe>& Job)
+    {
+        return Job->bValid;
+    });
+
+    NumPending = ValidJobs.Num();
+    TaskScheduler = Scheduler.AsWeak();
+    TaskGroup = Scheduler.AllocateGroup();
+
+    TSharedRef<FDSMeshOptimizationPass, ESPMode::ThreadSafe> This = AsShared();
+    if (InWorkerPool)
+    {
+        StartInWorkers(ValidJobs, *InWorkerPool);
+
+        UE_LOG(LogDSMeshOptimizer, Log, TEXT("Optimizing %d LODs of %d meshes in %d worker processes (%d LODs skipped)"),
+               ValidJobs.Num(), NumMeshes, InWorkerPool->GetNumWorkers(), Jobs.Num() - ValidJobs.Num());
+
+        return ValidJobs.Num();
+    }
+
+    for (const TSharedPtr<FLODJob, ESPMode::ThreadSafe>& Job : ValidJobs)
+    {
+        const EDSTaskLane Lane = Job->bVisible ? EDSTaskLane::Visible : EDSTaskLane::Normal;
+        Scheduler.Submit(Lane, Job->Buffers.Indices.Num(), [This, Job]()
+        {
+            if (!This->bCancelled)
+            {
+                Job->Report = FDSMeshOptimizer::Optimize(Job->Buffers, This->Settings);
+            }
+            --This->NumPending;
+        }, TaskGroup);
+    }
+
+    UE_LOG(LogDSMeshOptimizer, Log, TEXT("Optimizing %d LODs of %d meshes on %d workers (%d LODs skipped)"),
+           ValidJobs.Num(), NumMeshes, Scheduler.GetNumWorkers(), Jobs.Num() - ValidJobs.Num());
+
+    return ValidJobs.Num();
+}
+
+void FDSMeshOptimizationPass::Cancel()
+{
+    bCancelled = true;
+
+    // Queued LODs are dropped right away, running ones notice the flag once they finish
+    if (TSharedPtr<FDSTaskScheduler, ESPMode::ThreadSafe> Scheduler = TaskScheduler.Pin())
+    {
+        Scheduler->DiscardGroup(TaskGroup);
+    }
+
+    if (TSharedPtr<FDSMeshWorkerPool, ESPMode::ThreadSafe> Pool = WorkerPool.Pin())
+    {
+        Pool->DiscardGroup(TaskGroup);
+    }
+}
+
+void FDSMeshOptimizationPass::StartInWorkers(const TArray<TSharedPtr<FLODJob, ESPMode::ThreadSafe>>& ValidJobs, FDSMeshWorkerPool& Pool)
+{
+    WorkerPool = Pool.AsWeak();
+
+    // Payloads are encoded in parallel, and the snapshots released meanwhile: the results replace them
+    TArray<TArray<uint8>> Payloads;
+    Payloads.SetNum(ValidJobs.Num());
+    ParallelFor(ValidJobs.Num(), [this, &ValidJobs, &Payloads](int32 JobIndex)
+    {
+        FLODJob& Job = *ValidJobs[JobIndex];
+        FMemoryWriter Writer(Payloads[JobIndex]);
+        FDSMeshOptimizer::SerializeJob(Writer, Job.Buffers, Settings);
+        Job.Buffers = FDSMeshBuffers();
+    });
+
+    TSharedRef<FDSMeshOptimizationPass, ESPMode::ThreadSafe> This = AsShared();
+    for (int32 JobIndex = 0; JobIndex < ValidJobs.Num(); ++JobIndex)
+    {
+        TSharedPtr<FLODJob, ESPMode::ThreadSafe> Job = ValidJobs[JobIndex];
+
+        // Visible meshes are queued as if they were far more expensive, so they are handed out first
+        const int64 Cost = Payloads[JobIndex].Num() + (Job->bVisible ? MAX_int32 : 0);
+        Pool.Submit(Cost, MoveTemp(Payloads[JobIndex]), [This, Job](TArrayView<const uint8> Result)
+        {
+            // Runs on the pool's thread; a LOD without a valid result is skipped when applying
+            bool bSucceeded = false;
+            if (!This->bCancelled && Result.Num() > 0)
+            {
+                FMemoryReaderView Reader(TArrayView64<const uint8>(Result.GetData(), Result.Num()));
+                FDSMeshOptimizer::SerializeResult(Reader, Job->Buffers, Job->Report);
+                bSucceeded = !Reader.IsError() && Job->Buffers.Sections.Num() == Job->NumSections && FDSMeshOptimizer::IsConsistent(Job->Buffers);
+            }
+
+            Job->bValid = bSucceeded;
+            --This->NumPending;
+        }, TaskGroup);
+    }
+}
+
+FDSMeshOptimizeReport FDSMeshOptimizationPass::ApplyResults(FDSOptimizedMeshes* OptimizedMeshes)
+{
+    check(IsInGameThread());
+
+    FDSMeshOptimizeReport Report;
+    Report.NumMeshes = NumMeshes;
+
+    if (bCancelled || !IsComplete())
+    {
+        Jobs.Reset();
+        return Report;
+    }
+
+    TMultiMap<UStaticMesh*, const FLODJob*> JobsByMesh;
+    TArray<UStaticMesh*> MeshesToModify;
+    TSet<UStaticMesh*> RebuiltMeshes;
+    for (const TSharedPtr<FLODJob, ESPMode::ThreadSafe>& Job : Jobs)
+    {
+        UStaticMesh* StaticMesh = Job->StaticMesh.Get();
+        const FStaticMeshRenderData* RenderData = StaticMesh ? StaticMesh->GetRenderData() : nullptr;
+        const bool bUnchanged = RenderData
+            && RenderData->LODResources.IsValidIndex(Job->LODIndex)
+            && RenderData->LODResources[Job->LODIndex].VertexBuffers.PositionVertexBuffer.GetNumVertices() == Job->NumVertices
+            && RenderData->LODResources[Job->LODIndex].IndexBuffer.GetNumIndices() == Job->NumIndices;
+
+        if (!Job->bValid || !bUnchanged)
+        {
+            if (!bUnchanged)
+            {
+                RebuiltMeshes.Add(StaticMesh);
+            }
+            ++Report.NumLODsSkipped;
+            continue;
+        }
+
+        Report.Append(Job->Report);
+        JobsByMesh.Add(StaticMesh, Job.Get());
+        MeshesToModify.AddUnique(StaticMesh);
+    }
+
+    FDSStaticMeshRebuild::Modify(MeshesToModify, [&JobsByMesh](UStaticMesh& StaticMesh, FStaticMeshRenderData& RenderData)
+    {
+        for (auto It = JobsByMesh.CreateConstKeyIterator(&StaticMesh); It; ++It)
+        {
+            const FLODJob* Job = It.Value();
+            FDSMeshOptimizer::WriteLOD(Job->Buffers, RenderData.LODResources[Job->LODIndex]);
+        }
+    });
+
+    // Meshes rebuilt during the pass are queued again by the next one, failed LODs would only fail again
+    if (OptimizedMeshes)
+    {
+        for (const TSharedPtr<FLODJob, ESPMode::ThreadSafe>& Job : Jobs)
+        {
+            UStaticMesh* StaticMesh = Job->StaticMesh.Get();
+            if (StaticMesh && !RebuiltMeshes.Contains(StaticMesh))
+            {
+                OptimizedMeshes->Add(StaticMesh);
+            }
+        }
+    }
+
+    Jobs.Reset();
+    return Report;
+}
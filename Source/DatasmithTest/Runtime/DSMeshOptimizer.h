@@ -0,0 +1,272 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+// Forward declarations
+class UPrimitiveComponent;
+class UStaticMesh;
+class FDSTaskScheduler;
+class FDSMeshWorkerPool;
+struct FStaticMeshLODResources;
+
+/**
+ * CPU copy of one static mesh LOD, the unit the optimizer works on
+ */
+struct FDSMeshBuffers
+{
+    struct FSectionRange
+    {
+        uint32 FirstIndex = 0;
+        uint32 NumTriangles = 0;
+    };
+
+    TArray<FVector3f> Positions;
+    TArray<FVector3f> TangentX;
+    TArray<FVector3f> TangentY;
+    TArray<FVector3f> TangentZ;
+
+    /** Texture coordinates, NumTexCoords entries per vertex */
+    TArray<FVector2f> UVs;
+    int32 NumTexCoords = 0;
+
+    /** Vertex colors, empty when the mesh has none */
+    TArray<FColor> Colors;
+
+    TArray<uint32> Indices;
+    TArray<FSectionRange> Sections;
+
+    int32 GetNumVertices() const { return Positions.Num(); }
+};
+
+/**
+ * Tunables of the mesh optimizer
+ */
+struct FDSMeshOptimizeSettings
+{
+    /** Vertices closer than this (cm) with matching attributes are merged */
+    float WeldTolerance = 0.01f;
+
+    /** Maximum angle between normals of vertices that may be merged, in degrees */
+    float WeldNormalTolerance = 5.0f;
+
+    /** Maximum texture coordinate difference of vertices that may be merged */
+    float WeldUVTolerance = 1.0e-4f;
+
+    /** Post-transform cache size used to measure ACMR */
+    int32 CacheSize = 16;
+};
+
+/**
+ * Before/after metrics of the mesh optimizer
+ */
+struct FDSMeshOptimizeReport
+{
+    int32 NumMeshes = 0;
+    int32 NumLODsOptimized = 0;
+    int32 NumLODsSkipped = 0;
+
+    int64 VerticesBefore = 0;
+    int64 VerticesAfter = 0;
+    int64 TrianglesBefore = 0;
+    int64 TrianglesAfter = 0;
+
+    /** Cache misses, summed so ACMR can be computed across all meshes */
+    int64 CacheMissesBefore = 0;
+    int64 CacheMissesAfter = 0;
+
+    /**
+     * Accumulates the metrics of another report
+     */
+    void Append(const FDSMeshOptimizeReport& Other);
+
+    /**
+     * Writes the report to the log
+     */
+    void Log() const;
+};
+
+/**
+ * FDSMeshOptimizer - Welds, reorders and compacts tessellated meshes
+ *
+ * Tessellators emit CAD faces patch by patch, with duplicate vertices along stitched seams and
+ * little vertex reuse between consecutive triangles. The optimizer merges coincident vertices
+ * with matching attributes, reorders triangles within each section for the post-transform
+ * cache (Forsyth) and then for overdraw (outward-facing clusters first), and finally reorders
+ * vertices by first use so vertex fetches stay linear.
+ */
+class DATASMITHTEST_API FDSMeshOptimizer
+{
+public:
+    /**
+     * Optimizes a single mesh in place, safe to call from worker threads
+     * @return Before/after metrics of this mesh
+     */
+    static FDSMeshOptimizeReport Optimize(FDSMeshBuffers& Mesh, const FDSMeshOptimizeSettings& Settings);
+
+    /**
+     * Counts the vertex cache misses of an index buffer with a FIFO cache
+     */
+    static int32 CountCacheMisses(TArrayView<const uint32> Indices, int32 CacheSize);
+
+    /**
+     * Copies a LOD's render data into mesh buffers
+     * @return False if the LOD has no CPU data or extra index buffers the optimizer cannot remap
+     */
+    static bool ReadLOD(const FStaticMeshLODResources& LOD, FDSMeshBuffers& OutMesh);
+
+    /**
+     * Writes optimized mesh buffers back into a LOD whose resources have been released
+     */
+    static void WriteLOD(const FDSMeshBuffers& Mesh, FStaticMeshLODResources& LOD);
+
+    /**
+     * Reads or writes the input of an optimization, used to hand meshes to worker processes
+     */
+    static void SerializeJob(FArchive& Ar, FDSMeshBuffers& Mesh, FDSMeshOptimizeSettings& Settings);
+
+    /**
+     * Reads or writes the output of an optimization
+     */
+    static void SerializeResult(FArchive& Ar, FDSMeshBuffers& Mesh, FDSMeshOptimizeReport& Report);
+
+    /**
+     * Checks that attribute counts, indices and sections of mesh buffers are consistent, so
+     * buffers coming back from another process can be written into a LOD safely
+     */
+    static bool IsConsistent(const FDSMeshBuffers& Mesh);
+
+private:
+    static void WeldVertices(FDSMeshBuffers& Mesh, const FDSMeshOptimizeSettings& Settings);
+    static void RemoveDegenerateTriangles(FDSMeshBuffers& Mesh);
+    static void OptimizeVertexCache(TArrayView<uint32> Indices, int32 NumVertices);
+    static void OptimizeOverdraw(TArrayView<uint32> Indices, const TArray<FVector3f>& Positions, const TArray<FVector3f>& Normals, int32 CacheSize);
+    static void CompactVertices(FDSMeshBuffers& Mesh);
+};
+
+/**
+ * Meshes whose current render data has already been optimized, so later passes only queue
+ * meshes that are new or were rebuilt by an update
+ */
+class DATASMITHTEST_API FDSOptimizedMeshes
+{
+public:
+    /**
+     * Checks whether the mesh still has the render data it had when it was optimized
+     */
+    bool Contains(const UStaticMesh* StaticMesh) const;
+
+    /**
+     * Records the current render data of the mesh as optimized
+     */
+    void Add(const UStaticMesh* StaticMesh);
+
+    /**
+     * Forgets every mesh, so the next pass optimizes all of them again
+     */
+    void Reset() { Fingerprints.Reset(); }
+
+    /**
+     * Drops meshes that have been destroyed
+     */
+    void RemoveStale();
+
+private:
+    /**
+     * Identifies the render data of a mesh; importers replace it when they rebuild a mesh
+     */
+    static uint32 Fingerprint(const UStaticMesh& StaticMesh);
+
+    TMap<TWeakObjectPtr<const UStaticMesh>, uint32> Fingerprints;
+};
+
+/**
+ * FDSMeshOptimizationPass - Runs the mesh optimizer over an imported scene on the task scheduler
+ *
+ * LODs are snapshotted on the game thread and optimized as independent tasks, meshes on screen
+ * first and larger meshes before smaller ones. Once every task has finished, ApplyResults writes
+ * the results back in a single render data rebuild.
+ *
+ * With a worker pool, the snapshots are serialized and optimized in worker processes instead,
+ * so the optimizer's memory peaks and any crash stay outside the viewer. LODs whose workers
+ * keep failing are left unoptimized.
+ */
+class DATASMITHTEST_API FDSMeshOptimizationPass : public TSharedFromThis<FDSMeshOptimizationPass, ESPMode::ThreadSafe>
+{
+public:
+    /**
+     * Snapshots the LODs of the meshes used by the primitives and queues their optimization
+     * @param Primitives Imported components
+     * @param InSettings Optimizer tunables
+     * @param Scheduler Scheduler the tasks run on
+     * @param WorkerPool Worker processes to optimize in, nullptr to optimize on the scheduler's threads
+     * @param OptimizedMeshes Meshes to skip because they have been optimized already, nullptr to queue all
+     * @return Number of LODs queued
+     */
+    int32 Start(const TArray<UPrimitiveComponent*>& Primitives, const FDSMeshOptimizeSettings& InSettings, FDSTaskScheduler& Scheduler,
+                FDSMeshWorkerPool* WorkerPool = nullptr, const FDSOptimizedMeshes* OptimizedMeshes = nullptr);
+
+    /**
+     * Discards queued tasks and asks running ones to stop; results of a cancelled pass are never applied
+     */
+    void Cancel();
+
+    /**
+     * Checks whether every queued task has finished
+     */
+    bool IsComplete() const { return NumPending.load() == 0; }
+
+    /**
+     * Writes the optimized LODs back into their meshes, must run on the game thread
+     * @param OptimizedMeshes Receives the meshes processed by the pass, including those the optimizer could not improve
+     * @return Before/after metrics
+     */
+    FDSMeshOptimizeReport ApplyResults(FDSOptimizedMeshes* OptimizedMeshes = nullptr);
+
+private:
+    struct FLODJob;
+
+    /**
+     * Serializes the snapshots and queues them on the worker pool
+     */
+    void StartInWorkers(const TArray<TSharedPtr<FLODJob, ESPMode::ThreadSafe>>& ValidJobs, FDSMeshWorkerPool& Pool);
+
+    struct FLODJob
+    {
+        TWeakObjectPtr<UStaticMesh> StaticMesh;
+        int32 LODIndex = 0;
+
+        /** Buffer sizes at snapshot time, a mismatch at apply time means the mesh was rebuilt meanwhile */
+        uint32 NumVertices = 0;
+        uint32 NumIndices = 0;
+
+        FDSMeshBuffers Buffers;
+        FDSMeshOptimizeReport Report;
+        int32 NumSections = 0;
+        bool bValid = false;
+        bool bVisible = false;
+    };
+
+    TArray<TSharedPtr<FLODJob, ESPMode::ThreadSafe>> Jobs;
+    FDSMeshOptimizeSettings Settings;
+    int32 NumMeshes = 0;
+
+    /** Scheduler or worker pool and task group the LODs were queued on, used to discard them on cancel */
+    TWeakPtr<FDSTaskScheduler, ESPMode::ThreadSafe> TaskScheduler;
+    TWeakPtr<FDSMeshWorkerPool, ESPMode::ThreadSafe> WorkerPool;
+    uint64 TaskGroup = 0;
+
+    std::atomic<int32> NumPending{ 0 };
+    std::atomic<bool> bCancelled{ false };
+};
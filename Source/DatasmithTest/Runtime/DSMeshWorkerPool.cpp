@@ -0,0 +1,804 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSMeshWorkerPool.h"
+#include "DSMeshOptimizer.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+
+// Logging category for the mesh worker pool
+DEFINE_LOG_CATEGORY_STATIC(LogDSMeshWorkerPool, Log, All);
+
+/**
+ * Control message exchanged between the pool and its workers, always sent whole
+ */
+struct FDSMeshWorkerMessage
+{
+    enum EType : uint32
+    {
+        Hello,      // Worker to pool, Slot identifies the worker
+        Job,        // Pool to worker, the job input is in the job's shared memory region
+        Done,       // Worker to pool, the result is in the region
+        Rejected,   // Worker to pool, the job cannot be run within the memory limit
+        Quit        // Pool to worker
+    };
+
+    uint32 Type = Hello;
+    uint32 Slot = 0;
+    uint64 JobId = 0;
+
+    /** Size of the job input or result at the start of the region */
+    uint64 DataSize = 0;
+
+    /** Total size of the region */
+    uint64 RegionSize = 0;
+};
+
+namespace DSMeshWorkerPool
+{
+    static const TCHAR* WorkerSwitch = TEXT("DSMeshWorker");
+
+    /** Room left in a region beyond the job input, results are never larger than their input by more than this */
+    static constexpr uint64 ResultSlack = 1024;
+
+    /** Time a started worker has to connect before it counts as a failed start */
+    static constexpr double ConnectTimeout = 60.0;
+
+    /** Time a single job may run before its worker is considered hung */
+    static constexpr double JobTimeout = 300.0;
+
+    /** Time an idle worker is kept for later jobs */
+    static constexpr double IdleTimeout = 30.0;
+
+    /** Consecutive failed starts after which the pool stops trying */
+    static constexpr int32 MaxFailedStarts = 3;
+
+    /** Worker input is estimated to need this many times its serialized size while optimizing */
+    static constexpr uint64 WorkingSetFactor = 4;
+
+    static bool SendMessage(FSocket& Socket, const FDSMeshWorkerMessage& Message)
+    {
+        int32 BytesSent = 0;
+        return Socket.Send(reinterpret_cast<const uint8*>(&Message), sizeof(Message), BytesSent) && BytesSent == sizeof(Message);
+    }
+
+    static bool ReceiveMessage(FSocket& Socket, FDSMeshWorkerMessage& OutMessage)
+    {
+        uint8* Data = reinterpret_cast<uint8*>(&OutMessage);
+        int32 Received = 0;
+        while (Received < (int32)sizeof(OutMessage))
+        {
+            int32 BytesRead = 0;
+            if (!Socket.Recv(Data + Received, sizeof(OutMessage) - Received, BytesRead) || BytesRead <= 0)
+            {
+                return false;
+            }
+            Received += BytesRead;
+        }
+        return true;
+    }
+
+    static const uint32 RegionAccess = (uint32)FPlatformMemory::ESharedMemoryAccess::Read | (uint32)FPlatformMemory::ESharedMemoryAccess::Write;
+
+    static uint64 GetUsedMemoryMB()
+    {
+        return FPlatformMemory::GetStats().UsedPhysical / (1024 * 1024);
+    }
+}
+
+FString FDSMeshWorkerPoolStats::ToString() const
+{
+    return FString::Printf(TEXT("Workers: %d, running: %d, queued: %d, completed: %lld, failed: %lld, retried: %lld, worker crashes: %lld"),
+        NumWorkers, NumRunning, NumQueued, NumCompleted, NumFailed, NumRetried, NumWorkerCrashes);
+}
+
+FDSMeshWorkerPool::FDSMeshWorkerPool(int32 InNumWorkers, int32 InMemoryLimitMB, int32 InMaxRetries)
+    : NumWorkers(FMath::Max(InNumWorkers, 1))
+    , MemoryLimitMB(FMath::Max(InMemoryLimitMB, 0))
+    , MaxRetries(FMath::Max(InMaxRetries, 0))
+{
+    Workers.SetNum(NumWorkers);
+
+    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    if (!SocketSubsystem)
+    {
+        UE_LOG(LogDSMeshWorkerPool, Error, TEXT("No socket subsystem, mesh workers are unavailable"));
+        return;
+    }
+
+    // Loopback only, and on a port picked by the system so several viewers can run side by side
+    TSharedRef<FInternetAddr> Address = SocketSubsystem->CreateInternetAddr();
+    Address->SetLoopbackAddress();
+    Address->SetPort(0);
+
+    Listener = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("DSMeshWorkerPool"), false);
+    if (!Listener || !Listener->Bind(*Address) || !Listener->Listen(NumWorkers) || !Listener->SetNonBlocking(true))
+    {
+        UE_LOG(LogDSMeshWorkerPool, Error, TEXT("Could not open the mesh worker socket, mesh workers are unavailable"));
+        if (Listener)
+        {
+            SocketSubsystem->DestroySocket(Listener);
+            Listener = nullptr;
+        }
+        return;
+    }
+
+    ListenPort = Listener->GetPortNo();
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    Thread = FRunnableThread::Create(this, TEXT("DSMeshWorkerPool"), 0, TPri_BelowNormal);
+
+    UE_LOG(LogDSMeshWorkerPool, Log, TEXT("Mesh worker pool listening on port %d for up to %d workers (memory limit %d MB, %d retries)"),
+        ListenPort, NumWorkers, MemoryLimitMB, MaxRetries);
+}
+
+FDSMeshWorkerPool::~FDSMeshWorkerPool()
+{
+    if (Thread)
+    {
+        // Run stops every worker before returning
+        Thread->Kill(true);
+        delete Thread;
+        Thread = nullptr;
+    }
+
+    if (WakeEvent)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        WakeEvent = nullptr;
+    }
+
+    if (Listener)
+    {
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Listener);
+        Listener = nullptr;
+    }
+}
+
+void FDSMeshWorkerPool::Submit(int64 Cost, TArray<uint8>&& Payload, FOnJobFinished&& OnFinished, uint64 Group)
+{
+    TUniquePtr<FJob> Job = MakeUnique<FJob>();
+    Job->Cost = Cost;
+    Job->Group = Group;
+    Job->Payload = MoveTemp(Payload);
+    Job->OnFinished = MoveTemp(OnFinished);
+
+    {
+        FScopeLock Lock(&QueueLock);
+        Job->Id = NextJobId++;
+        Queue.HeapPush(MoveTemp(Job), [](const TUniquePtr<FJob>& A, const TUniquePtr<FJob>& B)
+        {
+            return A->Cost > B->Cost;
+        });
+    }
+
+    if (WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+int32 FDSMeshWorkerPool::DiscardGroup(uint64 Group)
+{
+    if (Group == 0)
+    {
+        return 0;
+    }
+
+    // Callbacks are destroyed outside the lock, they may release the last reference to their owner
+    TArray<TUniquePtr<FJob>> Discarded;
+    {
+        FScopeLock Lock(&QueueLock);
+        for (int32 JobIndex = Queue.Num() - 1; JobIndex >= 0; --JobIndex)
+        {
+            if (Queue[JobIndex]->Group == Group)
+            {
+                Discarded.Add(MoveTemp(Queue[JobIndex]));
+                Queue.RemoveAtSwap(JobIndex, 1, EAllowShrinking::No);
+            }
+        }
+
+        Queue.Heapify([](const TUniquePtr<FJob>& A, const TUniquePtr<FJob>& B)
+        {
+            return A->Cost > B->Cost;
+        });
+    }
+
+    return Discarded.Num();
+}
+
+FDSMeshWorkerPoolStats FDSMeshWorkerPool::GetStats() const
+{
+    FDSMeshWorkerPoolStats Stats;
+    Stats.NumWorkers = NumWorkers;
+    Stats.NumRunning = NumRunning.load();
+    Stats.NumCompleted = NumCompleted.load();
+    Stats.NumFailed = NumFailed.load();
+    Stats.NumRetried = NumRetried.load();
+    Stats.NumWorkerCrashes = NumWorkerCrashes.load();
+
+    {
+        FScopeLock Lock(&QueueLock);
+        Stats.NumQueued = Queue.Num();
+    }
+
+    return Stats;
+}
+
+bool FDSMeshWorkerPool::IsWorkerProcess()
+{
+    return FParse::Param(FCommandLine::Get(), DSMeshWorkerPool::WorkerSwitch);
+}
+
+uint32 FDSMeshWorkerPool::Run()
+{
+    while (!bStopping)
+    {
+        AcceptWorkers();
+        UpdateWorkers();
+        DispatchJobs();
+
+        // Poll quickly while workers are busy so results are picked up promptly, idle otherwise
+        WakeEvent->Wait(NumRunning.load() > 0 ? 2 : 50);
+    }
+
+    for (int32 Slot = 0; Slot < Workers.Num(); ++Slot)
+    {
+        StopWorker(Slot, false);
+    }
+
+    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    for (FSocket* Socket : PendingSockets)
+    {
+        SocketSubsystem->DestroySocket(Socket);
+    }
+    PendingSockets.Reset();
+
+    return 0;
+}
+
+void FDSMeshWorkerPool::Stop()
+{
+    bStopping = true;
+    if (WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+bool FDSMeshWorkerPool::StartWorker(int32 Slot)
+{
+    FWorker& Worker = Workers[Slot];
+
+    FString Params;
+
+    // Outside cooked builds the executable is the editor, which needs the project and game mode
+    if (!FPlatformProperties::RequiresCookedData())
+    {
+        Params += FString::Printf(TEXT("\"%s\" -game "), *FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()));
+    }
+
+    Params += FString::Printf(TEXT("-%s -DSMeshWorkerPort=%d -DSMeshWorkerSlot=%d -DSMeshWorkerParent=%u -DSMeshWorkerMemoryMB=%d -nullrhi -nosound -unattended -nosplash -log=DSMeshWorker%d.log"),
+        DSMeshWorkerPool::WorkerSwitch, ListenPort, Slot, FPlatformProcess::GetCurrentProcessId(), MemoryLimitMB, Slot);
+
+    uint32 ProcessId = 0;
+    Worker.Process = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *Params, false, true, true, &ProcessId, -1, nullptr, nullptr);
+    if (!Worker.Process.IsValid())
+    {
+        UE_LOG(LogDSMeshWorkerPool, Warning, TEXT("Could not start mesh worker %d"), Slot);
+        ++NumFailedStarts;
+        return false;
+    }
+
+    Worker.ProcessId = ProcessId;
+    Worker.StartTime = FPlatformTime::Seconds();
+    Worker.LastActiveTime = Worker.StartTime;
+
+    UE_LOG(LogDSMeshWorkerPool, Verbose, TEXT("Started mesh worker %d (process %u)"), Slot, ProcessId);
+    return true;
+}
+
+void FDSMeshWorkerPool::StopWorker(int32 Slot, bool bFailed)
+{
+    FWorker& Worker = Workers[Slot];
+
+    if (Worker.Socket)
+    {
+        if (!bFailed)
+        {
+            FDSMeshWorkerMessage Quit;
+            Quit.Type = FDSMeshWorkerMessage::Quit;
+            DSMeshWorkerPool::SendMessage(*Worker.Socket, Quit);
+        }
+
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Worker.Socket);
+        Worker.Socket = nullptr;
+    }
+
+    if (Worker.Process.IsValid())
+    {
+        // A worker that was let go exits on its own once it reads the quit message or sees the socket close
+        if (bFailed && FPlatformProcess::IsProcRunning(Worker.Process))
+        {
+            FPlatformProcess::TerminateProc(Worker.Process, true);
+        }
+        FPlatformProcess::CloseProc(Worker.Process);
+    }
+
+    if (Worker.Region)
+    {
+        FPlatformMemory::UnmapNamedSharedMemoryRegion(Worker.Region);
+        Worker.Region = nullptr;
+    }
+
+    if (TUniquePtr<FJob> Job = MoveTemp(Worker.Job))
+    {
+        --NumRunning;
+
+        // Only jobs whose worker failed count an attempt, jobs of workers let go are simply requeued
+        if (bFailed && ++Job->NumAttempts > MaxRetries)
+        {
+            UE_LOG(LogDSMeshWorkerPool, Warning, TEXT("Mesh job %llu failed after %d attempts"), Job->Id, Job->NumAttempts);
+            FinishJob(MoveTemp(Job), TArrayView<const uint8>());
+        }
+        else if (bStopping)
+        {
+            // Dropped with the pool, like queued jobs
+        }
+        else
+        {
+            if (bFailed)
+            {
+                ++NumRetried;
+                UE_LOG(LogDSMeshWorkerPool, Log, TEXT("Retrying mesh job %llu (attempt %d of %d)"), Job->Id, Job->NumAttempts + 1, MaxRetries + 1);
+            }
+
+            FScopeLock Lock(&QueueLock);
+            Queue.HeapPush(MoveTemp(Job), [](const TUniquePtr<FJob>& A, const TUniquePtr<FJob>& B)
+            {
+                return A->Cost > B->Cost;
+            });
+        }
+    }
+
+    Worker.ProcessId = 0;
+    Worker.ReceiveBuffer.Reset();
+}
+
+void FDSMeshWorkerPool::AcceptWorkers()
+{
+    bool bHasPendingConnection = false;
+    while (Listener->HasPendingConnection(bHasPendingConnection) && bHasPendingConnection)
+    {
+        if (FSocket* Socket = Listener->Accept(TEXT("DSMeshWorker")))
+        {
+            Socket->SetNonBlocking(true);
+            PendingSockets.Add(Socket);
+        }
+    }
+
+    // Connections are matched to their slot once the worker's hello arrives
+    for (int32 SocketIndex = PendingSockets.Num() - 1; SocketIndex >= 0; --SocketIndex)
+    {
+        FSocket* Socket = PendingSockets[SocketIndex];
+
+        uint32 PendingSize = 0;
+        if (!Socket->HasPendingData(PendingSize) || PendingSize < sizeof(FDSMeshWorkerMessage))
+        {
+            continue;
+        }
+
+        FDSMeshWorkerMessage Hello;
+        int32 BytesRead = 0;
+        Socket->Recv(reinterpret_cast<uint8*>(&Hello), sizeof(Hello), BytesRead);
+        PendingSockets.RemoveAtSwap(SocketIndex);
+
+        const bool bKnownWorker = BytesRead == sizeof(Hello)
+            && Hello.Type == FDSMeshWorkerMessage::Hello
+            && Workers.IsValidIndex(Hello.Slot)
+            && Workers[Hello.Slot].IsStarted()
+            && Workers[Hello.Slot].Socket == nullptr
+            && Hello.JobId == Workers[Hello.Slot].ProcessId;
+
+        if (!bKnownWorker)
+        {
+            ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+            continue;
+        }
+
+        FWorker& Worker = Workers[Hello.Slot];
+        Worker.Socket = Socket;
+        Worker.LastActiveTime = FPlatformTime::Seconds();
+        NumFailedStarts = 0;
+
+        UE_LOG(LogDSMeshWorkerPool, Verbose, TEXT("Mesh worker %d connected"), Hello.Slot);
+    }
+}
+
+void FDSMeshWorkerPool::UpdateWorkers()
+{
+    const double Now = FPlatformTime::Seconds();
+
+    for (int32 Slot = 0; Slot < Workers.Num(); ++Slot)
+    {
+        FWorker& Worker = Workers[Slot];
+        if (!Worker.IsStarted())
+        {
+            continue;
+        }
+
+        // Messages first, a worker that restarts itself for memory sends its result before exiting
+        if (Worker.Socket)
+        {
+            uint32 PendingSize = 0;
+            while (Worker.Socket && Worker.Socket->HasPendingData(PendingSize) && PendingSize > 0)
+            {
+                const int32 Offset = Worker.ReceiveBuffer.Num();
+                Worker.ReceiveBuffer.AddUninitialized(PendingSize);
+
+                int32 BytesRead = 0;
+                Worker.Socket->Recv(Worker.ReceiveBuffer.GetData() + Offset, PendingSize, BytesRead);
+                Worker.ReceiveBuffer.SetNum(Offset + FMath::Max(BytesRead, 0), EAllowShrinking::No);
+
+                while (Worker.ReceiveBuffer.Num() >= (int32)sizeof(FDSMeshWorkerMessage))
+                {
+                    FDSMeshWorkerMessage Message;
+                    FMemory::Memcpy(&Message, Worker.ReceiveBuffer.GetData(), sizeof(Message));
+                    Worker.ReceiveBuffer.RemoveAt(0, sizeof(Message), EAllowShrinking::No);
+                    HandleMessage(Slot, Message);
+                }
+            }
+        }
+
+        if (!FPlatformProcess::IsProcRunning(Worker.Process))
+        {
+            int32 ReturnCode = 0;
+            FPlatformProcess::GetProcReturnCode(Worker.Process, &ReturnCode);
+
+            if (Worker.Job.IsValid())
+            {
+                ++NumWorkerCrashes;
+                UE_LOG(LogDSMeshWorkerPool, Warning, TEXT("Mesh worker %d exited with code %d while running job %llu"), Slot, ReturnCode, Worker.Job->Id);
+            }
+            else if (!Worker.Socket)
+            {
+                ++NumFailedStarts;
+                UE_LOG(LogDSMeshWorkerPool, Warning, TEXT("Mesh worker %d exited with code %d before connecting"), Slot, ReturnCode);
+            }
+
+            StopWorker(Slot, Worker.Job.IsValid());
+            continue;
+        }
+
+        if (!Worker.Socket && Now - Worker.StartTime > DSMeshWorkerPool::ConnectTimeout)
+        {
+            ++NumFailedStarts;
+            UE_LOG(LogDSMeshWorkerPool, Warning, TEXT("Mesh worker %d did not connect in time"), Slot);
+            StopWorker(Slot, true);
+            continue;
+        }
+
+        if (Worker.Job.IsValid())
+        {
+            if (Now - Worker.LastActiveTime > DSMeshWorkerPool::JobTimeout)
+            {
+                ++NumWorkerCrashes;
+                UE_LOG(LogDSMeshWorkerPool, Warning, TEXT("Mesh worker %d hung on job %llu"), Slot, Worker.Job->Id);
+                StopWorker(Slot, true);
+                continue;
+            }
+
+            // Workers check their own memory between jobs, this catches one that balloons during a job
+            SIZE_T MemoryUsage = 0;
+            if (MemoryLimitMB > 0 && FPlatformProcess::GetApplicationMemoryUsage(Worker.ProcessId, &MemoryUsage)
+                && MemoryUsage / (1024 * 1024) > (SIZE_T)MemoryLimitMB)
+            {
+                ++NumWorkerCrashes;
+                UE_LOG(LogDSMeshWorkerPool, Warning, TEXT("Mesh worker %d exceeded its memory limit on job %llu"), Slot, Worker.Job->Id);
+                StopWorker(Slot, true);
+                continue;
+            }
+        }
+        else if (Worker.Socket && Now - Worker.LastActiveTime > DSMeshWorkerPool::IdleTimeout)
+        {
+            UE_LOG(LogDSMeshWorkerPool, Verbose, TEXT("Mesh worker %d idle, letting it go"), Slot);
+            StopWorker(Slot, false);
+        }
+    }
+
+    // Workers that cannot start at all would otherwise leave every job waiting forever
+    if (NumFailedStarts >= DSMeshWorkerPool::MaxFailedStarts && !bWorkersUnavailable)
+    {
+        bWorkersUnavailable = true;
+        UE_LOG(LogDSMeshWorkerPool, Error, TEXT("Mesh workers failed to start %d times in a row, failing queued jobs"), NumFailedStarts);
+    }
+
+    if (bWorkersUnavailable)
+    {
+        while (TUniquePtr<FJob> Job = PopJob())
+        {
+            FinishJob(MoveTemp(Job), TArrayView<const uint8>());
+        }
+    }
+}
+
+void FDSMeshWorkerPool::DispatchJobs()
+{
+    if (bWorkersUnavailable)
+    {
+        return;
+    }
+
+    int32 NumQueued = 0;
+    {
+        FScopeLock Lock(&QueueLock);
+        NumQueued = Queue.Num();
+    }
+
+    int32 NumStarting = 0;
+    for (const FWorker& Worker : Workers)
+    {
+        NumStarting += Worker.IsStarted() && !Worker.Socket ? 1 : 0;
+    }
+
+    for (int32 Slot = 0; Slot < Workers.Num() && NumQueued > 0; ++Slot)
+    {
+        FWorker& Worker = Workers[Slot];
+
+        // One new worker per job not already covered by a worker on its way
+        if (!Worker.IsStarted())
+        {
+            if (NumStarting < NumQueued && StartWorker(Slot))
+            {
+                ++NumStarting;
+            }
+            continue;
+        }
+
+        if (!Worker.IsIdle())
+        {
+            continue;
+        }
+
+        TUniquePtr<FJob> Job = PopJob();
+        if (!Job.IsValid())
+        {
+            break;
+        }
+        --NumQueued;
+
+        const uint64 RegionSize = Job->Payload.Num() + DSMeshWorkerPool::ResultSlack;
+        Worker.Region = FPlatformMemory::MapNamedSharedMemoryRegion(GetRegionName(FPlatformProcess::GetCurrentProcessId(), Job->Id), true,
+            DSMeshWorkerPool::RegionAccess, RegionSize);
+        if (!Worker.Region)
+        {
+            UE_LOG(LogDSMeshWorkerPool, Warning, TEXT("Could not create shared memory for mesh job %llu"), Job->Id);
+            FinishJob(MoveTemp(Job), TArrayView<const uint8>());
+            continue;
+        }
+
+        FMemory::Memcpy(Worker.Region->GetAddress(), Job->Payload.GetData(), Job->Payload.Num());
+
+        FDSMeshWorkerMessage Message;
+        Message.Type = FDSMeshWorkerMessage::Job;
+        Message.Slot = Slot;
+        Message.JobId = Job->Id;
+        Message.DataSize = Job->Payload.Num();
+        Message.RegionSize = RegionSize;
+
+        Worker.Job = MoveTemp(Job);
+        Worker.LastActiveTime = FPlatformTime::Seconds();
+        ++NumRunning;
+
+        if (!DSMeshWorkerPool::SendMessage(*Worker.Socket, Message))
+        {
+            ++NumWorkerCrashes;
+            StopWorker(Slot, true);
+        }
+    }
+}
+
+void FDSMeshWorkerPool::HandleMessage(int32 Slot, const FDSMeshWorkerMessage& Message)
+{
+    FWorker& Worker = Workers[Slot];
+    if (!Worker.Job.IsValid() || Message.JobId != Worker.Job->Id)
+    {
+        return;
+    }
+
+    TUniquePtr<FJob> Job = MoveTemp(Worker.Job);
+    --NumRunning;
+    Worker.LastActiveTime = FPlatformTime::Seconds();
+
+    if (Message.Type == FDSMeshWorkerMessage::Done && Message.DataSize <= Worker.Region->GetSize())
+    {
+        // Copied out so the region can be released before the callback runs
+        TArray<uint8> Result;
+        Result.SetNumUninitialized(Message.DataSize);
+        FMemory::Memcpy(Result.GetData(), Worker.Region->GetAddress(), Message.DataSize);
+
+        FPlatformMemory::UnmapNamedSharedMemoryRegion(Worker.Region);
+        Worker.Region = nullptr;
+
+        ++NumCompleted;
+        FinishJob(MoveTemp(Job), Result);
+        return;
+    }
+
+    FPlatformMemory::UnmapNamedSharedMemoryRegion(Worker.Region);
+    Worker.Region = nullptr;
+
+    // Rejected jobs are too large for the memory limit or unreadable, another worker would reject them too
+    UE_LOG(LogDSMeshWorkerPool, Warning, TEXT("Mesh worker %d rejected job %llu (%d bytes, memory limit %d MB)"), Slot, Job->Id, Job->Payload.Num(), MemoryLimitMB);
+    FinishJob(MoveTemp(Job), TArrayView<const uint8>());
+}
+
+void FDSMeshWorkerPool::FinishJob(TUniquePtr<FJob> Job, TArrayView<const uint8> Result)
+{
+    if (Result.Num() == 0)
+    {
+        ++NumFailed;
+    }
+
+    Job->OnFinished(Result);
+}
+
+TUniquePtr<FDSMeshWorkerPool::FJob> FDSMeshWorkerPool::PopJob()
+{
+    FScopeLock Lock(&QueueLock);
+    if (Queue.Num() == 0)
+    {
+        return nullptr;
+    }
+
+    TUniquePtr<FJob> Job;
+    Queue.HeapPop(Job, [](const TUniquePtr<FJob>& A, const TUniquePtr<FJob>& B)
+    {
+        return A->Cost > B->Cost;
+    }, EAllowShrinking::No);
+    return Job;
+}
+
+FString FDSMeshWorkerPool::GetRegionName(uint32 PoolProcessId, uint64 JobId)
+{
+    return FString::Printf(TEXT("DSMeshJob_%u_%llu"), PoolProcessId, JobId);
+}
+
+int32 FDSMeshWorkerPool::RunWorker()
+{
+    int32 Port = 0;
+    int32 Slot = 0;
+    uint32 ParentProcessId = 0;
+    int32 MemoryLimitMB = 0;
+    const TCHAR* CommandLine = FCommandLine::Get();
+    if (!FParse::Value(CommandLine, TEXT("DSMeshWorkerPort="), Port)
+        || !FParse::Value(CommandLine, TEXT("DSMeshWorkerSlot="), Slot)
+        || !FParse::Value(CommandLine, TEXT("DSMeshWorkerParent="), ParentProcessId))
+    {
+        UE_LOG(LogDSMeshWorkerPool, Error, TEXT("Mesh worker started without a pool to connect to"));
+        return 1;
+    }
+    FParse::Value(CommandLine, TEXT("DSMeshWorkerMemoryMB="), MemoryLimitMB);
+
+    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    TSharedRef<FInternetAddr> Address = SocketSubsystem->CreateInternetAddr();
+    Address->SetLoopbackAddress();
+    Address->SetPort(Port);
+
+    FSocket* Socket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("DSMeshWorker"), false);
+    if (!Socket || !Socket->Connect(*Address))
+    {
+        UE_LOG(LogDSMeshWorkerPool, Error, TEXT("Mesh worker could not connect to its pool on port %d"), Port);
+        if (Socket)
+        {
+            SocketSubsystem->DestroySocket(Socket);
+        }
+        return 1;
+    }
+
+    FDSMeshWorkerMessage Hello;
+    Hello.Type = FDSMeshWorkerMessage::Hello;
+    Hello.Slot = Slot;
+    Hello.JobId = FPlatformProcess::GetCurrentProcessId();
+    DSMeshWorkerPool::SendMessage(*Socket, Hello);
+
+    UE_LOG(LogDSMeshWorkerPool, Log, TEXT("Mesh worker %d connected to its pool on port %d"), Slot, Port);
+
+    while (true)
+    {
+        // Waits in slices so an orphaned worker notices its viewer is gone
+        if (!Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(1.0)))
+        {
+            if (!FPlatformProcess::IsApplicationRunning(ParentProcessId) || Socket->GetConnectionState() == SCS_ConnectionError)
+            {
+                break;
+            }
+            continue;
+        }
+
+        FDSMeshWorkerMessage Message;
+        if (!DSMeshWorkerPool::ReceiveMessage(*Socket, Message) || Message.Type != FDSMeshWorkerMessage::Job)
+        {
+            break;
+        }
+
+        FDSMeshWorkerMessage Reply;
+        Reply.Slot = Slot;
+        Reply.JobId = Message.JobId;
+        Reply.Type = FDSMeshWorkerMessage::Rejected;
+
+        const bool bFits = MemoryLimitMB <= 0
+            || DSMeshWorkerPool::GetUsedMemoryMB() + Message.DataSize * DSMeshWorkerPool::WorkingSetFactor / (1024 * 1024) <= (uint64)MemoryLimitMB;
+
+        FPlatformMemory::FSharedMemoryRegion* Region = bFits
+            ? FPlatformMemory::MapNamedSharedMemoryRegion(GetRegionName(ParentProcessId, Message.JobId), false,
+                DSMeshWorkerPool::RegionAccess, Message.RegionSize)
+            : nullptr;
+
+        if (Region && Message.DataSize <= Region->GetSize())
+        {
+            FDSMeshBuffers Mesh;
+            FDSMeshOptimizeSettings Settings;
+            {
+                FMemoryReaderView Reader(TArrayView64<const uint8>(static_cast<const uint8*>(Region->GetAddress()), Message.DataSize));
+                FDSMeshOptimizer::SerializeJob(Reader, Mesh, Settings);
+                if (Reader.IsError())
+                {
+                    Mesh = FDSMeshBuffers();
+                }
+            }
+
+            if (Mesh.GetNumVertices() > 0)
+            {
+                FDSMeshOptimizeReport Report = FDSMeshOptimizer::Optimize(Mesh, Settings);
+
+                TArray<uint8> Result;
+                FMemoryWriter Writer(Result);
+                FDSMeshOptimizer::SerializeResult(Writer, Mesh, Report);
+
+                if ((uint64)Result.Num() <= Region->GetSize())
+                {
+                    FMemory::Memcpy(Region->GetAddress(), Result.GetData(), Result.Num());
+                    Reply.Type = FDSMeshWorkerMessage::Done;
+                    Reply.DataSize = Result.Num();
+                }
+            }
+        }
+
+        if (Region)
+        {
+            FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+        }
+
+        if (!DSMeshWorkerPool::SendMessage(*Socket, Reply))
+        {
+            break;
+        }
+
+        // Freed memory is not always returned to the system, so a grown worker restarts instead
+        if (MemoryLimitMB > 0 && DSMeshWorkerPool::GetUsedMemoryMB() > (uint64)MemoryLimitMB)
+        {
+            UE_LOG(LogDSMeshWorkerPool, Log, TEXT("Mesh worker %d over its memory limit, exiting to be restarted"), Slot);
+            break;
+        }
+    }
+
+    SocketSubsystem->DestroySocket(Socket);
+    return 0;
+}
@@ -0,0 +1,225 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/PlatformProcess.h"
+#include <atomic>
+
+// Forward declarations
+class FSocket;
+class FRunnableThread;
+class FEvent;
+struct FDSMeshWorkerMessage;
+
+/**
+ * Snapshot of the worker pool's activity
+ */
+struct FDSMeshWorkerPoolStats
+{
+    int32 NumWorkers = 0;
+    int32 NumRunning = 0;
+    int32 NumQueued = 0;
+    int64 NumCompleted = 0;
+    int64 NumFailed = 0;
+    int64 NumRetried = 0;
+    int64 NumWorkerCrashes = 0;
+
+    /**
+     * Formats the stats as a single log line
+     */
+    FString ToString() const;
+};
+
+/**
+ * FDSMeshWorkerPool - Optimizes meshes in a pool of local worker processes
+ *
+ * Workers are instances of this executable started with -DSMeshWorker. The module notices the
+ * switch on startup and runs RunWorker instead of the engine, so a worker never loads a map or
+ * creates a renderer. Each worker connects back to the pool over a loopback socket that only
+ * carries small control messages; job inputs and results travel through a named shared memory
+ * region per job.
+ *
+ * A job whose worker crashes, hangs or exceeds its memory limit is retried on a fresh worker a
+ * limited number of times before it is reported as failed. Workers also restart themselves once
+ * their own memory use goes over the limit, and idle workers exit after a while so an idle
+ * viewer does not keep their memory.
+ *
+ * The pool runs its own thread; completion callbacks are called on it.
+ */
+class DATASMITHTEST_API FDSMeshWorkerPool : public FRunnable, public TSharedFromThis<FDSMeshWorkerPool, ESPMode::ThreadSafe>
+{
+public:
+    /**
+     * Called with the result of a job, or with an empty view once every attempt has failed
+     */
+    using FOnJobFinished = TUniqueFunction<void(TArrayView<const uint8> Result)>;
+
+    /**
+     * @param InNumWorkers Number of worker processes, at least 1
+     * @param InMemoryLimitMB Memory a worker may use before it is restarted, 0 for no limit
+     * @param InMaxRetries Number of times a job is retried after its worker failed
+     */
+    FDSMeshWorkerPool(int32 InNumWorkers, int32 InMemoryLimitMB, int32 InMaxRetries);
+    virtual ~FDSMeshWorkerPool();
+
+    /**
+     * Checks whether the pool can run jobs; false if its socket could not be opened or workers keep failing to start
+     */
+    bool IsAvailable() const { return Thread != nullptr && !bWorkersUnavailable; }
+
+    /**
+     * Queues a job; workers are started on demand
+     * @param Cost Estimated cost used to hand out expensive jobs first
+     * @param Payload Job input, see FDSMeshOptimizer::SerializeJob
+     * @param OnFinished Called on the pool thread when the job has finished or failed
+     * @param Group Group the job belongs to, 0 for none
+     */
+    void Submit(int64 Cost, TArray<uint8>&& Payload, FOnJobFinished&& OnFinished, uint64 Group = 0);
+
+    /**
+     * Removes the queued jobs of a group without running them; jobs already sent to a worker finish normally
+     * @return Number of jobs discarded
+     */
+    int32 DiscardGroup(uint64 Group);
+
+    /**
+     * Gets the current activity of the pool
+     */
+    FDSMeshWorkerPoolStats GetStats() const;
+
+    /**
+     * Gets the number of worker processes the pool may run
+     */
+    int32 GetNumWorkers() const { return NumWorkers; }
+
+    /**
+     * Checks whether this process was started as a mesh worker
+     */
+    static bool IsWorkerProcess();
+
+    /**
+     * Runs the worker side of the protocol until the pool lets the worker go
+     * @return Process exit code
+     */
+    static int32 RunWorker();
+
+    // FRunnable interface
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    struct FJob
+    {
+        uint64 Id = 0;
+        uint64 Group = 0;
+        int64 Cost = 0;
+        int32 NumAttempts = 0;
+        TArray<uint8> Payload;
+        FOnJobFinished OnFinished;
+    };
+
+    struct FWorker
+    {
+        FProcHandle Process;
+        uint32 ProcessId = 0;
+        FSocket* Socket = nullptr;
+        double StartTime = 0.0;
+        double LastActiveTime = 0.0;
+
+        /** Job being run by the worker and the shared memory it was handed in */
+        TUniquePtr<FJob> Job;
+        FPlatformMemory::FSharedMemoryRegion* Region = nullptr;
+
+        /** Bytes of a partially received message */
+        TArray<uint8> ReceiveBuffer;
+
+        bool IsStarted() const { return ProcessId != 0; }
+        bool IsIdle() const { return Socket != nullptr && !Job.IsValid(); }
+    };
+
+    /**
+     * Starts the process of a worker slot
+     */
+    bool StartWorker(int32 Slot);
+
+    /**
+     * Stops the process of a worker slot, requeueing or failing its job
+     * @param bFailed Whether the worker failed its job rather than being let go
+     */
+    void StopWorker(int32 Slot, bool bFailed);
+
+    /**
+     * Accepts connecting workers and matches them to their slots
+     */
+    void AcceptWorkers();
+
+    /**
+     * Receives worker messages and detects crashed, hung or oversized workers
+     */
+    void UpdateWorkers();
+
+    /**
+     * Starts workers for queued jobs and hands jobs to idle workers
+     */
+    void DispatchJobs();
+
+    /**
+     * Handles a complete message from a worker
+     */
+    void HandleMessage(int32 Slot, const FDSMeshWorkerMessage& Message);
+
+    /**
+     * Finishes a job, with its result or as failed
+     */
+    void FinishJob(TUniquePtr<FJob> Job, TArrayView<const uint8> Result);
+
+    /**
+     * Pops the most expensive queued job
+     */
+    TUniquePtr<FJob> PopJob();
+
+    /**
+     * Gets the name of the shared memory region of a job
+     */
+    static FString GetRegionName(uint32 PoolProcessId, uint64 JobId);
+
+    const int32 NumWorkers;
+    const int32 MemoryLimitMB;
+    const int32 MaxRetries;
+
+    FSocket* Listener = nullptr;
+    int32 ListenPort = 0;
+    TArray<FSocket*> PendingSockets;
+    TArray<FWorker> Workers;
+
+    /** Consecutive workers that exited or never connected before running a job; the pool gives up after a few */
+    int32 NumFailedStarts = 0;
+    std::atomic<bool> bWorkersUnavailable{ false };
+
+    /** Queued jobs, a max heap on cost */
+    TArray<TUniquePtr<FJob>> Queue;
+    mutable FCriticalSection QueueLock;
+    uint64 NextJobId = 1;
+
+    FRunnableThread* Thread = nullptr;
+    FEvent* WakeEvent = nullptr;
+    std::atomic<bool> bStopping{ false };
+
+    std::atomic<int32> NumRunning{ 0 };
+    std::atomic<int64> NumCompleted{ 0 };
+    std::atomic<int64> NumFailed{ 0 };
+    std::atomic<int64> NumRetried{ 0 };
+    std::atomic<int64> NumWorkerCrashes{ 0 };
+};
@@ -0,0 +1,212 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSMetadataViewFilter.h"
+#include "GameFramework/Actor.h"
+#include "Components/PrimitiveComponent.h"
+#include "DatasmithAssetUserData.h"
+
+// Logging category for the metadata view filter
+DEFINE_LOG_CATEGORY_STATIC(LogDSMetadataViewFilter, Log, All);
+
+bool FDSViewFilterRule::Parse(const FString& Text, FDSViewFilterRule& OutRule)
+{
+    FString Key;
+    FString Pattern;
+    if (!Text.Split(TEXT("="), &Key, &Pattern))
+    {
+        // A bare key matches any element that has it
+        Key = Text;
+        Pattern = TEXT("*");
+    }
+
+    Key.TrimStartAndEndInline();
+    Pattern.TrimStartAndEndInline();
+    if (Key.IsEmpty())
+    {
+        return false;
+    }
+
+    OutRule.Key = FName(*Key);
+    OutRule.Pattern = Pattern.IsEmpty() ? TEXT("*") : Pattern;
+    return true;
+}
+
+void FDSViewFilterReport::Log() const
+{
+    UE_LOG(LogDSMetadataViewFilter, Log, TEXT("View filter: %d components evaluated, %d filtered out, %d restored"),
+           NumEvaluated, NumFiltered, NumRestored);
+}
+
+FDSMetadataViewFilter::FDSMetadataViewFilter(const TArray<FString>& IncludeRules, const TArray<FString>& ExcludeRules)
+{
+    for (const FString& Text : IncludeRules)
+    {
+        FDSViewFilterRule Rule;
+        if (FDSViewFilterRule::Parse(Text, Rule))
+        {
+            Includes.Add(Rule);
+        }
+        else
+        {
+            UE_LOG(LogDSMetadataViewFilter, Warning, TEXT("Ignoring invalid include rule '%s', expected Key=Pattern"), *Text);
+        }
+    }
+
+    for (const FString& Text : ExcludeRules)
+    {
+        FDSViewFilterRule Rule;
+        if (FDSViewFilterRule::Parse(Text, Rule))
+        {
+            Excludes.Add(Rule);
+        }
+        else
+        {
+            UE_LOG(LogDSMetadataViewFilter, Warning, TEXT("Ignoring invalid exclude rule '%s', expected Key=Pattern"), *Text);
+        }
+    }
+}
+
+bool FDSMetadataViewFilter::FindMetadataValue(const USceneComponent* Component, FName Key, FString& OutValue)
+{
+    for (const USceneComponent* Current = Component; Current; Current = Current->GetAttachParent())
+    {
+        if (const UDatasmithAssetUserData* UserData = Current->GetAssetUserData<UDatasmithAssetUserData>())
+        {
+            if (const FString* Value = UserData->MetaData.Find(Key))
+            {
+                OutValue = *Value;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool FDSMetadataViewFilter::MatchesAny(TFunctionRef<bool(FName Key, FString& OutValue)> FindValue, const TArray<FDSViewFilterRule>& Rules)
+{
+    FString Value;
+    for (const FDSViewFilterRule& Rule : Rules)
+    {
+        if (FindValue(Rule.Key, Value) && Value.MatchesWildcard(Rule.Pattern, ESearchCase::IgnoreCase))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FDSMetadataViewFilter::Passes(const USceneComponent* Component) const
+{
+    return Passes([Component](FName Key, FString& OutValue)
+    {
+        return FindMetadataValue(Component, Key, OutValue);
+    });
+}
+
+bool FDSMetadataViewFilter::Passes(TFunctionRef<bool(FName Key, FString& OutValue)> FindValue) const
+{
+    if (Includes.Num() > 0 && !MatchesAny(FindValue, Includes))
+    {
+        return false;
+    }
+
+    return !MatchesAny(FindValue, Excludes);
+}
+
+FDSViewFilterReport FDSMetadataViewFilter::Apply(AActor* Actor, bool bOnlyNew)
+{
+    FDSViewFilterReport Report;
+
+    if (FilteredActor.Get() != Actor)
+    {
+        // Components of a previous actor are not ours to restore anymore
+        Filtered.Reset();
+        Evaluated.Reset();
+        FilteredActor = Actor;
+    }
+
+    if (!IsValid(Actor))
+    {
+        return Report;
+    }
+
+    if (!bOnlyNew)
+    {
+        // Metadata may have changed with the update, everything is evaluated again
+        Evaluated.Reset();
+    }
+
+    TArray<UPrimitiveComponent*> Primitives;
+    Actor->GetComponents(Primitives);
+
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+        if (!IsValid(Primitive))
+        {
+            continue;
+        }
+
+        bool bAlreadyEvaluated = false;
+        Evaluated.Add(Primitive, &bAlreadyEvaluated);
+        if (bAlreadyEvaluated)
+        {
+            continue;
+        }
+
+        ++Report.NumEvaluated;
+        if (Passes(Primitive))
+        {
+            if (Filtered.Remove(Primitive) > 0 && !Primitive->IsRegistered())
+            {
+                Primitive->RegisterComponent();
+                ++Report.NumRestored;
+            }
+        }
+        else
+        {
+            // Registered again by the importer when an update touches it, so checked every pass
+            if (Primitive->IsRegistered())
+            {
+                Primitive->UnregisterComponent();
+            }
+            Filtered.Add(Primitive);
+        }
+    }
+
+    for (auto It = Filtered.CreateIterator(); It; ++It)
+    {
+        if (!It->IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    Report.NumFiltered = Filtered.Num();
+    return Report;
+}
+
+int32 FDSMetadataViewFilter::Restore()
+{
+    int32 NumRestored = 0;
+    for (const TWeakObjectPtr<UPrimitiveComponent>& Primitive : Filtered)
+    {
+        if (Primitive.IsValid() && !Primitive->IsRegistered())
+        {
+            Primitive->RegisterComponent();
+            ++NumRestored;
+        }
+    }
+
+    Filtered.Reset();
+    Evaluated.Reset();
+    return NumRestored;
+}
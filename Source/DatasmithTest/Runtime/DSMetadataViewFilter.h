@@ -0,0 +1,129 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class AActor;
+class UPrimitiveComponent;
+class USceneComponent;
+
+/**
+ * Single "Key=Pattern" condition on element metadata
+ */
+struct FDSViewFilterRule
+{
+    FName Key;
+
+    /** Wildcard pattern (* and ?) matched case-insensitively against the metadata value */
+    FString Pattern;
+
+    /**
+     * Parses a rule of the form "Key=Pattern"
+     * @return False if the text has no key
+     */
+    static bool Parse(const FString& Text, FDSViewFilterRule& OutRule);
+};
+
+/**
+ * Summary of a filter pass
+ */
+struct FDSViewFilterReport
+{
+    int32 NumEvaluated = 0;
+    int32 NumFiltered = 0;
+    int32 NumRestored = 0;
+
+    /**
+     * Writes the report to the log
+     */
+    void Log() const;
+};
+
+/**
+ * FDSMetadataViewFilter - Hides the imported elements whose metadata does not match include/exclude rules
+ *
+ * An element passes when it matches at least one include rule (or there are none) and no
+ * exclude rule. Metadata is looked up on the element first, then on its closest ancestor
+ * that has the key, so assembly level properties such as a level or discipline apply to
+ * every part below.
+ *
+ * Received elements are filtered by the runtime actor before it builds them, see
+ * ADSDatasmithRuntimeActor. Components that were already built when the rules changed are
+ * evaluated here instead and unregistered, which saves their render proxies, physics bodies
+ * and post-import passes while the importer keeps owning them so later changes can bring
+ * them back.
+ */
+class DATASMITHTEST_API FDSMetadataViewFilter
+{
+public:
+    /**
+     * @param IncludeRules Rules of the form "Key=Pattern", an element must match one of them
+     * @param ExcludeRules Rules of the form "Key=Pattern", an element must match none of them
+     */
+    FDSMetadataViewFilter(const TArray<FString>& IncludeRules, const TArray<FString>& ExcludeRules);
+
+    /**
+     * Checks whether the filter has any rule
+     */
+    bool IsEmpty() const { return Includes.Num() == 0 && Excludes.Num() == 0; }
+
+    /**
+     * Checks whether a component passes the rules
+     */
+    bool Passes(const USceneComponent* Component) const;
+
+    /**
+     * Checks whether an element passes the rules
+     * @param FindValue Gets the value of a key on the element or its closest ancestor that has it
+     */
+    bool Passes(TFunctionRef<bool(FName Key, FString& OutValue)> FindValue) const;
+
+    /**
+     * Evaluates the actor's primitives and unregisters the ones that do not pass
+     * @param Actor Actor owning the imported components
+     * @param bOnlyNew Only evaluate components not seen before, used while an import is streaming in
+     * @return Report of this pass
+     */
+    FDSViewFilterReport Apply(AActor* Actor, bool bOnlyNew);
+
+    /**
+     * Registers every component this filter has unregistered again
+     * @return Number of components restored
+     */
+    int32 Restore();
+
+    /**
+     * Gets the number of components currently filtered out
+     */
+    int32 GetNumFiltered() const { return Filtered.Num(); }
+
+private:
+    /**
+     * Gets the metadata value of a component or its closest ancestor that has the key
+     * @return False if neither has the key
+     */
+    static bool FindMetadataValue(const USceneComponent* Component, FName Key, FString& OutValue);
+
+    /**
+     * Checks whether any rule matches the metadata returned by the lookup
+     */
+    static bool MatchesAny(TFunctionRef<bool(FName Key, FString& OutValue)> FindValue, const TArray<FDSViewFilterRule>& Rules);
+
+    TArray<FDSViewFilterRule> Includes;
+    TArray<FDSViewFilterRule> Excludes;
+
+    TWeakObjectPtr<AActor> FilteredActor;
+    TSet<TWeakObjectPtr<UPrimitiveComponent>> Filtered;
+    TSet<TWeakObjectPtr<UPrimitiveComponent>> Evaluated;
+};
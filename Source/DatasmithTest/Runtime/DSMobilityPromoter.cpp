@@ -0,0 +1,211 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSMobilityPromoter.h"
+#include "GameFramework/Actor.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Materials/MaterialInterface.h"
+
+// Logging category for the mobility promoter
+DEFINE_LOG_CATEGORY_STATIC(LogDSMobilityPromoter, Log, All);
+
+void FDSMobilityPromotionReport::Log() const
+{
+    UE_LOG(LogDSMobilityPromoter, Log, TEXT("Mobility promotion: %d primitives tracked, %d changed by the update, %d promoted, %d static"),
+           NumTracked, NumChanged, NumPromoted, NumStatic);
+}
+
+FDSMobilityPromoter::FDSMobilityPromoter(int32 InRequiredUpdates)
+    : RequiredUpdates(FMath::Max(InRequiredUpdates, 1))
+{
+}
+
+uint32 FDSMobilityPromoter::ComputeAssetHash(const UPrimitiveComponent* Primitive)
+{
+    uint32 Hash = 0;
+    if (const UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Primitive))
+    {
+        Hash = GetTypeHash(MeshComponent->GetStaticMesh());
+    }
+
+    for (int32 MaterialIndex = 0; MaterialIndex < Primitive->GetNumMaterials(); ++MaterialIndex)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Primitive->GetMaterial(MaterialIndex)));
+    }
+    return Hash;
+}
+
+FDSMobilityPromotionReport FDSMobilityPromoter::Update(AActor* Actor)
+{
+    FDSMobilityPromotionReport Report;
+
+    if (TrackedActor.Get() != Actor)
+    {
+        // A different actor means a new scene, the old one is no longer updated and keeps its mobility
+        Fingerprints.Reset();
+        Promoted.Reset();
+        TrackedActor = Actor;
+    }
+
+    if (!IsValid(Actor))
+    {
+        return Report;
+    }
+
+    TArray<UPrimitiveComponent*> Primitives;
+    Actor->GetComponents(Primitives);
+
+    // Components removed by the update are dropped from tracking
+    for (auto It = Fingerprints.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    TArray<UPrimitiveComponent*> Stable;
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+        if (!IsValid(Primitive) || !Primitive->IsRegistered())
+        {
+            continue;
+        }
+
+        const FTransform Transform = Primitive->GetComponentTransform();
+        const uint32 AssetHash = ComputeAssetHash(Primitive);
+
+        FFingerprint* Fingerprint = Fingerprints.Find(Primitive);
+        if (!Fingerprint)
+        {
+            Fingerprint = &Fingerprints.Add(Primitive);
+        }
+        else if (Fingerprint->AssetHash == AssetHash && Fingerprint->Transform.Equals(Transform, KINDA_SMALL_NUMBER))
+        {
+            ++Fingerprint->UnchangedUpdates;
+        }
+        else
+        {
+            Fingerprint->UnchangedUpdates = 0;
+            ++Report.NumChanged;
+        }
+
+        Fingerprint->Transform = Transform;
+        Fingerprint->AssetHash = AssetHash;
+
+        if (Fingerprint->UnchangedUpdates >= RequiredUpdates)
+        {
+            Stable.Add(Primitive);
+        }
+    }
+
+    const int32 NumStaticBefore = Promoted.Num();
+    for (UPrimitiveComponent* Primitive : Stable)
+    {
+        if (Primitive->Mobility == EComponentMobility::Static)
+        {
+            continue;
+        }
+
+        // A static component must not hang below a movable one, so its ancestors are promoted first
+        TArray<USceneComponent*> Chain;
+        for (USceneComponent* Parent = Primitive->GetAttachParent(); Parent && Parent->GetOwner() == Actor; Parent = Parent->GetAttachParent())
+        {
+            Chain.Add(Parent);
+        }
+
+        for (int32 ChainIndex = Chain.Num() - 1; ChainIndex >= 0; --ChainIndex)
+        {
+            Promote(Chain[ChainIndex]);
+        }
+        Promote(Primitive);
+        ++Report.NumPromoted;
+    }
+
+    Report.NumTracked = Fingerprints.Num();
+    Report.NumStatic = Promoted.Num();
+
+    UE_LOG(LogDSMobilityPromoter, Verbose, TEXT("Promoted %d components including ancestors"), Promoted.Num() - NumStaticBefore);
+    return Report;
+}
+
+void FDSMobilityPromoter::Promote(USceneComponent* Component)
+{
+    if (Component->Mobility == EComponentMobility::Static)
+    {
+        return;
+    }
+
+    FPromotion& Promotion = Promoted.AddDefaulted_GetRef();
+    Promotion.Component = Component;
+    Promotion.OriginalMobility = Component->Mobility;
+
+    Component->SetMobility(EComponentMobility::Static);
+}
+
+int32 FDSMobilityPromoter::Demote()
+{
+    // Children before parents, so no static component is ever left below a movable one
+    int32 NumDemoted = 0;
+    for (int32 Index = Promoted.Num() - 1; Index >= 0; --Index)
+    {
+        if (USceneComponent* Component = Promoted[Index].Component.Get())
+        {
+            Component->SetMobility(Promoted[Index].OriginalMobility);
+            ++NumDemoted;
+        }
+    }
+
+    Promoted.Reset();
+    return NumDemoted;
+}
+
+int32 FDSMobilityPromoter::Demote(TFunctionRef<bool(const USceneComponent*)> IsTouched)
+{
+    // A component is demoted when it or any ancestor is touched, ancestors are shared so their answers are cached
+    TMap<const USceneComponent*, bool> TouchedCache;
+    TFunction<bool(const USceneComponent*)> IsTouchedOrBelowTouched = [&](const USceneComponent* Component) -> bool
+    {
+        if (!Component)
+        {
+            return false;
+        }
+
+        if (const bool* Cached = TouchedCache.Find(Component))
+        {
+            return *Cached;
+        }
+
+        const bool bTouched = IsTouched(Component) || IsTouchedOrBelowTouched(Component->GetAttachParent());
+        TouchedCache.Add(Component, bTouched);
+        return bTouched;
+    };
+
+    // Children before parents, so no static component is ever left below a movable one
+    int32 NumDemoted = 0;
+    for (int32 Index = Promoted.Num() - 1; Index >= 0; --Index)
+    {
+        USceneComponent* Component = Promoted[Index].Component.Get();
+        if (!Component)
+        {
+            Promoted.RemoveAt(Index);
+        }
+        else if (IsTouchedOrBelowTouched(Component))
+        {
+            Component->SetMobility(Promoted[Index].OriginalMobility);
+            Promoted.RemoveAt(Index);
+            ++NumDemoted;
+        }
+    }
+
+    return NumDemoted;
+}
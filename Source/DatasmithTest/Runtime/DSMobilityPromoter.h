@@ -0,0 +1,117 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class AActor;
+class UPrimitiveComponent;
+class USceneComponent;
+
+/**
+ * Summary of a mobility promotion update
+ */
+struct FDSMobilityPromotionReport
+{
+    int32 NumTracked = 0;
+    int32 NumChanged = 0;
+    int32 NumPromoted = 0;
+    int32 NumStatic = 0;
+
+    /**
+     * Writes the report to the log
+     */
+    void Log() const;
+};
+
+/**
+ * FDSMobilityPromoter - Switches imported components that stopped changing to static mobility
+ *
+ * The runtime importer creates movable components so DirectLink updates can move them, which
+ * costs per-frame bounds updates, dynamic shadow handling and uncached draw commands. The
+ * promoter fingerprints every imported primitive (world transform, mesh and materials) after
+ * each completed update, and components unchanged for the required number of updates become
+ * static along with their ancestors.
+ *
+ * Before an update is applied, Demote restores the original mobility of the components it
+ * touches along with their promoted descendants, so the importer can move them; everything
+ * else stays static. A new scene demotes everything. Unchanged components keep their counts
+ * and demoted ones are promoted again once they have stayed unchanged long enough.
+ */
+class DATASMITHTEST_API FDSMobilityPromoter
+{
+public:
+    /**
+     * @param InRequiredUpdates Number of consecutive unchanged updates before a component is promoted
+     */
+    explicit FDSMobilityPromoter(int32 InRequiredUpdates);
+
+    /**
+     * Fingerprints the actor's primitives after a completed update and promotes the stable ones.
+     * Tracking starts over when called with a different actor.
+     * @param Actor Actor owning the imported components
+     * @return Report for this update
+     */
+    FDSMobilityPromotionReport Update(AActor* Actor);
+
+    /**
+     * Restores the original mobility of every promoted component, must run before an update modifies them
+     * @return Number of components demoted
+     */
+    int32 Demote();
+
+    /**
+     * Restores the original mobility of the promoted components an update touches, and of every promoted
+     * component below them since static components cannot follow a moving parent
+     * @param IsTouched Whether the update changes a component
+     * @return Number of components demoted
+     */
+    int32 Demote(TFunctionRef<bool(const USceneComponent*)> IsTouched);
+
+    /**
+     * Gets the number of components currently promoted
+     */
+    int32 GetNumPromoted() const { return Promoted.Num(); }
+
+private:
+    struct FFingerprint
+    {
+        FTransform Transform;
+        uint32 AssetHash = 0;
+        int32 UnchangedUpdates = 0;
+    };
+
+    struct FPromotion
+    {
+        TWeakObjectPtr<USceneComponent> Component;
+        EComponentMobility::Type OriginalMobility = EComponentMobility::Movable;
+    };
+
+    /**
+     * Hashes the mesh and materials a primitive renders with
+     */
+    static uint32 ComputeAssetHash(const UPrimitiveComponent* Primitive);
+
+    /**
+     * Makes a component static, recording its original mobility
+     */
+    void Promote(USceneComponent* Component);
+
+    int32 RequiredUpdates;
+
+    TWeakObjectPtr<AActor> TrackedActor;
+    TMap<TWeakObjectPtr<UPrimitiveComponent>, FFingerprint> Fingerprints;
+
+    /** Promoted components in promotion order, parents before their children */
+    TArray<FPromotion> Promoted;
+};
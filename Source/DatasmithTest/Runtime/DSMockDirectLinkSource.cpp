@@ -0,0 +1,309 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSMockDirectLinkSource.h"
+#include "DatasmithSceneFactory.h"
+#include "DatasmithSceneXmlReader.h"
+#include "IDatasmithSceneElements.h"
+#include "DirectLinkEndpoint.h"
+#include "Misc/FileHelper.h"
+
+// Logging category for the mock DirectLink source
+DEFINE_LOG_CATEGORY_STATIC(LogDSMockDirectLinkSource, Log, All);
+
+namespace DSMockDirectLinkSource
+{
+    static const TCHAR* EditNames[] = { TEXT("move"), TEXT("add"), TEXT("delete"), TEXT("material") };
+
+    /** Largest offset of a move edit (cm) */
+    static constexpr float MoveDistance = 50.0f;
+}
+
+void FDSMockSourceReport::Log() const
+{
+    UE_LOG(LogDSMockDirectLinkSource, Log, TEXT("=== Mock DirectLink Source Report ==="));
+    UE_LOG(LogDSMockDirectLinkSource, Log, TEXT("Updates: %d, Moved: %d, Added: %d, Deleted: %d, Material changes: %d"), NumUpdates,
+           NumEdits[(int32)EDSMockEditType::Move], NumEdits[(int32)EDSMockEditType::Add], NumEdits[(int32)EDSMockEditType::Delete], NumEdits[(int32)EDSMockEditType::Material]);
+    UE_LOG(LogDSMockDirectLinkSource, Log, TEXT("Snapshot: %.2f ms average, %.2f ms max"),
+           NumUpdates > 0 ? TotalSnapshotSeconds * 1000.0 / NumUpdates : 0.0, MaxSnapshotSeconds * 1000.0);
+}
+
+FDSMockDirectLinkSource::FDSMockDirectLinkSource()
+    : Endpoint(MakeUnique<DirectLink::FEndpoint>(TEXT("DatasmithTest Mock Source")))
+    , Random(1)
+{
+}
+
+FDSMockDirectLinkSource::~FDSMockDirectLinkSource()
+{
+    if (Endpoint.IsValid() && Source.IsValid())
+    {
+        Endpoint->RemoveSource(Source);
+    }
+}
+
+bool FDSMockDirectLinkSource::Open(const FString& ScenePath)
+{
+    TSharedRef<IDatasmithScene> NewScene = FDatasmithSceneFactory::CreateScene(TEXT(""));
+    if (!FDatasmithSceneXmlReader().ParseFile(ScenePath, NewScene))
+    {
+        UE_LOG(LogDSMockDirectLinkSource, Error, TEXT("Failed to read scene %s"), *ScenePath);
+        return false;
+    }
+
+    if (Source.IsValid())
+    {
+        Endpoint->RemoveSource(Source);
+    }
+
+    Scene = NewScene;
+    GatherMeshActors();
+
+    // Public so the runtime manager lists it among its sources
+    Source = Endpoint->AddSource(Scene->GetName(), DirectLink::EVisibility::Public);
+    Endpoint->SetSourceRoot(Source, Scene.Get(), false);
+    SendUpdate();
+
+    UE_LOG(LogDSMockDirectLinkSource, Log, TEXT("Serving %s as source '%s' with %d mesh actors"), *ScenePath, Scene->GetName(), MeshActors.Num());
+    return true;
+}
+
+void FDSMockDirectLinkSource::SendUpdate()
+{
+    if (!Source.IsValid())
+    {
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    Endpoint->SnapshotSource(Source);
+    const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+    ++Report.NumUpdates;
+    Report.TotalSnapshotSeconds += Seconds;
+    Report.MaxSnapshotSeconds = FMath::Max(Report.MaxSnapshotSeconds, Seconds);
+}
+
+void FDSMockDirectLinkSource::ApplyStep(const FDSMockEditStep& Step)
+{
+    if (!Scene.IsValid())
+    {
+        return;
+    }
+
+    // Deletes first, so the other edits of the step never touch an actor about to go away
+    DeleteActors(Step.Counts[(int32)EDSMockEditType::Delete]);
+    MoveActors(Step.Counts[(int32)EDSMockEditType::Move]);
+    ChangeMaterials(Step.Counts[(int32)EDSMockEditType::Material]);
+    AddActors(Step.Counts[(int32)EDSMockEditType::Add]);
+
+    SendUpdate();
+
+    UE_LOG(LogDSMockDirectLinkSource, Log, TEXT("Update %d at %.2f s: moved %d, added %d, deleted %d, material changes %d, %d mesh actors"), Report.NumUpdates, Step.Time,
+           Step.Counts[(int32)EDSMockEditType::Move], Step.Counts[(int32)EDSMockEditType::Add], Step.Counts[(int32)EDSMockEditType::Delete], Step.Counts[(int32)EDSMockEditType::Material],
+           MeshActors.Num());
+}
+
+void FDSMockDirectLinkSource::MoveActors(int32 Count)
+{
+    for (int32 Edit = 0; Edit < Count && MeshActors.Num() > 0; ++Edit)
+    {
+        IDatasmithMeshActorElement& Actor = *MeshActors[Random.RandHelper(MeshActors.Num())].Key;
+        const FVector Offset(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), 0.0f);
+        Actor.SetTranslation(Actor.GetTranslation() + Offset * DSMockDirectLinkSource::MoveDistance);
+        ++Report.NumEdits[(int32)EDSMockEditType::Move];
+    }
+}
+
+void FDSMockDirectLinkSource::AddActors(int32 Count)
+{
+    if (Scene->GetMeshesCount() == 0)
+    {
+        return;
+    }
+
+    for (int32 Edit = 0; Edit < Count; ++Edit)
+    {
+        const TSharedPtr<IDatasmithMeshElement> Mesh = Scene->GetMesh(Random.RandHelper(Scene->GetMeshesCount()));
+
+        TSharedRef<IDatasmithMeshActorElement> Actor = FDatasmithSceneFactory::CreateMeshActor(*FString::Printf(TEXT("MockAdded_%d"), NumAddedActors));
+        Actor->SetLabel(*FString::Printf(TEXT("Mock Added %d"), NumAddedActors));
+        Actor->SetStaticMeshPathName(Mesh->GetName());
+
+        // Next to an existing actor, so added content lands inside the scene bounds
+        if (MeshActors.Num() > 0)
+        {
+            const TSharedPtr<IDatasmithMeshActorElement>& Neighbour = MeshActors[Random.RandHelper(MeshActors.Num())].Key;
+            Actor->SetTranslation(Neighbour->GetTranslation() + FVector(0.0, 0.0, DSMockDirectLinkSource::MoveDistance * 4.0f));
+        }
+
+        Scene->AddActor(Actor);
+        MeshActors.Emplace(Actor, nullptr);
+        ++NumAddedActors;
+        ++Report.NumEdits[(int32)EDSMockEditType::Add];
+    }
+}
+
+void FDSMockDirectLinkSource::DeleteActors(int32 Count)
+{
+    // Only leaves are deleted: removing a mesh actor with children would take them along while they stay
+    // in MeshActors, and later edits would then go to actors that are no longer in the scene
+    TArray<int32> LeafIndices;
+    for (int32 ActorIndex = 0; ActorIndex < MeshActors.Num(); ++ActorIndex)
+    {
+        if (MeshActors[ActorIndex].Key->GetChildrenCount() == 0)
+        {
+            LeafIndices.Add(ActorIndex);
+        }
+    }
+
+    for (int32 Edit = 0; Edit < Count && LeafIndices.Num() > 0; ++Edit)
+    {
+        const int32 LeafIndex = Random.RandHelper(LeafIndices.Num());
+        const int32 ActorIndex = LeafIndices[LeafIndex];
+        const TSharedPtr<IDatasmithMeshActorElement> Actor = MeshActors[ActorIndex].Key;
+        const TSharedPtr<IDatasmithActorElement> Parent = MeshActors[ActorIndex].Value;
+
+        if (Parent.IsValid())
+        {
+            Parent->RemoveChild(Actor.ToSharedRef());
+        }
+        else
+        {
+            Scene->RemoveActor(Actor.ToSharedRef(), EDatasmithActorRemovalRule::RemoveChildren);
+        }
+
+        // RemoveAtSwap moves the last actor into the freed slot, its leaf entry has to follow
+        const int32 LastIndex = MeshActors.Num() - 1;
+        MeshActors.RemoveAtSwap(ActorIndex);
+        LeafIndices.RemoveAtSwap(LeafIndex);
+        if (ActorIndex != LastIndex)
+        {
+            const int32 MovedLeafIndex = LeafIndices.Find(LastIndex);
+            if (MovedLeafIndex != INDEX_NONE)
+            {
+                LeafIndices[MovedLeafIndex] = ActorIndex;
+            }
+        }
+        ++Report.NumEdits[(int32)EDSMockEditType::Delete];
+    }
+}
+
+void FDSMockDirectLinkSource::ChangeMaterials(int32 Count)
+{
+    if (Scene->GetMaterialsCount() == 0)
+    {
+        return;
+    }
+
+    for (int32 Edit = 0; Edit < Count && MeshActors.Num() > 0; ++Edit)
+    {
+        IDatasmithMeshActorElement& Actor = *MeshActors[Random.RandHelper(MeshActors.Num())].Key;
+        const TSharedPtr<IDatasmithBaseMaterialElement> Material = Scene->GetMaterial(Random.RandHelper(Scene->GetMaterialsCount()));
+
+        // Slot -1 overrides every slot of the mesh
+        Actor.ResetMaterialOverrides();
+        Actor.AddMaterialOverride(Material->GetName(), -1);
+        ++Report.NumEdits[(int32)EDSMockEditType::Material];
+    }
+}
+
+void FDSMockDirectLinkSource::GatherMeshActors()
+{
+    MeshActors.Reset();
+
+    TArray<TPair<TSharedPtr<IDatasmithActorElement>, TSharedPtr<IDatasmithActorElement>>> Stack;
+    for (int32 ActorIndex = 0; ActorIndex < Scene->GetActorsCount(); ++ActorIndex)
+    {
+        Stack.Emplace(Scene->GetActor(ActorIndex), nullptr);
+    }
+
+    while (Stack.Num() > 0)
+    {
+        const TPair<TSharedPtr<IDatasmithActorElement>, TSharedPtr<IDatasmithActorElement>> Entry = Stack.Pop(EAllowShrinking::No);
+        const TSharedPtr<IDatasmithActorElement>& Actor = Entry.Key;
+
+        if (Actor->IsA(EDatasmithElementType::StaticMeshActor))
+        {
+            MeshActors.Emplace(StaticCastSharedPtr<IDatasmithMeshActorElement>(Actor), Entry.Value);
+        }
+
+        for (int32 ChildIndex = 0; ChildIndex < Actor->GetChildrenCount(); ++ChildIndex)
+        {
+            Stack.Emplace(Actor->GetChild(ChildIndex), Actor);
+        }
+    }
+}
+
+bool FDSMockDirectLinkSource::LoadScript(const FString& FilePath, TArray<FDSMockEditStep>& OutSteps)
+{
+    TArray<FString> Lines;
+    if (!FFileHelper::LoadFileToStringArray(Lines, *FilePath))
+    {
+        UE_LOG(LogDSMockDirectLinkSource, Error, TEXT("Failed to read script %s"), *FilePath);
+        return false;
+    }
+
+    OutSteps.Reset();
+    for (int32 LineIndex = 0; LineIndex < Lines.Num(); ++LineIndex)
+    {
+        const FString Line = Lines[LineIndex].TrimStartAndEnd();
+        if (Line.IsEmpty() || Line.StartsWith(TEXT("#")))
+        {
+            continue;
+        }
+
+        TArray<FString> Fields;
+        Line.ParseIntoArrayWS(Fields);
+
+        int32 EditType = INDEX_NONE;
+        if (Fields.Num() == 3)
+        {
+            for (int32 TypeIndex = 0; TypeIndex < UE_ARRAY_COUNT(DSMockDirectLinkSource::EditNames); ++TypeIndex)
+            {
+                if (Fields[1].Equals(DSMockDirectLinkSource::EditNames[TypeIndex], ESearchCase::IgnoreCase))
+                {
+                    EditType = TypeIndex;
+                }
+            }
+        }
+
+        if (EditType == INDEX_NONE)
+        {
+            UE_LOG(LogDSMockDirectLinkSource, Error, TEXT("%s(%d): expected '<Seconds> <move|add|delete|material> <Count>'"), *FilePath, LineIndex + 1);
+            return false;
+        }
+
+        const double Time = FCString::Atod(*Fields[0]);
+        FDSMockEditStep* Step = OutSteps.FindByPredicate([Time](const FDSMockEditStep& Existing) { return Existing.Time == Time; });
+        if (!Step)
+        {
+            Step = &OutSteps.AddDefaulted_GetRef();
+            Step->Time = Time;
+        }
+        Step->Counts[EditType] += FCString::Atoi(*Fields[2]);
+    }
+
+    OutSteps.Sort([](const FDSMockEditStep& A, const FDSMockEditStep& B) { return A.Time < B.Time; });
+    return true;
+}
+
+TArray<FDSMockEditStep> FDSMockDirectLinkSource::MakeRateScript(int32 NumSteps, double Interval, const int32 (&Counts)[4])
+{
+    TArray<FDSMockEditStep> Steps;
+    for (int32 StepIndex = 0; StepIndex < NumSteps; ++StepIndex)
+    {
+        FDSMockEditStep& Step = Steps.AddDefaulted_GetRef();
+        Step.Time = (StepIndex + 1) * Interval;
+        FMemory::Memcpy(Step.Counts, Counts, sizeof(Step.Counts));
+    }
+    return Steps;
+}
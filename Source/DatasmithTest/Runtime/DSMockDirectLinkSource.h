@@ -0,0 +1,149 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DirectLinkCommon.h"
+
+// Forward declarations
+class IDatasmithScene;
+class IDatasmithActorElement;
+class IDatasmithMeshActorElement;
+namespace DirectLink { class FEndpoint; }
+
+/**
+ * Kinds of scripted scene edits
+ */
+enum class EDSMockEditType : uint8
+{
+    Move,     // Offsets mesh actors
+    Add,      // Adds mesh actors using existing meshes
+    Delete,   // Removes mesh actors
+    Material, // Overrides the material of mesh actors
+};
+
+/**
+ * One step of an edit script: edits sent together in a single update
+ */
+struct FDSMockEditStep
+{
+    /** Seconds after the script starts */
+    double Time = 0.0;
+
+    /** Number of actors affected per edit type */
+    int32 Counts[4] = { 0, 0, 0, 0 };
+};
+
+/**
+ * What the mock source has sent
+ */
+struct FDSMockSourceReport
+{
+    int32 NumUpdates = 0;
+    int32 NumEdits[4] = { 0, 0, 0, 0 };
+
+    /** Time spent snapshotting the scene for DirectLink, which diffs it against the last update */
+    double TotalSnapshotSeconds = 0.0;
+    double MaxSnapshotSeconds = 0.0;
+
+    /**
+     * Writes the report to the log
+     */
+    void Log() const;
+};
+
+/**
+ * FDSMockDirectLinkSource - Serves a Datasmith scene from disk as a DirectLink source
+ *
+ * Stands in for a CAD application with a DirectLink exporter, so source enumeration, connection
+ * and incremental updates of the runtime manager can be exercised without one. The scene is
+ * published under its name, then an edit script moves, adds, deletes and re-materials mesh
+ * actors at controlled times; each step goes out as one DirectLink update, which only carries
+ * the elements that changed.
+ *
+ * Script files have one step per line, steps with the same time are merged:
+ *   # Seconds Edit Count
+ *   1.0 move 100
+ *   1.0 material 20
+ *   2.5 add 50
+ *   4.0 delete 10
+ */
+class DATASMITHTEST_API FDSMockDirectLinkSource
+{
+public:
+    FDSMockDirectLinkSource();
+    ~FDSMockDirectLinkSource();
+
+    /**
+     * Seeds the choice of actors and materials edits apply to
+     */
+    void SetSeed(int32 Seed) { Random.Initialize(Seed); }
+
+    /**
+     * Loads a .udatasmith scene and publishes it as a source
+     * @return False if the scene could not be read
+     */
+    bool Open(const FString& ScenePath);
+
+    /**
+     * Sends the current state of the scene to connected destinations
+     */
+    void SendUpdate();
+
+    /**
+     * Applies the edits of a step and sends them as one update
+     */
+    void ApplyStep(const FDSMockEditStep& Step);
+
+    /**
+     * Reads an edit script
+     * @return False if the file could not be read or has a malformed line
+     */
+    static bool LoadScript(const FString& FilePath, TArray<FDSMockEditStep>& OutSteps);
+
+    /**
+     * Builds a script of evenly spaced identical steps
+     * @param NumSteps Number of updates
+     * @param Interval Seconds between updates
+     * @param Counts Actors affected per update, indexed by EDSMockEditType
+     */
+    static TArray<FDSMockEditStep> MakeRateScript(int32 NumSteps, double Interval, const int32 (&Counts)[4]);
+
+    /**
+     * Gets the number of mesh actors currently in the scene
+     */
+    int32 GetNumMeshActors() const { return MeshActors.Num(); }
+
+    const FDSMockSourceReport& GetReport() const { return Report; }
+
+private:
+    void MoveActors(int32 Count);
+    void AddActors(int32 Count);
+    void DeleteActors(int32 Count);
+    void ChangeMaterials(int32 Count);
+
+    /**
+     * Collects the mesh actors of the scene hierarchy
+     */
+    void GatherMeshActors();
+
+    TUniquePtr<DirectLink::FEndpoint> Endpoint;
+    DirectLink::FSourceHandle Source;
+    TSharedPtr<IDatasmithScene> Scene;
+
+    /** Mesh actors edits pick from, with the parent each one is attached to */
+    TArray<TPair<TSharedPtr<IDatasmithMeshActorElement>, TSharedPtr<IDatasmithActorElement>>> MeshActors;
+
+    FRandomStream Random;
+    int32 NumAddedActors = 0;
+    FDSMockSourceReport Report;
+};
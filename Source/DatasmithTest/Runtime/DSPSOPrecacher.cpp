@@ -0,0 +1,150 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSPSOPrecacher.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Materials/MaterialInterface.h"
+#include "LocalVertexFactory.h"
+#include "PSOPrecache.h"
+#include "ShaderPipelineCache.h"
+#include "PipelineFileCache.h"
+#include "RHIShaderPlatform.h"
+#include "HAL/IConsoleManager.h"
+
+// Logging category for the PSO precacher
+DEFINE_LOG_CATEGORY_STATIC(LogDSPSOPrecacher, Log, All);
+
+int32 FDSPSOPrecacher::Start(const TArray<UPrimitiveComponent*>& Primitives)
+{
+    Reset();
+
+    // Unique material and primitive setting combinations, several components usually share one
+    struct FPrecacheKey
+    {
+        UMaterialInterface* Material;
+        EComponentMobility::Type Mobility;
+        bool bCastShadow;
+
+        bool operator==(const FPrecacheKey& Other) const
+        {
+            return Material == Other.Material && Mobility == Other.Mobility && bCastShadow == Other.bCastShadow;
+        }
+
+        friend uint32 GetTypeHash(const FPrecacheKey& Key)
+        {
+            return HashCombine(GetTypeHash(Key.Material), HashCombine((uint32)Key.Mobility, (uint32)Key.bCastShadow));
+        }
+    };
+
+    TSet<FPrecacheKey> Keys;
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+        // Imported geometry is rendered through the local vertex factory of static mesh components
+        if (!IsValid(Primitive) || !Primitive->IsA<UStaticMeshComponent>())
+        {
+            continue;
+        }
+
+        for (int32 MaterialIndex = 0; MaterialIndex < Primitive->GetNumMaterials(); ++MaterialIndex)
+        {
+            if (UMaterialInterface* Material = Primitive->GetMaterial(MaterialIndex))
+            {
+                Keys.Add({ Material, Primitive->Mobility.GetValue(), Primitive->CastShadow != 0 });
+            }
+        }
+    }
+
+    const FVertexFactoryType* VertexFactoryType = &FLocalVertexFactory::StaticType;
+    for (const FPrecacheKey& Key : Keys)
+    {
+        FPSOPrecacheParams Params;
+        Params.SetMobility(Key.Mobility);
+        Params.bCastShadow = Key.bCastShadow;
+
+        TArray<FMaterialPSOPrecacheRequestID> RequestIDs;
+        PendingEvents.Append(Key.Material->PrecachePSOs(VertexFactoryType, Params, EPSOPrecachePriority::High, RequestIDs));
+    }
+
+    NumRequested = PendingEvents.Num();
+    NumCachePrecompilesAtStart = FShaderPipelineCache::NumPrecompilesRemaining();
+
+    UE_LOG(LogDSPSOPrecacher, Log, TEXT("Precaching PSOs for %d material combinations (%d compile tasks, %d pending from pipeline cache)"),
+           Keys.Num(), NumRequested, NumCachePrecompilesAtStart);
+
+    return Keys.Num();
+}
+
+void FDSPSOPrecacher::Reset()
+{
+    PendingEvents.Reset();
+    NumRequested = 0;
+    NumCachePrecompilesAtStart = 0;
+}
+
+float FDSPSOPrecacher::GetProgress() const
+{
+    const int32 Total = NumRequested + NumCachePrecompilesAtStart;
+    if (Total == 0)
+    {
+        return 1.0f;
+    }
+
+    return FMath::Clamp(1.0f - (float)GetNumRemaining() / Total, 0.0f, 1.0f);
+}
+
+int32 FDSPSOPrecacher::GetNumRemaining() const
+{
+    int32 NumRemaining = 0;
+    for (const FGraphEventRef& Event : PendingEvents)
+    {
+        if (Event.IsValid() && !Event->IsComplete())
+        {
+            ++NumRemaining;
+        }
+    }
+
+    // Only count cache precompiles that were pending when we started, new ones belong to other work
+    NumRemaining += FMath::Min((int32)FShaderPipelineCache::NumPrecompilesRemaining(), NumCachePrecompilesAtStart);
+    return NumRemaining;
+}
+
+void FDSPSOPrecacher::OpenPersistentCache()
+{
+    if (FShaderPipelineCache::OpenPipelineFileCache(GMaxRHIShaderPlatform))
+    {
+        UE_LOG(LogDSPSOPrecacher, Log, TEXT("Opened persistent pipeline cache, %d precompiles pending"), FShaderPipelineCache::NumPrecompilesRemaining());
+    }
+}
+
+void FDSPSOPrecacher::SetFastPrecompile(bool bFast)
+{
+    FShaderPipelineCache::SetBatchMode(bFast ? FShaderPipelineCache::BatchMode::Fast : FShaderPipelineCache::BatchMode::Background);
+}
+
+void FDSPSOPrecacher::SetRecording(bool bEnabled)
+{
+    for (const TCHAR* Name : { TEXT("r.ShaderPipelineCache.LogPSO"), TEXT("r.ShaderPipelineCache.SaveUserCache") })
+    {
+        if (IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(Name))
+        {
+            CVar->Set(bEnabled ? 1 : 0, ECVF_SetByCode);
+        }
+    }
+}
+
+void FDSPSOPrecacher::SavePersistentCache()
+{
+    if (FShaderPipelineCache::SavePipelineFileCache(FPipelineFileCacheManager::SaveMode::Incremental))
+    {
+        UE_LOG(LogDSPSOPrecacher, Log, TEXT("Saved newly recorded PSOs to the persistent pipeline cache"));
+    }
+}
@@ -0,0 +1,95 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/TaskGraphInterfaces.h"
+
+// Forward declarations
+class UPrimitiveComponent;
+
+/**
+ * FDSPSOPrecacher - Compiles pipeline states for imported materials ahead of first use
+ *
+ * Gathers the unique material / vertex factory / primitive setting combinations used by
+ * the imported components and requests their pipeline states on the engine's background
+ * compile threads. Progress can be polled while the scene stays hidden, so the first
+ * fly-through does not hitch on on-demand compilation.
+ *
+ * Pipeline states are also recorded into the persistent shader pipeline cache, which the
+ * engine precompiles at startup so later imports of similar content start warm.
+ */
+class DATASMITHTEST_API FDSPSOPrecacher
+{
+public:
+    /**
+     * Requests pipeline states for every material used by the given primitives
+     * @param Primitives Imported components to precache
+     * @return Number of unique material combinations requested
+     */
+    int32 Start(const TArray<UPrimitiveComponent*>& Primitives);
+
+    /**
+     * Drops outstanding bookkeeping; already queued compiles still finish in the background
+     */
+    void Reset();
+
+    /**
+     * Gets the fraction of requested compile tasks that have finished, including any
+     * precompiles still pending from the persistent pipeline cache
+     * @return Progress between 0 and 1, 1 when idle
+     */
+    float GetProgress() const;
+
+    /**
+     * Gets the number of compile tasks that are still outstanding
+     */
+    int32 GetNumRemaining() const;
+
+    /**
+     * Checks whether all requested compiles have completed
+     */
+    bool IsComplete() const { return GetNumRemaining() == 0; }
+
+    /**
+     * Opens the persistent pipeline cache for the current shader platform so its entries
+     * are precompiled in the background
+     */
+    static void OpenPersistentCache();
+
+    /**
+     * Speeds up background precompilation while the scene is hidden, or restores
+     * the normal low-priority batching when it is revealed
+     */
+    static void SetFastPrecompile(bool bFast);
+
+    /**
+     * Writes newly recorded pipeline states to the persistent cache
+     */
+    static void SavePersistentCache();
+
+    /**
+     * Switches recording of the pipeline states used by this session (r.ShaderPipelineCache.LogPSO and
+     * SaveUserCache), which costs every draw a cache lookup, so it is only on while precompilation is
+     */
+    static void SetRecording(bool bEnabled);
+
+private:
+    /** Completion events of the compile tasks requested by Start */
+    FGraphEventArray PendingEvents;
+
+    /** Total number of events requested, used as the progress denominator */
+    int32 NumRequested = 0;
+
+    /** Precompiles pending in the pipeline cache when Start was called */
+    int32 NumCachePrecompilesAtStart = 0;
+};
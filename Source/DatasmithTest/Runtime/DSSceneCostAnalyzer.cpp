@@ -0,0 +1,416 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSSceneCostAnalyzer.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/LightComponent.h"
+#include "Components/LocalLightComponent.h"
+#include "Components/SpotLightComponent.h"
+#include "Components/RectLightComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/Texture.h"
+#include "Materials/MaterialInterface.h"
+#include "StaticMeshResources.h"
+#include "RHI.h"
+#include "Algo/StableSort.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+
+// Logging category for the scene cost analyzer
+DEFINE_LOG_CATEGORY_STATIC(LogDSSceneCostAnalyzer, Log, All);
+
+namespace DSSceneCostAnalyzer
+{
+    // Rough pixel shader cost of the material features, in instructions
+    static constexpr int32 BaseInstructions = 60;
+    static constexpr int32 InstructionsPerTexture = 12;
+    static constexpr int32 MaskedInstructions = 10;
+    static constexpr int32 TranslucentInstructions = 80;
+    static constexpr int32 ComplexShadingInstructions = 40;
+
+    // Width of the name column of text tables
+    static constexpr int32 NameColumnWidth = 40;
+
+    /**
+     * Gets the triangle and section counts of the first LOD of a static mesh
+     */
+    static void GetMeshCounts(const UStaticMesh* StaticMesh, int64& OutTriangles, int64& OutVertices, int32& OutSections)
+    {
+        OutTriangles = 0;
+        OutVertices = 0;
+        OutSections = 0;
+
+        const FStaticMeshRenderData* RenderData = StaticMesh ? StaticMesh->GetRenderData() : nullptr;
+        if (!RenderData || RenderData->LODResources.Num() == 0)
+        {
+            return;
+        }
+
+        const FStaticMeshLODResources& LOD = RenderData->LODResources[0];
+        OutTriangles = LOD.GetNumTriangles();
+        OutVertices = LOD.GetNumVertices();
+        OutSections = LOD.Sections.Num();
+    }
+
+    /**
+     * Gets the number of instances a component draws
+     */
+    static int32 GetInstanceCount(const UPrimitiveComponent* Primitive)
+    {
+        if (const UInstancedStaticMeshComponent* Instanced = Cast<UInstancedStaticMeshComponent>(Primitive))
+        {
+            return Instanced->GetInstanceCount();
+        }
+        return 1;
+    }
+
+    /**
+     * Computes the ground area a light can reach, in square meters, or a negative value for lights without a range
+     */
+    static double GetInfluenceArea(const ULightComponent& Light)
+    {
+        const ULocalLightComponent* LocalLight = Cast<ULocalLightComponent>(&Light);
+        if (!LocalLight)
+        {
+            return -1.0;
+        }
+
+        const double RadiusMeters = LocalLight->AttenuationRadius / 100.0;
+        double Radius = RadiusMeters;
+
+        // Cones and rect lights only reach the half space in front of them
+        if (const USpotLightComponent* SpotLight = Cast<USpotLightComponent>(&Light))
+        {
+            Radius = RadiusMeters * FMath::Sin(FMath::DegreesToRadians(FMath::Min(SpotLight->OuterConeAngle, 89.0f)));
+        }
+        else if (Light.IsA<URectLightComponent>())
+        {
+            return UE_DOUBLE_PI * Radius * Radius * 0.5;
+        }
+
+        return UE_DOUBLE_PI * Radius * Radius;
+    }
+
+    static void AddEntry(FDSSceneCostTable& Table, const FString& Name, std::initializer_list<double> Values)
+    {
+        FDSSceneCostEntry& Entry = Table.Entries.AddDefaulted_GetRef();
+        Entry.Name = Name;
+        Entry.Values = Values;
+    }
+}
+
+void FDSSceneCostTable::SortBy(int32 Column)
+{
+    if (!Columns.IsValidIndex(Column))
+    {
+        return;
+    }
+
+    // Stable, so entries with equal cost keep the order of the previous sort
+    Algo::StableSort(Entries, [Column](const FDSSceneCostEntry& A, const FDSSceneCostEntry& B)
+    {
+        return A.Values[Column] > B.Values[Column];
+    });
+}
+
+const TCHAR* FDSSceneCostReport::GetCategoryName(EDSSceneCostCategory Category)
+{
+    switch (Category)
+    {
+    case EDSSceneCostCategory::Meshes:     return TEXT("Meshes");
+    case EDSSceneCostCategory::Materials:  return TEXT("Materials");
+    case EDSSceneCostCategory::Textures:   return TEXT("Textures");
+    case EDSSceneCostCategory::Components: return TEXT("Components");
+    case EDSSceneCostCategory::Lights:     return TEXT("Lights");
+    default:                               return TEXT("Unknown");
+    }
+}
+
+FString FDSSceneCostReport::ToTable(EDSSceneCostCategory Category, int32 MaxRows) const
+{
+    const FDSSceneCostTable& Table = Tables[(int32)Category];
+
+    FString Text = FString(TEXT("Name")).RightPad(DSSceneCostAnalyzer::NameColumnWidth);
+    for (const FString& Column : Table.Columns)
+    {
+        Text += Column.LeftPad(14);
+    }
+    Text += TEXT("\n");
+
+    const int32 NumRows = FMath::Min(Table.Entries.Num(), MaxRows);
+    for (int32 Row = 0; Row < NumRows; ++Row)
+    {
+        const FDSSceneCostEntry& Entry = Table.Entries[Row];
+        FString Name = Entry.Name.Left(DSSceneCostAnalyzer::NameColumnWidth - 2);
+        Text += Name.RightPad(DSSceneCostAnalyzer::NameColumnWidth);
+
+        for (const double Value : Entry.Values)
+        {
+            // Infinite influence is shown as such rather than as a huge number
+            const FString Cell = Value < 0.0 ? FString(TEXT("unbounded"))
+                : FMath::IsNearlyEqual(Value, FMath::RoundToDouble(Value)) ? FString::Printf(TEXT("%lld"), (int64)Value)
+                : FString::Printf(TEXT("%.1f"), Value);
+            Text += Cell.LeftPad(14);
+        }
+        Text += TEXT("\n");
+    }
+
+    if (Table.Entries.Num() > NumRows)
+    {
+        Text += FString::Printf(TEXT("... %d more\n"), Table.Entries.Num() - NumRows);
+    }
+
+    return Text;
+}
+
+bool FDSSceneCostReport::SaveToJson(const FString& FilePath) const
+{
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetNumberField(TEXT("TotalTriangles"), (double)TotalTriangles);
+    Root->SetNumberField(TEXT("TotalDrawCalls"), (double)TotalDrawCalls);
+    Root->SetNumberField(TEXT("TotalTextureBytes"), (double)TotalTextureBytes);
+    Root->SetBoolField(TEXT("InstructionCountsEstimated"), true);
+
+    for (int32 CategoryIndex = 0; CategoryIndex < (int32)EDSSceneCostCategory::Count; ++CategoryIndex)
+    {
+        const FDSSceneCostTable& Table = Tables[CategoryIndex];
+
+        TArray<TSharedPtr<FJsonValue>> Entries;
+        for (const FDSSceneCostEntry& Entry : Table.Entries)
+        {
+            TSharedRef<FJsonObject> EntryObject = MakeShared<FJsonObject>();
+            EntryObject->SetStringField(TEXT("Name"), Entry.Name);
+            for (int32 Column = 0; Column < Table.Columns.Num(); ++Column)
+            {
+                EntryObject->SetNumberField(Table.Columns[Column], Entry.Values[Column]);
+            }
+            Entries.Add(MakeShared<FJsonValueObject>(EntryObject));
+        }
+
+        Root->SetArrayField(GetCategoryName((EDSSceneCostCategory)CategoryIndex), Entries);
+    }
+
+    FString Json;
+    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+    if (!FJsonSerializer::Serialize(Root, Writer))
+    {
+        return false;
+    }
+
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+    if (!FFileHelper::SaveStringToFile(Json, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+    {
+        UE_LOG(LogDSSceneCostAnalyzer, Warning, TEXT("Could not write scene cost report to %s"), *FilePath);
+        return false;
+    }
+
+    UE_LOG(LogDSSceneCostAnalyzer, Log, TEXT("Scene cost report written to %s"), *FilePath);
+    return true;
+}
+
+void FDSSceneCostReport::Log(int32 MaxRows) const
+{
+    UE_LOG(LogDSSceneCostAnalyzer, Log, TEXT("Scene cost: %lld triangles, %lld draw calls, %.1f MB of textures"),
+        TotalTriangles, TotalDrawCalls, TotalTextureBytes / (1024.0 * 1024.0));
+
+    for (int32 CategoryIndex = 0; CategoryIndex < (int32)EDSSceneCostCategory::Count; ++CategoryIndex)
+    {
+        const EDSSceneCostCategory Category = (EDSSceneCostCategory)CategoryIndex;
+        UE_LOG(LogDSSceneCostAnalyzer, Log, TEXT("Heaviest %s:\n%s"), GetCategoryName(Category), *ToTable(Category, MaxRows));
+    }
+}
+
+FDSSceneCostReport FDSSceneCostAnalyzer::Analyze(const TArray<UPrimitiveComponent*>& Primitives, const TArray<ULightComponent*>& Lights)
+{
+    check(IsInGameThread());
+
+    FDSSceneCostReport Report;
+
+    struct FMeshUsage
+    {
+        int64 Instances = 0;
+    };
+
+    struct FMaterialUsage
+    {
+        int64 Sections = 0;
+        TSet<const UPrimitiveComponent*> Components;
+    };
+
+    struct FTextureUsage
+    {
+        TSet<const UMaterialInterface*> Materials;
+    };
+
+    TMap<const UStaticMesh*, FMeshUsage> Meshes;
+    TMap<const UMaterialInterface*, FMaterialUsage> Materials;
+    TMap<const UTexture*, FTextureUsage> Textures;
+
+    FDSSceneCostTable& ComponentTable = Report.Tables[(int32)EDSSceneCostCategory::Components];
+    ComponentTable.Columns = { TEXT("DrawCalls"), TEXT("Sections"), TEXT("Instances"), TEXT("Triangles"), TEXT("CastsShadow") };
+
+    for (const UPrimitiveComponent* Primitive : Primitives)
+    {
+        if (!IsValid(Primitive))
+        {
+            continue;
+        }
+
+        const UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Primitive);
+        const UStaticMesh* StaticMesh = MeshComponent ? MeshComponent->GetStaticMesh() : nullptr;
+        const int32 Instances = DSSceneCostAnalyzer::GetInstanceCount(Primitive);
+
+        int64 Triangles = 0;
+        int64 Vertices = 0;
+        int32 Sections = FMath::Max(Primitive->GetNumMaterials(), 1);
+        if (StaticMesh)
+        {
+            DSSceneCostAnalyzer::GetMeshCounts(StaticMesh, Triangles, Vertices, Sections);
+            Meshes.FindOrAdd(StaticMesh).Instances += Instances;
+        }
+
+        // One draw per section for the main pass, and again for shadow depths; instances share their draws
+        const bool bCastsShadow = Primitive->CastShadow && Primitive->IsVisible();
+        const int64 DrawCalls = (int64)Sections * (bCastsShadow ? 2 : 1);
+        Report.TotalDrawCalls += DrawCalls;
+        Report.TotalTriangles += Triangles * Instances;
+
+        DSSceneCostAnalyzer::AddEntry(ComponentTable, Primitive->GetName(),
+            { (double)DrawCalls, (double)Sections, (double)Instances, (double)(Triangles * Instances), bCastsShadow ? 1.0 : 0.0 });
+
+        for (int32 MaterialIndex = 0; MaterialIndex < Primitive->GetNumMaterials(); ++MaterialIndex)
+        {
+            if (const UMaterialInterface* Material = Primitive->GetMaterial(MaterialIndex))
+            {
+                FMaterialUsage& Usage = Materials.FindOrAdd(Material);
+                ++Usage.Sections;
+                Usage.Components.Add(Primitive);
+            }
+        }
+    }
+
+    FDSSceneCostTable& MeshTable = Report.Tables[(int32)EDSSceneCostCategory::Meshes];
+    MeshTable.Columns = { TEXT("TotalTriangles"), TEXT("Triangles"), TEXT("Instances"), TEXT("Vertices"), TEXT("Sections") };
+    for (const TPair<const UStaticMesh*, FMeshUsage>& Pair : Meshes)
+    {
+        int64 Triangles = 0;
+        int64 Vertices = 0;
+        int32 Sections = 0;
+        DSSceneCostAnalyzer::GetMeshCounts(Pair.Key, Triangles, Vertices, Sections);
+
+        DSSceneCostAnalyzer::AddEntry(MeshTable, Pair.Key->GetName(),
+            { (double)(Triangles * Pair.Value.Instances), (double)Triangles, (double)Pair.Value.Instances, (double)Vertices, (double)Sections });
+    }
+
+    FDSSceneCostTable& MaterialTable = Report.Tables[(int32)EDSSceneCostCategory::Materials];
+    MaterialTable.Columns = { TEXT("Cost"), TEXT("Instructions"), TEXT("Sections"), TEXT("Components"), TEXT("Textures") };
+    for (const TPair<const UMaterialInterface*, FMaterialUsage>& Pair : Materials)
+    {
+        TArray<UTexture*> UsedTextures;
+        Pair.Key->GetUsedTextures(UsedTextures, EMaterialQualityLevel::Num, true, GMaxRHIFeatureLevel, true);
+        UsedTextures.RemoveAll([](const UTexture* Texture) { return Texture == nullptr; });
+
+        for (const UTexture* Texture : UsedTextures)
+        {
+            Textures.FindOrAdd(Texture).Materials.Add(Pair.Key);
+        }
+
+        const int32 Instructions = EstimateInstructionCount(*Pair.Key);
+        DSSceneCostAnalyzer::AddEntry(MaterialTable, Pair.Key->GetName(),
+            { (double)Instructions * Pair.Value.Sections, (double)Instructions, (double)Pair.Value.Sections, (double)Pair.Value.Components.Num(), (double)UsedTextures.Num() });
+    }
+
+    FDSSceneCostTable& TextureTable = Report.Tables[(int32)EDSSceneCostCategory::Textures];
+    TextureTable.Columns = { TEXT("ResidentKB"), TEXT("FullKB"), TEXT("Width"), TEXT("Height"), TEXT("Materials") };
+    for (const TPair<const UTexture*, FTextureUsage>& Pair : Textures)
+    {
+        const int64 ResidentBytes = Pair.Key->CalcTextureMemorySizeEnum(TMC_ResidentMips);
+        const int64 FullBytes = Pair.Key->CalcTextureMemorySizeEnum(TMC_AllMips);
+        Report.TotalTextureBytes += ResidentBytes;
+
+        DSSceneCostAnalyzer::AddEntry(TextureTable, Pair.Key->GetName(),
+            { ResidentBytes / 1024.0, FullBytes / 1024.0, (double)Pair.Key->GetSurfaceWidth(), (double)Pair.Key->GetSurfaceHeight(), (double)Pair.Value.Materials.Num() });
+    }
+
+    FDSSceneCostTable& LightTable = Report.Tables[(int32)EDSSceneCostCategory::Lights];
+    LightTable.Columns = { TEXT("AreaM2"), TEXT("RadiusM"), TEXT("Components"), TEXT("CastsShadows") };
+    for (const ULightComponent* Light : Lights)
+    {
+        if (!IsValid(Light) || !Light->IsVisible())
+        {
+            continue;
+        }
+
+        const double Area = DSSceneCostAnalyzer::GetInfluenceArea(*Light);
+        const ULocalLightComponent* LocalLight = Cast<ULocalLightComponent>(Light);
+
+        // Lights without a range light every component, each one adds to their shading and shadow cost
+        int32 NumAffected = 0;
+        const FSphere Influence(Light->GetComponentLocation(), LocalLight ? LocalLight->AttenuationRadius : 0.0);
+        for (const UPrimitiveComponent* Primitive : Primitives)
+        {
+            if (IsValid(Primitive) && (!LocalLight || Primitive->Bounds.GetSphere().Intersects(Influence)))
+            {
+                ++NumAffected;
+            }
+        }
+
+        DSSceneCostAnalyzer::AddEntry(LightTable, FString::Printf(TEXT("%s.%s"), *GetNameSafe(Light->GetOwner()), *Light->GetName()),
+            { Area, LocalLight ? LocalLight->AttenuationRadius / 100.0 : -1.0, (double)NumAffected, Light->CastShadows ? 1.0 : 0.0 });
+    }
+
+    for (FDSSceneCostTable& Table : Report.Tables)
+    {
+        Table.SortBy(0);
+    }
+
+    // Negative areas stand for unbounded lights, moved to the top after the numeric sort
+    Algo::StableSort(LightTable.Entries, [](const FDSSceneCostEntry& A, const FDSSceneCostEntry& B)
+    {
+        return A.Values[0] < 0.0 && B.Values[0] >= 0.0;
+    });
+
+    return Report;
+}
+
+int32 FDSSceneCostAnalyzer::EstimateInstructionCount(const UMaterialInterface& Material)
+{
+    int32 Instructions = DSSceneCostAnalyzer::BaseInstructions;
+
+    const EBlendMode BlendMode = Material.GetBlendMode();
+    if (BlendMode == BLEND_Masked)
+    {
+        Instructions += DSSceneCostAnalyzer::MaskedInstructions;
+    }
+    else if (BlendMode != BLEND_Opaque)
+    {
+        Instructions += DSSceneCostAnalyzer::TranslucentInstructions;
+    }
+
+    // Clear coat, subsurface, cloth and hair all evaluate a second lobe or a profile
+    const FMaterialShadingModelField ShadingModels = Material.GetShadingModels();
+    if (ShadingModels.CountShadingModels() > 1
+        || !(ShadingModels.HasOnlyShadingModel(MSM_DefaultLit) || ShadingModels.HasOnlyShadingModel(MSM_Unlit)))
+    {
+        Instructions += DSSceneCostAnalyzer::ComplexShadingInstructions;
+    }
+
+    TArray<UTexture*> UsedTextures;
+    Material.GetUsedTextures(UsedTextures, EMaterialQualityLevel::Num, true, GMaxRHIFeatureLevel, true);
+    Instructions += DSSceneCostAnalyzer::InstructionsPerTexture * UsedTextures.Num();
+
+    return Instructions;
+}
@@ -0,0 +1,121 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class UPrimitiveComponent;
+class ULightComponent;
+class UMaterialInterface;
+
+/**
+ * Groups of contributors ranked by the scene cost analyzer
+ */
+enum class EDSSceneCostCategory : uint8
+{
+    Meshes,     // Static meshes, by triangles times instances
+    Materials,  // Materials, by estimated shader instructions times mesh sections using them
+    Textures,   // Textures, by resident memory
+    Components, // Components, by draw calls
+    Lights,     // Lights, by influence area
+    Count
+};
+
+/**
+ * One ranked contributor
+ */
+struct FDSSceneCostEntry
+{
+    FString Name;
+
+    /** Metrics in column order; the first one is the cost the category is ranked by */
+    TArray<double> Values;
+};
+
+/**
+ * Ranked contributors of one category
+ */
+struct FDSSceneCostTable
+{
+    /** Column names, matching the entries' values */
+    TArray<FString> Columns;
+    TArray<FDSSceneCostEntry> Entries;
+
+    /**
+     * Sorts the entries by a column, most expensive first
+     */
+    void SortBy(int32 Column);
+};
+
+/**
+ * Result of a scene cost analysis
+ */
+struct FDSSceneCostReport
+{
+    FDSSceneCostTable Tables[(int32)EDSSceneCostCategory::Count];
+
+    int64 TotalTriangles = 0;
+    int64 TotalDrawCalls = 0;
+    int64 TotalTextureBytes = 0;
+
+    /**
+     * Gets the display name of a category
+     */
+    static const TCHAR* GetCategoryName(EDSSceneCostCategory Category);
+
+    /**
+     * Formats the top entries of a category as a fixed width text table
+     * @param Category Category to format
+     * @param MaxRows Maximum number of entries
+     */
+    FString ToTable(EDSSceneCostCategory Category, int32 MaxRows) const;
+
+    /**
+     * Writes the whole report as JSON, every entry with all its metrics so it can be sorted by any of them
+     * @return True if the file was written
+     */
+    bool SaveToJson(const FString& FilePath) const;
+
+    /**
+     * Writes the totals and the top entries of every category to the log
+     */
+    void Log(int32 MaxRows) const;
+};
+
+/**
+ * FDSSceneCostAnalyzer - Ranks the heaviest contributors of an imported scene
+ *
+ * Gives CAD authors concrete feedback on why a model is slow: which meshes carry the most
+ * triangles once instancing is accounted for, which materials are both expensive and widely
+ * used, which textures take the most memory, which components issue the most draw calls and
+ * which lights touch the largest part of the scene.
+ *
+ * Shader instruction counts are only recorded by editor builds, so material cost is an
+ * estimate from the material's blend mode, shading model and texture samples.
+ */
+class DATASMITHTEST_API FDSSceneCostAnalyzer
+{
+public:
+    /**
+     * Analyzes the given components and lights, must run on the game thread
+     * @param Primitives Imported components
+     * @param Lights Lights affecting the imported scene
+     * @return Report with every category sorted by cost
+     */
+    static FDSSceneCostReport Analyze(const TArray<UPrimitiveComponent*>& Primitives, const TArray<ULightComponent*>& Lights);
+
+    /**
+     * Estimates the pixel shader instructions of a material
+     */
+    static int32 EstimateInstructionCount(const UMaterialInterface& Material);
+};
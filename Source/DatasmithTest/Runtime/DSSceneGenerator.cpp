@@ -0,0 +1,418 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSSceneGenerator.h"
+#include "DatasmithSceneFactory.h"
+#include "DatasmithSceneXmlWriter.h"
+#include "DatasmithMeshSerialization.h"
+#include "IDatasmithSceneElements.h"
+#include "DatasmithMaterialElements.h"
+#include "MeshDescription.h"
+#include "StaticMeshAttributes.h"
+#include "HAL/FileManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+// Logging category for the scene generator
+DEFINE_LOG_CATEGORY_STATIC(LogDSSceneGenerator, Log, All);
+
+namespace DSSceneGenerator
+{
+    static const TCHAR* LightTypes[] = { TEXT("Point"), TEXT("Spot"), TEXT("Directional") };
+
+    /** Distance between neighbouring actors on the placement grid (cm) */
+    static constexpr float GridSpacing = 300.0f;
+
+    /**
+     * Builds a box centered on the origin with one polygon group, using material slot 0
+     */
+    static void BuildBox(const FVector3f& HalfExtent, FMeshDescription& OutMesh)
+    {
+        FStaticMeshAttributes Attributes(OutMesh);
+        Attributes.Register();
+
+        TVertexAttributesRef<FVector3f> Positions = Attributes.GetVertexPositions();
+        TVertexInstanceAttributesRef<FVector3f> Normals = Attributes.GetVertexInstanceNormals();
+        TVertexInstanceAttributesRef<FVector2f> UVs = Attributes.GetVertexInstanceUVs();
+        TPolygonGroupAttributesRef<FName> SlotNames = Attributes.GetPolygonGroupMaterialSlotNames();
+
+        const FPolygonGroupID PolygonGroup = OutMesh.CreatePolygonGroup();
+        SlotNames[PolygonGroup] = TEXT("0");
+
+        FVertexID Corners[8];
+        for (int32 Corner = 0; Corner < 8; ++Corner)
+        {
+            Corners[Corner] = OutMesh.CreateVertex();
+            Positions[Corners[Corner]] = FVector3f(
+                (Corner & 1) ? HalfExtent.X : -HalfExtent.X,
+                (Corner & 2) ? HalfExtent.Y : -HalfExtent.Y,
+                (Corner & 4) ? HalfExtent.Z : -HalfExtent.Z);
+        }
+
+        // Corner indices of each face, counter-clockwise seen from outside
+        static const int32 Faces[6][4] = { { 0, 2, 3, 1 }, { 4, 5, 7, 6 }, { 0, 1, 5, 4 }, { 2, 6, 7, 3 }, { 0, 4, 6, 2 }, { 1, 3, 7, 5 } };
+        static const FVector3f FaceNormals[6] = { { 0, 0, -1 }, { 0, 0, 1 }, { 0, -1, 0 }, { 0, 1, 0 }, { -1, 0, 0 }, { 1, 0, 0 } };
+        static const FVector2f FaceUVs[4] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } };
+
+        for (int32 Face = 0; Face < 6; ++Face)
+        {
+            TArray<FVertexInstanceID, TInlineAllocator<4>> Instances;
+            for (int32 Corner = 0; Corner < 4; ++Corner)
+            {
+                const FVertexInstanceID Instance = OutMesh.CreateVertexInstance(Corners[Faces[Face][Corner]]);
+                Normals[Instance] = FaceNormals[Face];
+                UVs.Set(Instance, 0, FaceUVs[Corner]);
+                Instances.Add(Instance);
+            }
+            OutMesh.CreatePolygon(PolygonGroup, Instances);
+        }
+    }
+
+    /**
+     * Writes a box mesh file and returns its hash
+     */
+    static bool WriteMeshFile(const FString& FilePath, const FString& MeshName, const FVector3f& HalfExtent, FMD5Hash& OutHash)
+    {
+        FDatasmithMeshModels Models;
+        Models.MeshName = MeshName;
+        BuildBox(HalfExtent, Models.SourceModels.AddDefaulted_GetRef());
+
+        FDatasmithPackedMeshes Pack;
+        Pack.Meshes.Add(MoveTemp(Models));
+
+        TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*FilePath));
+        if (!Archive)
+        {
+            return false;
+        }
+
+        OutHash = Pack.Serialize(*Archive);
+        return Archive->Close();
+    }
+
+    /**
+     * Gets the group actor a mesh actor is attached to, creating the groups above it on first use
+     * @return Parent group, nullptr when the hierarchy has no levels
+     */
+    static IDatasmithActorElement* GetParentGroup(int32 ElementIndex, int32 HierarchyDepth, int32 BranchingFactor,
+        const TSharedRef<IDatasmithScene>& Scene, TMap<TPair<int32, int64>, TSharedPtr<IDatasmithActorElement>>& Groups)
+    {
+        IDatasmithActorElement* Parent = nullptr;
+
+        // Index of the element's group at each level, from the root down
+        int64 GroupSpan = 1;
+        for (int32 Level = 0; Level < HierarchyDepth; ++Level)
+        {
+            GroupSpan *= BranchingFactor;
+        }
+
+        for (int32 Level = 0; Level < HierarchyDepth; ++Level)
+        {
+            const int64 GroupIndex = ElementIndex / GroupSpan;
+            GroupSpan /= BranchingFactor;
+
+            TSharedPtr<IDatasmithActorElement>& Group = Groups.FindOrAdd({ Level, GroupIndex });
+            if (!Group.IsValid())
+            {
+                Group = FDatasmithSceneFactory::CreateActor(*FString::Printf(TEXT("Group_%d_%lld"), Level, GroupIndex));
+                Group->SetLabel(*FString::Printf(TEXT("Level %d Group %lld"), Level, GroupIndex));
+                if (Parent)
+                {
+                    Parent->AddChild(Group.ToSharedRef());
+                }
+                else
+                {
+                    Scene->AddActor(Group.ToSharedRef());
+                }
+            }
+            Parent = Group.Get();
+        }
+
+        return Parent;
+    }
+}
+
+void FDSSceneGeneratorReport::Log() const
+{
+    UE_LOG(LogDSSceneGenerator, Log, TEXT("=== Synthetic Scene ==="));
+    UE_LOG(LogDSSceneGenerator, Log, TEXT("Meshes: %d, Mesh actors: %d, Group actors: %d, Materials: %d, Metadata properties: %d, Lights: %d"),
+           NumMeshes, NumMeshActors, NumGroupActors, NumMaterials, NumMetadataProperties, NumLights);
+    UE_LOG(LogDSSceneGenerator, Log, TEXT("Scene: %s"), *ScenePath);
+    UE_LOG(LogDSSceneGenerator, Log, TEXT("Light event: %s"), *LightEventPath);
+    UE_LOG(LogDSSceneGenerator, Log, TEXT("Light capture: %s"), *LightCapturePath);
+    UE_LOG(LogDSSceneGenerator, Log, TEXT("Generated in %.2f s"), Seconds);
+}
+
+bool FDSSceneGenerator::Generate(const FDSSceneGeneratorSettings& Settings, const FString& OutputDirectory, FDSSceneGeneratorReport& OutReport)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    OutReport = FDSSceneGeneratorReport();
+
+    const int32 NumElements = FMath::Max(Settings.NumElements, 0);
+    const int32 NumMeshes = NumElements > 0 ? FMath::Clamp(FMath::RoundToInt(NumElements * (1.0f - FMath::Clamp(Settings.InstancingRatio, 0.0f, 1.0f))), 1, NumElements) : 0;
+    const int32 NumMaterials = FMath::Max(Settings.NumMaterials, 1);
+    const int32 HierarchyDepth = FMath::Max(Settings.HierarchyDepth, 0);
+
+    // Smallest branching factor whose levels can hold every element
+    const int32 BranchingFactor = HierarchyDepth > 0 ? FMath::Max(FMath::CeilToInt(FMath::Pow((double)FMath::Max(NumElements, 1), 1.0 / (HierarchyDepth + 1))), 2) : 1;
+
+    const FString AssetsDirectory = FPaths::Combine(OutputDirectory, Settings.SceneName + TEXT("_Assets"));
+    if (!IFileManager::Get().MakeDirectory(*AssetsDirectory, true))
+    {
+        UE_LOG(LogDSSceneGenerator, Error, TEXT("Failed to create %s"), *AssetsDirectory);
+        return false;
+    }
+
+    FRandomStream Random(Settings.Seed);
+
+    TSharedRef<IDatasmithScene> Scene = FDatasmithSceneFactory::CreateScene(*Settings.SceneName);
+    Scene->SetHost(TEXT("DatasmithTest"));
+    Scene->SetProductName(TEXT("DatasmithTest Scene Generator"));
+
+    // Materials, one flat color each
+    TArray<FString> MaterialNames;
+    for (int32 MaterialIndex = 0; MaterialIndex < NumMaterials; ++MaterialIndex)
+    {
+        TSharedRef<IDatasmithUEPbrMaterialElement> Material = FDatasmithSceneFactory::CreateUEPbrMaterial(*FString::Printf(TEXT("Material_%d"), MaterialIndex));
+        IDatasmithMaterialExpressionColor* BaseColor = Material->AddMaterialExpression<IDatasmithMaterialExpressionColor>();
+        BaseColor->GetColor() = FLinearColor::MakeRandomSeededColor(Settings.Seed + MaterialIndex);
+        BaseColor->ConnectExpression(Material->GetBaseColor());
+
+        MaterialNames.Add(Material->GetName());
+        Scene->AddMaterial(Material);
+    }
+
+    // Unique meshes, boxes of different proportions so none of them are identical
+    TArray<TSharedPtr<IDatasmithMeshElement>> Meshes;
+    Meshes.Reserve(NumMeshes);
+    for (int32 MeshIndex = 0; MeshIndex < NumMeshes; ++MeshIndex)
+    {
+        const FString MeshName = FString::Printf(TEXT("Mesh_%d"), MeshIndex);
+        const FString MeshPath = FPaths::ConvertRelativePathToFull(FPaths::Combine(AssetsDirectory, MeshName + TEXT(".udsmesh")));
+        const FVector3f HalfExtent(Random.FRandRange(10.0f, 100.0f), Random.FRandRange(10.0f, 100.0f), Random.FRandRange(10.0f, 100.0f));
+
+        FMD5Hash MeshHash;
+        if (!DSSceneGenerator::WriteMeshFile(MeshPath, MeshName, HalfExtent, MeshHash))
+        {
+            UE_LOG(LogDSSceneGenerator, Error, TEXT("Failed to write %s"), *MeshPath);
+            return false;
+        }
+
+        TSharedRef<IDatasmithMeshElement> Mesh = FDatasmithSceneFactory::CreateMesh(*MeshName);
+        Mesh->SetFile(*MeshPath);
+        Mesh->SetFileHash(MeshHash);
+        Mesh->SetDimensions((HalfExtent.X * HalfExtent.Y + HalfExtent.Y * HalfExtent.Z + HalfExtent.Z * HalfExtent.X) * 8.0f, HalfExtent.X * 2.0f, HalfExtent.Y * 2.0f, HalfExtent.Z * 2.0f);
+        Mesh->SetMaterial(*MaterialNames[MeshIndex % NumMaterials], 0);
+
+        Meshes.Add(Mesh);
+        Scene->AddMesh(Mesh);
+    }
+
+    // Mesh actors on a square grid, the first actors use each mesh once and the rest instance them
+    const int32 GridSize = FMath::Max(FMath::CeilToInt(FMath::Sqrt((float)NumElements)), 1);
+    TMap<TPair<int32, int64>, TSharedPtr<IDatasmithActorElement>> Groups;
+
+    for (int32 ElementIndex = 0; ElementIndex < NumElements; ++ElementIndex)
+    {
+        const int32 MeshIndex = ElementIndex < NumMeshes ? ElementIndex : Random.RandRange(0, NumMeshes - 1);
+
+        TSharedRef<IDatasmithMeshActorElement> Actor = FDatasmithSceneFactory::CreateMeshActor(*FString::Printf(TEXT("Element_%d"), ElementIndex));
+        Actor->SetLabel(*FString::Printf(TEXT("Element %d"), ElementIndex));
+        Actor->SetStaticMeshPathName(Meshes[MeshIndex]->GetName());
+        Actor->SetLayer(*FString::Printf(TEXT("Layer_%d"), ElementIndex % 8));
+        Actor->SetTranslation(FVector((ElementIndex % GridSize) * DSSceneGenerator::GridSpacing, (ElementIndex / GridSize) * DSSceneGenerator::GridSpacing, 0.0));
+        Actor->SetRotation(FRotator(0.0, Random.FRandRange(0.0f, 360.0f), 0.0).Quaternion());
+
+        if (Settings.MetadataPerElement > 0)
+        {
+            TSharedRef<IDatasmithMetaDataElement> MetaData = FDatasmithSceneFactory::CreateMetaData(*FString::Printf(TEXT("MetaData_%d"), ElementIndex));
+            MetaData->SetAssociatedElement(Actor);
+
+            for (int32 PropertyIndex = 0; PropertyIndex < Settings.MetadataPerElement; ++PropertyIndex)
+            {
+                // The first properties are the ones metadata filters usually match on
+                const FString Key = PropertyIndex == 0 ? TEXT("Category") : PropertyIndex == 1 ? TEXT("Level") : FString::Printf(TEXT("Param_%d"), PropertyIndex);
+                const FString Value = PropertyIndex == 0 ? FString::Printf(TEXT("Category_%d"), ElementIndex % 16)
+                    : PropertyIndex == 1 ? FString::Printf(TEXT("Level_%d"), ElementIndex % 4)
+                    : FString::Printf(TEXT("Value_%d"), Random.RandHelper(1000000));
+
+                TSharedRef<IDatasmithKeyValueProperty> Property = FDatasmithSceneFactory::CreateKeyValueProperty(*Key);
+                Property->SetPropertyType(EDatasmithKeyValuePropertyType::String);
+                Property->SetValue(*Value);
+                MetaData->AddProperty(Property);
+            }
+
+            Scene->AddMetaData(MetaData);
+            OutReport.NumMetadataProperties += Settings.MetadataPerElement;
+        }
+
+        if (IDatasmithActorElement* Parent = DSSceneGenerator::GetParentGroup(ElementIndex, HierarchyDepth, BranchingFactor, Scene, Groups))
+        {
+            Parent->AddChild(Actor);
+        }
+        else
+        {
+            Scene->AddActor(Actor);
+        }
+    }
+
+    // Lights, the same ones the light payloads describe
+    const TArray<FDSSyntheticLight> Lights = GenerateLights(Settings.NumLights, Settings.Seed);
+    for (int32 LightIndex = 0; LightIndex < Lights.Num(); ++LightIndex)
+    {
+        const FDSSyntheticLight& Light = Lights[LightIndex];
+        const FString LightName = FString::Printf(TEXT("Light_%d"), LightIndex);
+
+        TSharedPtr<IDatasmithLightActorElement> LightActor;
+        if (Light.Type == TEXT("Spot"))
+        {
+            TSharedRef<IDatasmithSpotLightElement> SpotLight = FDatasmithSceneFactory::CreateSpotLight(*LightName);
+            SpotLight->SetInnerConeAngle(Light.InnerAngle);
+            SpotLight->SetOuterConeAngle(Light.OuterAngle);
+            LightActor = SpotLight;
+        }
+        else if (Light.Type == TEXT("Directional"))
+        {
+            LightActor = FDatasmithSceneFactory::CreateDirectionalLight(*LightName);
+        }
+        else
+        {
+            LightActor = FDatasmithSceneFactory::CreatePointLight(*LightName);
+        }
+
+        // Same conversion the light parser applies
+        LightActor->SetTranslation(FVector(Light.Location.X * 100.0, -Light.Location.Y * 100.0, Light.Location.Z * 100.0));
+        LightActor->SetRotation(FRotator(Light.Rotation.Pitch, -Light.Rotation.Yaw, Light.Rotation.Roll).Quaternion());
+        LightActor->SetIntensity(Light.Intensity);
+        LightActor->SetColor(FLinearColor(Light.Color.R / 255.0f, Light.Color.G / 255.0f, Light.Color.B / 255.0f));
+        Scene->AddActor(LightActor.ToSharedRef());
+    }
+
+    OutReport.ScenePath = FPaths::ConvertRelativePathToFull(FPaths::Combine(OutputDirectory, Settings.SceneName + TEXT(".udatasmith")));
+    {
+        TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*OutReport.ScenePath));
+        if (!Archive)
+        {
+            UE_LOG(LogDSSceneGenerator, Error, TEXT("Failed to write %s"), *OutReport.ScenePath);
+            return false;
+        }
+
+        FDatasmithSceneXmlWriter().Serialize(Scene, *Archive);
+    }
+
+    // Light payloads: the full event as sent on connect, and a capture of small moves to replay
+    OutReport.LightEventPath = FPaths::ConvertRelativePathToFull(FPaths::Combine(OutputDirectory, Settings.SceneName + TEXT("_Lights.json")));
+    OutReport.LightCapturePath = FPaths::ConvertRelativePathToFull(FPaths::Combine(OutputDirectory, Settings.SceneName + TEXT("_Lights.capture")));
+
+    FString Capture;
+    TArray<FDSSyntheticLight> MovedLights = Lights;
+    for (int32 EventIndex = 0; EventIndex < Settings.NumLightEvents; ++EventIndex)
+    {
+        for (FDSSyntheticLight& Light : MovedLights)
+        {
+            Light.Location += FVector(Random.FRandRange(-0.1f, 0.1f), Random.FRandRange(-0.1f, 0.1f), 0.0f);
+            Light.Intensity = FMath::Max(Light.Intensity + Random.FRandRange(-0.5f, 0.5f), 0.1f);
+        }
+        Capture += FString::Printf(TEXT("%.3f\t%s\n"), EventIndex * Settings.LightEventInterval, *MakeLightEvent(MovedLights));
+    }
+
+    if (!FFileHelper::SaveStringToFile(MakeLightEvent(Lights, TEXT("sync")), *OutReport.LightEventPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+        || !FFileHelper::SaveStringToFile(Capture, *OutReport.LightCapturePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+    {
+        UE_LOG(LogDSSceneGenerator, Error, TEXT("Failed to write the light payloads to %s"), *OutputDirectory);
+        return false;
+    }
+
+    OutReport.NumMeshes = NumMeshes;
+    OutReport.NumMeshActors = NumElements;
+    OutReport.NumGroupActors = Groups.Num();
+    OutReport.NumMaterials = NumMaterials;
+    OutReport.NumLights = Lights.Num();
+    OutReport.Seconds = FPlatformTime::Seconds() - StartTime;
+    return true;
+}
+
+TArray<FDSSyntheticLight> FDSSceneGenerator::GenerateLights(int32 NumLights, int32 Seed)
+{
+    FRandomStream Random(Seed);
+
+    TArray<FDSSyntheticLight> Lights;
+    Lights.Reserve(NumLights);
+    for (int32 LightIndex = 0; LightIndex < NumLights; ++LightIndex)
+    {
+        FDSSyntheticLight& Light = Lights.AddDefaulted_GetRef();
+        Light.Type = DSSceneGenerator::LightTypes[LightIndex % UE_ARRAY_COUNT(DSSceneGenerator::LightTypes)];
+        Light.Location = FVector(Random.FRandRange(-50.0f, 50.0f), Random.FRandRange(-50.0f, 50.0f), Random.FRandRange(0.0f, 10.0f));
+        Light.Rotation = FRotator(Random.FRandRange(-90.0f, 0.0f), Random.FRandRange(-180.0f, 180.0f), 0.0f);
+        Light.Intensity = Random.FRandRange(0.5f, 20.0f);
+        Light.Color = FColor(Random.RandRange(0, 255), Random.RandRange(0, 255), Random.RandRange(0, 255));
+
+        if (Light.Type == TEXT("Spot"))
+        {
+            Light.InnerAngle = Random.FRandRange(5.0f, 20.0f);
+            Light.OuterAngle = Random.FRandRange(25.0f, 60.0f);
+        }
+    }
+
+    return Lights;
+}
+
+FString FDSSceneGenerator::MakeLightEvent(const TArray<FDSSyntheticLight>& Lights, const TCHAR* EventType)
+{
+    FString Json = FString::Printf(TEXT("{\"event\":\"%s\",\"timestamp\":\"%s\",\"lightCount\":%d,\"lights\":["),
+        EventType, *FDateTime::UtcNow().ToIso8601(), Lights.Num());
+
+    for (int32 LightIndex = 0; LightIndex < Lights.Num(); ++LightIndex)
+    {
+        const FDSSyntheticLight& Light = Lights[LightIndex];
+
+        Json += FString::Printf(
+            TEXT("%s{\"type\":\"%s\",\"location\":{\"x\":%.4f,\"y\":%.4f,\"z\":%.4f},\"rotation\":{\"pitch\":%.3f,\"yaw\":%.3f,\"roll\":%.3f},")
+            TEXT("\"intensity\":%.3f,\"color\":{\"r\":%d,\"g\":%d,\"b\":%d}"),
+            LightIndex > 0 ? TEXT(",") : TEXT(""), *Light.Type,
+            Light.Location.X, Light.Location.Y, Light.Location.Z,
+            Light.Rotation.Pitch, Light.Rotation.Yaw, Light.Rotation.Roll,
+            Light.Intensity, Light.Color.R, Light.Color.G, Light.Color.B);
+
+        if (Light.Type == TEXT("Spot"))
+        {
+            Json += FString::Printf(TEXT(",\"spotLight\":{\"innerAngle\":%.2f,\"outerAngle\":%.2f}"), Light.InnerAngle, Light.OuterAngle);
+        }
+
+        Json += TEXT("}");
+    }
+    Json += TEXT("]}");
+
+    return Json;
+}
+
+TArray<FString> FDSSceneGenerator::MakeLegacyLightLines(const TArray<FDSSyntheticLight>& Lights)
+{
+    TArray<FString> Lines;
+    Lines.Reserve(Lights.Num());
+    for (const FDSSyntheticLight& Light : Lights)
+    {
+        FString Line = FString::Printf(TEXT("%s (%.4f,%.4f,%.4f) (%.3f°,%.3f°,%.3f°) %.3f RGB(%d,%d,%d)"), *Light.Type,
+            Light.Location.X, Light.Location.Y, Light.Location.Z,
+            Light.Rotation.Pitch, Light.Rotation.Yaw, Light.Rotation.Roll,
+            Light.Intensity, Light.Color.R, Light.Color.G, Light.Color.B);
+
+        if (Light.Type == TEXT("Spot"))
+        {
+            Line += FString::Printf(TEXT(" %.2f° %.2f°"), Light.InnerAngle, Light.OuterAngle);
+        }
+
+        Lines.Add(MoveTemp(Line));
+    }
+
+    return Lines;
+}
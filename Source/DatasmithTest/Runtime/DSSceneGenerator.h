@@ -0,0 +1,125 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Shape of a synthetic scene
+ */
+struct FDSSceneGeneratorSettings
+{
+    /** Base name of the written files */
+    FString SceneName = TEXT("Synthetic");
+
+    /** Number of mesh actors */
+    int32 NumElements = 1000;
+
+    /** Fraction of mesh actors that reuse a mesh of another actor, 0 for a unique mesh per actor */
+    float InstancingRatio = 0.9f;
+
+    /** Levels of group actors above the mesh actors, 0 to put them at the root */
+    int32 HierarchyDepth = 3;
+
+    int32 NumMaterials = 16;
+
+    /** Metadata properties per mesh actor, 0 for no metadata */
+    int32 MetadataPerElement = 4;
+
+    int32 NumLights = 16;
+
+    /** Update events in the light capture, each moving every light a little */
+    int32 NumLightEvents = 20;
+
+    /** Seconds between light capture events */
+    float LightEventInterval = 0.5f;
+
+    int32 Seed = 1;
+};
+
+/**
+ * Summary of a generated scene
+ */
+struct FDSSceneGeneratorReport
+{
+    int32 NumMeshes = 0;
+    int32 NumMeshActors = 0;
+    int32 NumGroupActors = 0;
+    int32 NumMaterials = 0;
+    int32 NumMetadataProperties = 0;
+    int32 NumLights = 0;
+
+    FString ScenePath;
+    FString LightEventPath;
+    FString LightCapturePath;
+
+    double Seconds = 0.0;
+
+    /**
+     * Writes the report to the log
+     */
+    void Log() const;
+};
+
+/**
+ * One synthetic light, in Rhino units and axes like the LightSyncPlugin sends them
+ */
+struct FDSSyntheticLight
+{
+    FString Type;
+    FVector Location = FVector::ZeroVector;       // Meters, X right, Y forward
+    FRotator Rotation = FRotator::ZeroRotator;    // Degrees, before the yaw flip
+    float Intensity = 1.0f;
+    FColor Color = FColor::White;
+    float InnerAngle = 0.0f;
+    float OuterAngle = 45.0f;
+};
+
+/**
+ * FDSSceneGenerator - Writes synthetic Datasmith scenes and matching light sync payloads
+ *
+ * Produces inputs of controlled size for scaling the runtime manager and the light syncer:
+ *   <SceneName>.udatasmith         Scene with mesh, group and light actors, materials and metadata
+ *   <SceneName>_Assets/*.udsmesh   One box per unique mesh, sized differently so none are duplicates
+ *   <SceneName>_Lights.json        Light event with the scene's lights, as sent over TCP
+ *   <SceneName>_Lights.capture     Timed update events, replayable with ds.Light.Replay
+ *
+ * Geometry, placement and lights are deterministic for a given seed. Actors are spread evenly over the hierarchy levels
+ * and placed on a grid so bounds and visibility scale with the element count.
+ */
+class DATASMITHTEST_API FDSSceneGenerator
+{
+public:
+    /**
+     * Writes a synthetic scene and its light payloads
+     * @param Settings Shape of the scene
+     * @param OutputDirectory Directory the files are written to, created if missing
+     * @param OutReport Counts and paths of what was written
+     * @return False if a file could not be written
+     */
+    static bool Generate(const FDSSceneGeneratorSettings& Settings, const FString& OutputDirectory, FDSSceneGeneratorReport& OutReport);
+
+    /**
+     * Generates lights of all types with random placement
+     */
+    static TArray<FDSSyntheticLight> GenerateLights(int32 NumLights, int32 Seed);
+
+    /**
+     * Formats lights as a single-line JSON light event
+     */
+    static FString MakeLightEvent(const TArray<FDSSyntheticLight>& Lights, const TCHAR* EventType = TEXT("update"));
+
+    /**
+     * Formats lights in the legacy text format, one light per line
+     */
+    static TArray<FString> MakeLegacyLightLines(const TArray<FDSSyntheticLight>& Lights);
+};
@@ -0,0 +1,57 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSStartupTimeline.h"
+#include "CoreGlobals.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+// Logging category for the startup timeline
+DEFINE_LOG_CATEGORY_STATIC(LogDSStartupTimeline, Log, All);
+
+TArray<FDSStartupTimeline::FStep> FDSStartupTimeline::Steps;
+bool FDSStartupTimeline::bFinished = false;
+
+void FDSStartupTimeline::Mark(const TCHAR* Step)
+{
+    check(IsInGameThread());
+
+    TRACE_BOOKMARK(TEXT("DS Startup: %s"), Step);
+
+    if (bFinished)
+    {
+        return;
+    }
+
+    Steps.Add({ Step, FPlatformTime::Seconds() - GStartTime });
+    UE_LOG(LogDSStartupTimeline, Verbose, TEXT("%s at %.3f s"), Step, Steps.Last().Seconds);
+}
+
+void FDSStartupTimeline::Finish()
+{
+    if (bFinished)
+    {
+        return;
+    }
+
+    Mark(TEXT("Startup complete"));
+    bFinished = true;
+
+    UE_LOG(LogDSStartupTimeline, Log, TEXT("Startup timeline (%.3f s total):"), Steps.Last().Seconds);
+
+    double PreviousSeconds = 0.0;
+    for (const FStep& Step : Steps)
+    {
+        UE_LOG(LogDSStartupTimeline, Log, TEXT("  %8.3f s  +%7.1f ms  %s"), Step.Seconds, (Step.Seconds - PreviousSeconds) * 1000.0, *Step.Name);
+        PreviousSeconds = Step.Seconds;
+    }
+
+    Steps.Empty();
+}
@@ -0,0 +1,52 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FDSStartupTimeline - Records when each step of the app's startup happens
+ *
+ * Every mark is stored with its time since process start and emitted as a trace bookmark, so
+ * the steps also show up on the Unreal Insights timeline next to the CPU scopes around them.
+ * Finish logs the steps with the time each one took once the app is ready; marks after that
+ * only go to the trace. Game thread only.
+ */
+class DATASMITHTEST_API FDSStartupTimeline
+{
+public:
+    /**
+     * Records a startup step
+     * @param Step Name of the step that just finished
+     */
+    static void Mark(const TCHAR* Step);
+
+    /**
+     * Marks the end of startup and logs the timeline
+     */
+    static void Finish();
+
+    /**
+     * Checks whether startup has finished
+     */
+    static bool IsFinished() { return bFinished; }
+
+private:
+    struct FStep
+    {
+        FString Name;
+        double Seconds = 0.0;
+    };
+
+    static TArray<FStep> Steps;
+    static bool bFinished;
+};
@@ -0,0 +1,71 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSStaticMeshRebuild.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+#include "RenderingThread.h"
+
+void FDSStaticMeshRebuild::GatherStaticMeshes(const TArray<UPrimitiveComponent*>& Primitives, TArray<UStaticMesh*>& OutMeshes)
+{
+    OutMeshes.Reset();
+
+    TSet<UStaticMesh*> UniqueMeshes;
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+        const UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Primitive);
+        UStaticMesh* StaticMesh = MeshComponent ? MeshComponent->GetStaticMesh() : nullptr;
+        if (IsValid(StaticMesh) && StaticMesh->GetRenderData() && !UniqueMeshes.Contains(StaticMesh))
+        {
+            UniqueMeshes.Add(StaticMesh);
+            OutMeshes.Add(StaticMesh);
+        }
+    }
+}
+
+bool FDSStaticMeshRebuild::HasCPUData(const FStaticMeshLODResources& LOD)
+{
+    return LOD.VertexBuffers.PositionVertexBuffer.GetVertexData() != nullptr
+        && LOD.VertexBuffers.StaticMeshVertexBuffer.GetTangentData() != nullptr
+        && LOD.IndexBuffer.GetIndexDataSize() > 0;
+}
+
+void FDSStaticMeshRebuild::Modify(const TArray<UStaticMesh*>& Meshes, TFunctionRef<void(UStaticMesh&, FStaticMeshRenderData&)> Modifier)
+{
+    check(IsInGameThread());
+
+    if (Meshes.Num() == 0)
+    {
+        return;
+    }
+
+    // Components using the meshes drop their scene proxies here and recreate them when the contexts go away
+    TIndirectArray<FStaticMeshComponentRecreateRenderStateContext> RecreateContexts;
+    for (UStaticMesh* StaticMesh : Meshes)
+    {
+        RecreateContexts.Add(new FStaticMeshComponentRecreateRenderStateContext(StaticMesh, false, true));
+    }
+
+    for (UStaticMesh* StaticMesh : Meshes)
+    {
+        StaticMesh->ReleaseResources();
+    }
+    FlushRenderingCommands();
+
+    for (UStaticMesh* StaticMesh : Meshes)
+    {
+        Modifier(*StaticMesh, *StaticMesh->GetRenderData());
+        StaticMesh->InitResources();
+    }
+
+    RecreateContexts.Empty();
+}
@@ -0,0 +1,50 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class UPrimitiveComponent;
+class UStaticMesh;
+class FStaticMeshRenderData;
+struct FStaticMeshLODResources;
+
+/**
+ * FDSStaticMeshRebuild - Helpers for rewriting the render data of runtime-built static meshes
+ *
+ * Runtime meshes have no source build, so post-import passes edit their render data directly.
+ * Modify takes care of detaching the components using the meshes, releasing and re-initializing
+ * the GPU resources around the edit with a single render thread flush for the whole batch.
+ */
+class DATASMITHTEST_API FDSStaticMeshRebuild
+{
+public:
+    /**
+     * Collects the unique static meshes used by the given primitives
+     * @param Primitives Imported components
+     * @param OutMeshes Receives the static meshes, each mesh once
+     */
+    static void GatherStaticMeshes(const TArray<UPrimitiveComponent*>& Primitives, TArray<UStaticMesh*>& OutMeshes);
+
+    /**
+     * Checks whether a LOD still has CPU copies of its vertex and index data
+     */
+    static bool HasCPUData(const FStaticMeshLODResources& LOD);
+
+    /**
+     * Rewrites the render data of the given meshes, must run on the game thread
+     * @param Meshes Meshes to modify
+     * @param Modifier Called once per mesh while its GPU resources are released
+     */
+    static void Modify(const TArray<UStaticMesh*>& Meshes, TFunctionRef<void(UStaticMesh&, FStaticMeshRenderData&)> Modifier);
+};
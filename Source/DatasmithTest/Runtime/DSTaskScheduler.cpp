@@ -0,0 +1,245 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSTaskScheduler.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/PlatformMisc.h"
+
+// Logging category for the task scheduler
+DEFINE_LOG_CATEGORY_STATIC(LogDSTaskScheduler, Log, All);
+
+namespace DSTaskScheduler
+{
+    static constexpr uint32 WorkerStackSize = 512 * 1024;
+
+    // Shortest utilization window, shorter ones mostly measure whether a task happened to end inside it
+    static constexpr double UtilizationWindowSeconds = 1.0;
+
+    static bool CompareTaskCost(int64 A, int64 B)
+    {
+        return A > B;
+    }
+}
+
+/**
+ * Pool work item that runs whichever task is best when a worker picks it up, not a fixed one.
+ * One runner is queued per submitted task, so every task is eventually run; runners of
+ * discarded tasks find nothing to do and return.
+ */
+class FDSTaskScheduler::FRunner : public IQueuedWork
+{
+public:
+    explicit FRunner(FDSTaskScheduler& InScheduler)
+        : Scheduler(InScheduler)
+    {
+    }
+
+    virtual void DoThreadedWork() override
+    {
+        FTask Task;
+        if (Scheduler.PopTask(Task))
+        {
+            Scheduler.RunTask(Task);
+        }
+        delete this;
+    }
+
+    virtual void Abandon() override
+    {
+        delete this;
+    }
+
+private:
+    // The scheduler destroys the pool, and with it every runner, before it goes away itself
+    FDSTaskScheduler& Scheduler;
+};
+
+int32 FDSTaskSchedulerStats::GetNumQueued() const
+{
+    int32 Total = 0;
+    for (const int32 LaneQueued : NumQueued)
+    {
+        Total += LaneQueued;
+    }
+    return Total;
+}
+
+FString FDSTaskSchedulerStats::ToString() const
+{
+    return FString::Printf(TEXT("Workers: %d, running: %d, queued: %d visible / %d normal / %d background, completed: %lld, discarded: %lld, utilization: %.0f%%"),
+        NumWorkers, NumRunning,
+        NumQueued[(int32)EDSTaskLane::Visible], NumQueued[(int32)EDSTaskLane::Normal], NumQueued[(int32)EDSTaskLane::Background],
+        NumCompleted, NumDiscarded, Utilization * 100.0f);
+}
+
+FDSTaskScheduler::FDSTaskScheduler(int32 InNumWorkers, int32 InNumReservedCores)
+    : NumWorkers(ComputeWorkerCount(InNumWorkers, InNumReservedCores))
+{
+    // Below normal priority so the game and render threads win whenever they compete for a core
+    Pool = FQueuedThreadPool::Allocate();
+    Pool->Create(NumWorkers, DSTaskScheduler::WorkerStackSize, TPri_BelowNormal, TEXT("DSTaskScheduler"));
+
+    WindowStartTimeCycles = FPlatformTime::Cycles64();
+
+    UE_LOG(LogDSTaskScheduler, Log, TEXT("Task scheduler started with %d workers (%d cores reserved)"), NumWorkers, InNumReservedCores);
+}
+
+FDSTaskScheduler::~FDSTaskScheduler()
+{
+    // Waits for running tasks and abandons the queued runners
+    Pool->Destroy();
+    delete Pool;
+}
+
+int32 FDSTaskScheduler::ComputeWorkerCount(int32 RequestedWorkers, int32 NumReservedCores)
+{
+    if (RequestedWorkers > 0)
+    {
+        return RequestedWorkers;
+    }
+
+    return FMath::Max(FPlatformMisc::NumberOfCoresIncludingHyperthreads() - FMath::Max(NumReservedCores, 0), 1);
+}
+
+uint64 FDSTaskScheduler::AllocateGroup()
+{
+    return NextGroup++;
+}
+
+void FDSTaskScheduler::Submit(EDSTaskLane Lane, int64 Cost, TUniqueFunction<void()>&& Work, uint64 Group)
+{
+    {
+        FScopeLock Lock(&LanesLock);
+        Lanes[(int32)Lane].HeapPush({ Cost, Group, MoveTemp(Work) }, [](const FTask& A, const FTask& B)
+        {
+            return DSTaskScheduler::CompareTaskCost(A.Cost, B.Cost);
+        });
+    }
+
+    Pool->AddQueuedWork(new FRunner(*this));
+}
+
+int32 FDSTaskScheduler::DiscardGroup(uint64 Group)
+{
+    if (Group == 0)
+    {
+        return 0;
+    }
+
+    // Work functions are destroyed outside the lock, they may release the last reference to their owner
+    TArray<FTask> Discarded;
+    {
+        FScopeLock Lock(&LanesLock);
+        for (TArray<FTask>& Lane : Lanes)
+        {
+            for (int32 TaskIndex = Lane.Num() - 1; TaskIndex >= 0; --TaskIndex)
+            {
+                if (Lane[TaskIndex].Group == Group)
+                {
+                    Discarded.Add(MoveTemp(Lane[TaskIndex]));
+                    Lane.RemoveAtSwap(TaskIndex, 1, EAllowShrinking::No);
+                }
+            }
+
+            Lane.Heapify([](const FTask& A, const FTask& B)
+            {
+                return DSTaskScheduler::CompareTaskCost(A.Cost, B.Cost);
+            });
+        }
+    }
+
+    NumDiscarded += Discarded.Num();
+    return Discarded.Num();
+}
+
+bool FDSTaskScheduler::PopTask(FTask& OutTask)
+{
+    FScopeLock Lock(&LanesLock);
+    for (TArray<FTask>& Lane : Lanes)
+    {
+        if (Lane.Num() > 0)
+        {
+            Lane.HeapPop(OutTask, [](const FTask& A, const FTask& B)
+            {
+                return DSTaskScheduler::CompareTaskCost(A.Cost, B.Cost);
+            });
+            return true;
+        }
+    }
+    return false;
+}
+
+void FDSTaskScheduler::RunTask(FTask& Task)
+{
+    ++NumRunning;
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    Task.Work();
+
+    BusyCycles += FPlatformTime::Cycles64() - StartCycles;
+    --NumRunning;
+    ++NumCompleted;
+}
+
+FDSTaskSchedulerStats FDSTaskScheduler::GetStats() const
+{
+    FDSTaskSchedulerStats Stats;
+    Stats.NumWorkers = NumWorkers;
+    Stats.NumRunning = NumRunning.load();
+    Stats.NumCompleted = NumCompleted.load();
+    Stats.NumDiscarded = NumDiscarded.load();
+
+    {
+        FScopeLock Lock(&LanesLock);
+        for (int32 LaneIndex = 0; LaneIndex < (int32)EDSTaskLane::Count; ++LaneIndex)
+        {
+            Stats.NumQueued[LaneIndex] = Lanes[LaneIndex].Num();
+        }
+    }
+
+    Stats.Utilization = LastUtilization;
+    return Stats;
+}
+
+void FDSTaskScheduler::SampleUtilization()
+{
+    const uint64 NowCycles = FPlatformTime::Cycles64();
+    const uint64 ElapsedCycles = NowCycles - WindowStartTimeCycles;
+    if (FPlatformTime::ToSeconds64(ElapsedCycles) < DSTaskScheduler::UtilizationWindowSeconds)
+    {
+        return;
+    }
+
+    const uint64 Busy = BusyCycles.load();
+    LastUtilization = FMath::Clamp((float)((double)(Busy - WindowStartBusyCycles) / ((double)ElapsedCycles * NumWorkers)), 0.0f, 1.0f);
+
+    WindowStartBusyCycles = Busy;
+    WindowStartTimeCycles = NowCycles;
+}
+
+bool FDSTaskScheduler::IsIdle() const
+{
+    if (NumRunning.load() > 0)
+    {
+        return false;
+    }
+
+    FScopeLock Lock(&LanesLock);
+    for (int32 LaneIndex = 0; LaneIndex < (int32)EDSTaskLane::Count; ++LaneIndex)
+    {
+        if (Lanes[LaneIndex].Num() > 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,165 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
+
+// Forward declarations
+class FQueuedThreadPool;
+
+/**
+ * Priority lanes of the task scheduler, lower lanes are always served first
+ */
+enum class EDSTaskLane : uint8
+{
+    Visible,    // Work for content currently on screen
+    Normal,     // Work for the rest of the imported scene
+    Background, // Caches and bookkeeping nobody waits for
+    Count
+};
+
+/**
+ * Snapshot of the scheduler's load
+ */
+struct FDSTaskSchedulerStats
+{
+    int32 NumWorkers = 0;
+    int32 NumRunning = 0;
+    int32 NumQueued[(int32)EDSTaskLane::Count] = { 0 };
+    int64 NumCompleted = 0;
+    int64 NumDiscarded = 0;
+
+    /** Fraction of worker time spent running tasks over the last sampled window */
+    float Utilization = 0.0f;
+
+    /**
+     * Gets the number of queued tasks over all lanes
+     */
+    int32 GetNumQueued() const;
+
+    /**
+     * Formats the stats as a single log line
+     */
+    FString ToString() const;
+};
+
+/**
+ * FDSTaskScheduler - Runs post-import work on a dedicated, bounded set of worker threads
+ *
+ * Imports used to fan work out to every background thread at once, which starved the game and
+ * render threads. The scheduler owns its own below-normal priority pool sized to leave a number
+ * of cores untouched. Tasks go into per-lane queues; every free worker takes the most expensive
+ * task of the highest priority lane, so large bodies start early and small ones fill the gaps
+ * left at the end instead of one worker finishing a long tail alone.
+ *
+ * There is no work stealing: the per-lane queues are shared by all workers behind one lock. The
+ * tasks are coarse (a texture or a mesh each), so a worker never holds a private backlog another
+ * could steal from, and the shared queue already keeps every worker busy until the lanes drain.
+ */
+class DATASMITHTEST_API FDSTaskScheduler : public TSharedFromThis<FDSTaskScheduler, ESPMode::ThreadSafe>
+{
+public:
+    /**
+     * @param InNumWorkers Number of worker threads, 0 to derive it from the core count
+     * @param InNumReservedCores Cores left for the game, render and RHI threads when deriving the worker count
+     */
+    FDSTaskScheduler(int32 InNumWorkers, int32 InNumReservedCores);
+    ~FDSTaskScheduler();
+
+    /**
+     * Computes the worker count for the given settings on this machine
+     */
+    static int32 ComputeWorkerCount(int32 RequestedWorkers, int32 NumReservedCores);
+
+    /**
+     * Allocates an id that tags related tasks so they can be discarded together
+     */
+    uint64 AllocateGroup();
+
+    /**
+     * Queues a task
+     * @param Lane Priority lane
+     * @param Cost Estimated cost used to start expensive tasks first, any consistent unit
+     * @param Work Function run on a worker thread
+     * @param Group Group the task belongs to, 0 for none
+     */
+    void Submit(EDSTaskLane Lane, int64 Cost, TUniqueFunction<void()>&& Work, uint64 Group = 0);
+
+    /**
+     * Removes the queued tasks of a group without running them; tasks already running finish normally
+     * @param Group Group returned by AllocateGroup
+     * @return Number of tasks discarded
+     */
+    int32 DiscardGroup(uint64 Group);
+
+    /**
+     * Gets the current load with the utilization of the last completed sampling window
+     */
+    FDSTaskSchedulerStats GetStats() const;
+
+    /**
+     * Closes the utilization window once it has lasted long enough and starts the next one;
+     * called once per frame by the owner, never by readers of the stats
+     */
+    void SampleUtilization();
+
+    /**
+     * Checks whether no task is queued or running
+     */
+    bool IsIdle() const;
+
+    /**
+     * Gets the number of worker threads
+     */
+    int32 GetNumWorkers() const { return NumWorkers; }
+
+private:
+    struct FTask
+    {
+        int64 Cost = 0;
+        uint64 Group = 0;
+        TUniqueFunction<void()> Work;
+    };
+
+    class FRunner;
+
+    /**
+     * Pops the best queued task, called by a worker when it becomes free
+     * @return False when nothing is queued
+     */
+    bool PopTask(FTask& OutTask);
+
+    /**
+     * Runs a task on the calling worker and records its busy time
+     */
+    void RunTask(FTask& Task);
+
+    FQueuedThreadPool* Pool = nullptr;
+    int32 NumWorkers = 0;
+
+    /** Queued tasks per lane, each a max heap on cost */
+    TArray<FTask> Lanes[(int32)EDSTaskLane::Count];
+    mutable FCriticalSection LanesLock;
+
+    std::atomic<int32> NumRunning{ 0 };
+    std::atomic<int64> NumCompleted{ 0 };
+    std::atomic<int64> NumDiscarded{ 0 };
+    std::atomic<uint64> NextGroup{ 1 };
+    std::atomic<uint64> BusyCycles{ 0 };
+
+    /** Start of the current utilization window, and the utilization of the last completed one */
+    uint64 WindowStartBusyCycles = 0;
+    uint64 WindowStartTimeCycles = 0;
+    float LastUtilization = 0.0f;
+};
@@ -0,0 +1,523 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSTessellationPredictor.h"
+#include "DSStaticMeshRebuild.h"
+#include "DSTaskScheduler.h"
+#include "DSTrace.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+#include "Misc/ScopeLock.h"
+
+// Logging category for the tessellation predictor
+DEFINE_LOG_CATEGORY_STATIC(LogDSTessellationPredictor, Log, All);
+
+namespace DSTessellationPredictor
+{
+    // Vertices closer than this (cm) are treated as one when finding neighbouring triangles
+    static constexpr float WeldTolerance = 0.001f;
+
+    // Edges bending less than this (radians) are flat, more than this factor of the normal tolerance are creases
+    static constexpr float MinCurvatureAngle = 0.1f * UE_PI / 180.0f;
+    static constexpr float CreaseAngleFactor = 1.5f;
+
+    // Triangles this close to the imported maximum edge length were split by it, and assumed
+    // to grow by the given factor without it
+    static constexpr float ConstrainedEdgeFraction = 0.9f;
+    static constexpr float UnconstrainedGrowth = 2.0f;
+
+    // Bounds of the number of triangles a sampled triangle can turn into
+    static constexpr float MinRefinement = 1.0f / 16.0f;
+    static constexpr float MaxRefinement = 256.0f;
+
+    /**
+     * Gets the vertex and index buffer size of a LOD
+     */
+    static int64 GetLODSize(const FStaticMeshLODResources& LOD)
+    {
+        const FStaticMeshVertexBuffers& VertexBuffers = LOD.VertexBuffers;
+        return (int64)VertexBuffers.PositionVertexBuffer.GetStride() * VertexBuffers.PositionVertexBuffer.GetNumVertices()
+            + VertexBuffers.StaticMeshVertexBuffer.GetTangentSize()
+            + VertexBuffers.StaticMeshVertexBuffer.GetTexCoordSize()
+            + (int64)VertexBuffers.ColorVertexBuffer.GetStride() * VertexBuffers.ColorVertexBuffer.GetNumVertices()
+            + LOD.IndexBuffer.GetIndexDataSize();
+    }
+
+    static FString FormatCount(double Count)
+    {
+        if (Count >= 1.0e6)
+        {
+            return FString::Printf(TEXT("%.2f M"), Count / 1.0e6);
+        }
+        if (Count >= 1.0e3)
+        {
+            return FString::Printf(TEXT("%.1f K"), Count / 1.0e3);
+        }
+        return FString::Printf(TEXT("%.0f"), Count);
+    }
+}
+
+FString FDSTessellationPrediction::ToString() const
+{
+    const double Ratio = CurrentTriangles > 0 ? (double)PredictedTriangles / CurrentTriangles : 1.0;
+    return FString::Printf(TEXT("~%s triangles (x%.2f), %.1f MB, %.1f s import (%d meshes sampled)"),
+        *DSTessellationPredictor::FormatCount((double)PredictedTriangles), Ratio,
+        PredictedMemoryBytes / (1024.0 * 1024.0), PredictedImportSeconds, NumSampledMeshes);
+}
+
+int32 FDSTessellationPredictor::Start(const TArray<UPrimitiveComponent*>& Primitives, const FDSTessellationSettings& InImportedSettings, float InImportSeconds, FDSTaskScheduler& Scheduler, int32 MaxSampledMeshes)
+{
+    DS_TRACE_SCOPE(FDSTessellationPredictor::Start);
+
+    Samples.Reset();
+    ImportedSettings = InImportedSettings;
+    ImportSeconds = InImportSeconds;
+    SceneTriangles = 0;
+    SceneDrawnTriangles = 0;
+    SceneMemoryBytes = 0;
+    UnsampledTriangles = 0;
+    UnsampledDrawnTriangles = 0;
+    bCancelled = false;
+
+    TArray<UStaticMesh*> Meshes;
+    FDSStaticMeshRebuild::GatherStaticMeshes(Primitives, Meshes);
+
+    TMap<const UStaticMesh*, int64> NumInstances;
+    for (const UPrimitiveComponent* Primitive : Primitives)
+    {
+        if (const UInstancedStaticMeshComponent* Instanced = Cast<UInstancedStaticMeshComponent>(Primitive))
+        {
+            NumInstances.FindOrAdd(Instanced->GetStaticMesh()) += Instanced->GetInstanceCount();
+        }
+        else if (const UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Primitive))
+        {
+            NumInstances.FindOrAdd(MeshComponent->GetStaticMesh()) += 1;
+        }
+    }
+
+    struct FMeshEntry
+    {
+        UStaticMesh* StaticMesh = nullptr;
+        int64 Triangles = 0;
+        int64 DrawnTriangles = 0;
+        bool bHasCPUData = false;
+    };
+
+    TArray<FMeshEntry> Entries;
+    Entries.Reserve(Meshes.Num());
+    for (UStaticMesh* StaticMesh : Meshes)
+    {
+        const FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+        if (!RenderData || RenderData->LODResources.Num() == 0)
+        {
+            continue;
+        }
+
+        // Only the first LOD is tessellated, the runtime importer builds no others
+        const FStaticMeshLODResources& LOD = RenderData->LODResources[0];
+        FMeshEntry& Entry = Entries.AddDefaulted_GetRef();
+        Entry.StaticMesh = StaticMesh;
+        Entry.Triangles = LOD.GetNumTriangles();
+        Entry.DrawnTriangles = Entry.Triangles * NumInstances.FindRef(StaticMesh);
+        Entry.bHasCPUData = FDSStaticMeshRebuild::HasCPUData(LOD);
+
+        SceneTriangles += Entry.Triangles;
+        SceneDrawnTriangles += Entry.DrawnTriangles;
+        SceneMemoryBytes += DSTessellationPredictor::GetLODSize(LOD);
+    }
+
+    if (Entries.Num() == 0 || SceneTriangles == 0)
+    {
+        return 0;
+    }
+
+    // Strata hold equal shares of the triangles, so the few large meshes that dominate the cost get strata of their own
+    Entries.Sort([](const FMeshEntry& A, const FMeshEntry& B)
+    {
+        return A.Triangles < B.Triangles;
+    });
+
+    const int32 NumStrata = FMath::Clamp(MaxSampledMeshes, 1, Entries.Num());
+    TArray<int32> SampledEntries;
+    int32 StratumStart = 0;
+    int32 StratumIndex = 0;
+    int64 StratumTriangles = 0;
+    int64 StratumDrawnTriangles = 0;
+    int64 AccumulatedTriangles = 0;
+    for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+    {
+        StratumTriangles += Entries[EntryIndex].Triangles;
+        StratumDrawnTriangles += Entries[EntryIndex].DrawnTriangles;
+        AccumulatedTriangles += Entries[EntryIndex].Triangles;
+
+        const int64 StratumEnd = SceneTriangles * (StratumIndex + 1) / NumStrata;
+        if (AccumulatedTriangles < StratumEnd && EntryIndex < Entries.Num() - 1)
+        {
+            continue;
+        }
+
+        // The mesh nearest the middle of the stratum that can be read back stands for it
+        const int32 Middle = (StratumStart + EntryIndex) / 2;
+        int32 Representative = INDEX_NONE;
+        for (int32 Offset = 0; Representative == INDEX_NONE && Offset <= EntryIndex - StratumStart; ++Offset)
+        {
+            for (const int32 Candidate : { Middle - Offset, Middle + Offset })
+            {
+                if (Candidate >= StratumStart && Candidate <= EntryIndex && Entries[Candidate].bHasCPUData && Entries[Candidate].Triangles > 0)
+                {
+                    Representative = Candidate;
+                    break;
+                }
+            }
+        }
+
+        if (Representative != INDEX_NONE)
+        {
+            FSampledMesh& Sample = Samples.AddDefaulted_GetRef();
+            Sample.StratumTriangles = StratumTriangles;
+            Sample.StratumDrawnTriangles = StratumDrawnTriangles;
+            SampledEntries.Add(Representative);
+        }
+        else
+        {
+            UnsampledTriangles += StratumTriangles;
+            UnsampledDrawnTriangles += StratumDrawnTriangles;
+        }
+
+        StratumStart = EntryIndex + 1;
+        StratumTriangles = 0;
+        StratumDrawnTriangles = 0;
+
+        // A large mesh may span several strata on its own
+        while (StratumIndex < NumStrata - 1 && AccumulatedTriangles >= SceneTriangles * (StratumIndex + 1) / NumStrata)
+        {
+            ++StratumIndex;
+        }
+    }
+
+    if (Samples.Num() == 0)
+    {
+        UE_LOG(LogDSTessellationPredictor, Log, TEXT("No imported mesh has CPU data, tessellation cost cannot be predicted"));
+        return 0;
+    }
+
+    // Snapshot on the game thread so the analysis never reads render data that may be rebuilt meanwhile
+    int64 NumSampledTriangles = 0;
+    for (int32 SampleIndex = 0; SampleIndex < Samples.Num(); ++SampleIndex)
+    {
+        const FStaticMeshLODResources& LOD = Entries[SampledEntries[SampleIndex]].StaticMesh->GetRenderData()->LODResources[0];
+        const FPositionVertexBuffer& PositionBuffer = LOD.VertexBuffers.PositionVertexBuffer;
+
+        FSampledMesh& Sample = Samples[SampleIndex];
+        Sample.Positions.SetNumUninitialized(PositionBuffer.GetNumVertices());
+        for (uint32 VertexIndex = 0; VertexIndex < PositionBuffer.GetNumVertices(); ++VertexIndex)
+        {
+            Sample.Positions[VertexIndex] = PositionBuffer.VertexPosition(VertexIndex);
+        }
+        LOD.IndexBuffer.GetCopy(Sample.Indices);
+        NumSampledTriangles += Sample.Indices.Num() / 3;
+    }
+
+    {
+        FScopeLock Lock(&StateLock);
+        bAnalyzed = false;
+        bHasPrediction = false;
+        bPredictionQueued = false;
+    }
+
+    TaskScheduler = Scheduler.AsWeak();
+    TaskGroup = Scheduler.AllocateGroup();
+
+    TSharedRef<FDSTessellationPredictor, ESPMode::ThreadSafe> This = AsShared();
+    Scheduler.Submit(EDSTaskLane::Background, NumSampledTriangles, [This]()
+    {
+        DS_TRACE_SCOPE(FDSTessellationPredictor::Analyze);
+
+        for (FSampledMesh& Sample : This->Samples)
+        {
+            if (This->bCancelled)
+            {
+                return;
+            }
+            Analyze(Sample, This->ImportedSettings);
+        }
+
+        FScopeLock Lock(&This->StateLock);
+        This->bAnalyzed = true;
+        This->QueuePrediction();
+    }, TaskGroup);
+
+    UE_LOG(LogDSTessellationPredictor, Log, TEXT("Sampling %d of %d meshes (%lld of %lld triangles) to predict tessellation costs"),
+           Samples.Num(), Entries.Num(), NumSampledTriangles, SceneTriangles);
+
+    return Samples.Num();
+}
+
+void FDSTessellationPredictor::Predict(const FDSTessellationSettings& Proposed)
+{
+    FScopeLock Lock(&StateLock);
+    RequestedSettings = Proposed;
+    ++RequestedGeneration;
+    bHasRequest = true;
+    QueuePrediction();
+}
+
+void FDSTessellationPredictor::Cancel()
+{
+    bCancelled = true;
+
+    if (TSharedPtr<FDSTaskScheduler, ESPMode::ThreadSafe> Scheduler = TaskScheduler.Pin())
+    {
+        Scheduler->DiscardGroup(TaskGroup);
+    }
+}
+
+bool FDSTessellationPredictor::GetPrediction(FDSTessellationPrediction& OutPrediction) const
+{
+    FScopeLock Lock(&StateLock);
+    if (!bHasPrediction)
+    {
+        return false;
+    }
+
+    OutPrediction = Prediction;
+    return true;
+}
+
+bool FDSTessellationPredictor::IsBusy() const
+{
+    FScopeLock Lock(&StateLock);
+    return !bAnalyzed || bPredictionQueued;
+}
+
+void FDSTessellationPredictor::QueuePrediction()
+{
+    if (!bAnalyzed || !bHasRequest || bPredictionQueued || bCancelled)
+    {
+        return;
+    }
+
+    TSharedPtr<FDSTaskScheduler, ESPMode::ThreadSafe> Scheduler = TaskScheduler.Pin();
+    if (!Scheduler.IsValid())
+    {
+        return;
+    }
+
+    // One task at a time; it picks up settings requested while it ran before finishing
+    bPredictionQueued = true;
+
+    TSharedRef<FDSTessellationPredictor, ESPMode::ThreadSafe> This = AsShared();
+    Scheduler->Submit(EDSTaskLane::Background, 0, [This]()
+    {
+        DS_TRACE_SCOPE(FDSTessellationPredictor::ComputePrediction);
+
+        while (!This->bCancelled)
+        {
+            FDSTessellationSettings Settings;
+            uint32 Generation = 0;
+            {
+                FScopeLock Lock(&This->StateLock);
+                Settings = This->RequestedSettings;
+                Generation = This->RequestedGeneration;
+            }
+
+            const FDSTessellationPrediction Result = This->ComputePrediction(Settings);
+
+            FScopeLock Lock(&This->StateLock);
+            This->Prediction = Result;
+            This->bHasPrediction = true;
+            if (Generation == This->RequestedGeneration)
+            {
+                This->bPredictionQueued = false;
+                return;
+            }
+        }
+    }, TaskGroup);
+}
+
+void FDSTessellationPredictor::Analyze(FSampledMesh& Mesh, const FDSTessellationSettings& ImportedSettings)
+{
+    using namespace DSTessellationPredictor;
+
+    const int32 NumTriangles = Mesh.Indices.Num() / 3;
+    Mesh.Triangles.SetNum(NumTriangles);
+
+    // Tessellators split vertices along the seams of CAD faces, neighbours are found through welded positions
+    TMap<FIntVector, int32> VertexIds;
+    VertexIds.Reserve(Mesh.Positions.Num());
+    TArray<int32> WeldedIds;
+    WeldedIds.SetNumUninitialized(Mesh.Positions.Num());
+    for (int32 VertexIndex = 0; VertexIndex < Mesh.Positions.Num(); ++VertexIndex)
+    {
+        const FVector3f& Position = Mesh.Positions[VertexIndex];
+        const FIntVector Key(FMath::RoundToInt(Position.X / WeldTolerance), FMath::RoundToInt(Position.Y / WeldTolerance), FMath::RoundToInt(Position.Z / WeldTolerance));
+        WeldedIds[VertexIndex] = VertexIds.FindOrAdd(Key, VertexIds.Num());
+    }
+
+    TArray<FVector3f> Normals;
+    TArray<FVector3f> Centroids;
+    Normals.SetNumUninitialized(NumTriangles);
+    Centroids.SetNumUninitialized(NumTriangles);
+    for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+    {
+        const FVector3f& A = Mesh.Positions[Mesh.Indices[Triangle * 3 + 0]];
+        const FVector3f& B = Mesh.Positions[Mesh.Indices[Triangle * 3 + 1]];
+        const FVector3f& C = Mesh.Positions[Mesh.Indices[Triangle * 3 + 2]];
+
+        // Degenerate triangles get a zero normal and are never paired
+        Normals[Triangle] = ((C - A) ^ (B - A)).GetSafeNormal();
+        Centroids[Triangle] = (A + B + C) / 3.0f;
+        Mesh.Triangles[Triangle].LongestEdge = FMath::Sqrt(FMath::Max3((B - A).SizeSquared(), (C - B).SizeSquared(), (A - C).SizeSquared()));
+    }
+
+    // Bending across each shared edge over the distance between the triangles gives the local curvature radius
+    const float CreaseAngle = FMath::DegreesToRadians(ImportedSettings.NormalTolerance) * CreaseAngleFactor;
+    TMap<uint64, int32> OpenEdges;
+    OpenEdges.Reserve(NumTriangles * 3 / 2);
+    for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+    {
+        if (Normals[Triangle].IsZero())
+        {
+            continue;
+        }
+
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            const uint32 VertexA = WeldedIds[Mesh.Indices[Triangle * 3 + Corner]];
+            const uint32 VertexB = WeldedIds[Mesh.Indices[Triangle * 3 + (Corner + 1) % 3]];
+            if (VertexA == VertexB)
+            {
+                continue;
+            }
+
+            const uint64 EdgeKey = ((uint64)FMath::Min(VertexA, VertexB) << 32) | FMath::Max(VertexA, VertexB);
+            int32 Neighbour = INDEX_NONE;
+            if (!OpenEdges.RemoveAndCopyValue(EdgeKey, Neighbour))
+            {
+                OpenEdges.Add(EdgeKey, Triangle);
+                continue;
+            }
+
+            const float Angle = FMath::Acos(FMath::Clamp(Normals[Triangle] | Normals[Neighbour], -1.0f, 1.0f));
+            if (Angle < MinCurvatureAngle || Angle > CreaseAngle)
+            {
+                continue;
+            }
+
+            const float Radius = FVector3f::Distance(Centroids[Triangle], Centroids[Neighbour]) / Angle;
+            for (const int32 Updated : { Triangle, Neighbour })
+            {
+                float& TriangleRadius = Mesh.Triangles[Updated].Radius;
+                TriangleRadius = TriangleRadius > 0.0f ? FMath::Min(TriangleRadius, Radius) : Radius;
+            }
+        }
+    }
+
+    // Only the measurements are needed from here on
+    Mesh.Positions.Empty();
+    Mesh.Indices.Empty();
+}
+
+float FDSTessellationPredictor::GetSegmentAngle(float Radius, const FDSTessellationSettings& Settings)
+{
+    // Half a turn per segment when no tolerance applies
+    float Angle = UE_PI;
+
+    if (Settings.ChordTolerance > 0.0f)
+    {
+        Angle = FMath::Min(Angle, 2.0f * FMath::Acos(FMath::Clamp(1.0f - Settings.ChordTolerance / Radius, -1.0f, 1.0f)));
+    }
+
+    if (Settings.NormalTolerance > 0.0f)
+    {
+        Angle = FMath::Min(Angle, FMath::DegreesToRadians(Settings.NormalTolerance));
+    }
+
+    if (Settings.MaxEdgeLength > 0.0f)
+    {
+        Angle = FMath::Min(Angle, Settings.MaxEdgeLength / Radius);
+    }
+
+    return FMath::Max(Angle, UE_KINDA_SMALL_NUMBER);
+}
+
+float FDSTessellationPredictor::GetRefinement(const FTriangleSample& Triangle, const FDSTessellationSettings& ImportedSettings, const FDSTessellationSettings& Proposed)
+{
+    using namespace DSTessellationPredictor;
+
+    float NaturalEdge = Triangle.LongestEdge;
+    if (ImportedSettings.MaxEdgeLength > 0.0f && Triangle.LongestEdge >= ImportedSettings.MaxEdgeLength * ConstrainedEdgeFraction)
+    {
+        NaturalEdge *= UnconstrainedGrowth;
+    }
+
+    const float TargetEdge = Proposed.MaxEdgeLength > 0.0f ? FMath::Min(NaturalEdge, Proposed.MaxEdgeLength) : NaturalEdge;
+    float Refinement = TargetEdge > 0.0f ? FMath::Square(Triangle.LongestEdge / TargetEdge) : 1.0f;
+
+    // Curved regions get one row of triangles per segment across the curvature, and the edge limit along it
+    if (Triangle.Radius > 0.0f)
+    {
+        const float SegmentRatio = GetSegmentAngle(Triangle.Radius, ImportedSettings) / GetSegmentAngle(Triangle.Radius, Proposed);
+        Refinement = SegmentRatio * FMath::Sqrt(Refinement);
+    }
+
+    return FMath::Clamp(Refinement, MinRefinement, MaxRefinement);
+}
+
+FDSTessellationPrediction FDSTessellationPredictor::ComputePrediction(const FDSTessellationSettings& Proposed) const
+{
+    FDSTessellationPrediction Result;
+    Result.Settings = Proposed;
+    Result.NumSampledMeshes = Samples.Num();
+    Result.CurrentTriangles = SceneTriangles;
+    Result.CurrentDrawnTriangles = SceneDrawnTriangles;
+    Result.CurrentMemoryBytes = SceneMemoryBytes;
+    Result.CurrentImportSeconds = ImportSeconds;
+
+    double PredictedTriangles = 0.0;
+    double PredictedDrawnTriangles = 0.0;
+    double SampledStrataTriangles = 0.0;
+    for (const FSampledMesh& Sample : Samples)
+    {
+        if (Sample.Triangles.Num() == 0)
+        {
+            continue;
+        }
+
+        double Refined = 0.0;
+        for (const FTriangleSample& Triangle : Sample.Triangles)
+        {
+            Refined += GetRefinement(Triangle, ImportedSettings, Proposed);
+        }
+
+        const double Ratio = Refined / Sample.Triangles.Num();
+        PredictedTriangles += Sample.StratumTriangles * Ratio;
+        PredictedDrawnTriangles += Sample.StratumDrawnTriangles * Ratio;
+        SampledStrataTriangles += Sample.StratumTriangles;
+        Result.NumSampledTriangles += Sample.Triangles.Num();
+    }
+
+    // Strata without CPU data follow the average of the sampled ones
+    const double AverageRatio = SampledStrataTriangles > 0.0 ? PredictedTriangles / SampledStrataTriangles : 1.0;
+    PredictedTriangles += UnsampledTriangles * AverageRatio;
+    PredictedDrawnTriangles += UnsampledDrawnTriangles * AverageRatio;
+
+    // Vertices per triangle stay about the same, and tessellating and building the meshes dominate the import
+    const double SceneRatio = SceneTriangles > 0 ? PredictedTriangles / SceneTriangles : 1.0;
+    Result.PredictedTriangles = (int64)PredictedTriangles;
+    Result.PredictedDrawnTriangles = (int64)PredictedDrawnTriangles;
+    Result.PredictedMemoryBytes = (int64)(SceneMemoryBytes * SceneRatio);
+    Result.PredictedImportSeconds = (float)(ImportSeconds * SceneRatio);
+
+    return Result;
+}
@@ -0,0 +1,200 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
+
+// Forward declarations
+class UPrimitiveComponent;
+class FDSTaskScheduler;
+
+/**
+ * Tessellation tolerances, as passed to the Datasmith runtime import options
+ */
+struct FDSTessellationSettings
+{
+    /** Chord tolerance in cm */
+    float ChordTolerance = 0.05f;
+
+    /** Maximum edge length in cm, 0 for none */
+    float MaxEdgeLength = 0.0f;
+
+    /** Normal tolerance in degrees */
+    float NormalTolerance = 5.0f;
+};
+
+/**
+ * Estimated cost of the imported scene at other tessellation settings
+ */
+struct FDSTessellationPrediction
+{
+    FDSTessellationSettings Settings;
+
+    /** Meshes and triangles the estimate was extrapolated from */
+    int32 NumSampledMeshes = 0;
+    int64 NumSampledTriangles = 0;
+
+    /** Triangles of the unique meshes, what memory and import time scale with */
+    int64 CurrentTriangles = 0;
+    int64 PredictedTriangles = 0;
+
+    /** Triangles drawn, counting every instance */
+    int64 CurrentDrawnTriangles = 0;
+    int64 PredictedDrawnTriangles = 0;
+
+    /** Vertex and index buffer memory of the unique meshes */
+    int64 CurrentMemoryBytes = 0;
+    int64 PredictedMemoryBytes = 0;
+
+    float CurrentImportSeconds = 0.0f;
+    float PredictedImportSeconds = 0.0f;
+
+    /**
+     * Formats the prediction as a single line for the UI and the log
+     */
+    FString ToString() const;
+};
+
+/**
+ * FDSTessellationPredictor - Estimates triangle count, memory and import time at other tolerances
+ *
+ * The runtime importer tessellates CAD bodies inside the Datasmith runtime and keeps no B-rep
+ * around afterwards, so bodies cannot be tessellated again outside of a full reimport. Instead,
+ * a stratified sample of the imported meshes is analyzed once in the background: for every
+ * triangle, the curvature radius across its smooth edges and its longest edge. A tessellator
+ * places segments along a curve of radius R every min(2 acos(1 - Chord / R), NormalTolerance,
+ * MaxEdgeLength / R) radians, and splits flat regions down to the maximum edge length, so the
+ * ratio of those steps between the settings the scene was imported with and the proposed ones
+ * gives the refinement of each sampled triangle. Each sample stands for the meshes of its
+ * stratum; memory and import time are scaled with the unique triangle count.
+ */
+class DATASMITHTEST_API FDSTessellationPredictor : public TSharedFromThis<FDSTessellationPredictor, ESPMode::ThreadSafe>
+{
+public:
+    /**
+     * Snapshots a sample of the meshes used by the primitives and queues their analysis
+     * @param Primitives Imported components
+     * @param InImportedSettings Settings the components were tessellated with
+     * @param InImportSeconds Duration of the import that built them
+     * @param Scheduler Scheduler the analysis and the predictions run on
+     * @param MaxSampledMeshes Number of strata, each sampled with one mesh
+     * @return Number of meshes sampled, 0 if no mesh has CPU data to analyze
+     */
+    int32 Start(const TArray<UPrimitiveComponent*>& Primitives, const FDSTessellationSettings& InImportedSettings, float InImportSeconds, FDSTaskScheduler& Scheduler, int32 MaxSampledMeshes = 16);
+
+    /**
+     * Requests a prediction for the proposed settings; requests made while one is computed
+     * replace each other, so only the latest settings are estimated
+     */
+    void Predict(const FDSTessellationSettings& Proposed);
+
+    /**
+     * Discards queued work; running tasks finish but their results are dropped
+     */
+    void Cancel();
+
+    /**
+     * Gets the latest finished prediction
+     * @return False until a prediction has been computed
+     */
+    bool GetPrediction(FDSTessellationPrediction& OutPrediction) const;
+
+    /**
+     * Checks whether the analysis or a prediction is still running
+     */
+    bool IsBusy() const;
+
+    /**
+     * Gets the settings the analyzed scene was tessellated with
+     */
+    const FDSTessellationSettings& GetImportedSettings() const { return ImportedSettings; }
+
+private:
+    /** Per triangle measurements of a sampled mesh */
+    struct FTriangleSample
+    {
+        /** Smallest curvature radius across the triangle's smooth edges in cm, 0 on flat regions */
+        float Radius = 0.0f;
+
+        /** Longest edge in cm */
+        float LongestEdge = 0.0f;
+    };
+
+    struct FSampledMesh
+    {
+        /** Snapshot, released once analyzed */
+        TArray<FVector3f> Positions;
+        TArray<uint32> Indices;
+
+        TArray<FTriangleSample> Triangles;
+
+        /** Triangles of the stratum this mesh stands for, unique and drawn */
+        int64 StratumTriangles = 0;
+        int64 StratumDrawnTriangles = 0;
+    };
+
+    /**
+     * Measures the curvature and edge lengths of a sampled mesh, safe to call from worker threads
+     */
+    static void Analyze(FSampledMesh& Mesh, const FDSTessellationSettings& ImportedSettings);
+
+    /**
+     * Gets the angle between tessellation segments along a curve of the given radius
+     */
+    static float GetSegmentAngle(float Radius, const FDSTessellationSettings& Settings);
+
+    /**
+     * Estimates how many triangles a sampled triangle turns into at the proposed settings
+     */
+    static float GetRefinement(const FTriangleSample& Triangle, const FDSTessellationSettings& ImportedSettings, const FDSTessellationSettings& Proposed);
+
+    /**
+     * Extrapolates the scene cost from the analyzed samples
+     */
+    FDSTessellationPrediction ComputePrediction(const FDSTessellationSettings& Proposed) const;
+
+    /**
+     * Queues a task computing the latest requested prediction, unless one is already queued
+     * Must be called with StateLock held
+     */
+    void QueuePrediction();
+
+    TArray<FSampledMesh> Samples;
+    FDSTessellationSettings ImportedSettings;
+    float ImportSeconds = 0.0f;
+
+    /** Scene totals at the imported settings */
+    int64 SceneTriangles = 0;
+    int64 SceneDrawnTriangles = 0;
+    int64 SceneMemoryBytes = 0;
+
+    /** Triangles of strata without a mesh with CPU data, extrapolated with the average of the samples */
+    int64 UnsampledTriangles = 0;
+    int64 UnsampledDrawnTriangles = 0;
+
+    TWeakPtr<FDSTaskScheduler, ESPMode::ThreadSafe> TaskScheduler;
+    uint64 TaskGroup = 0;
+
+    /** Requested settings and latest result, shared with the worker tasks */
+    mutable FCriticalSection StateLock;
+    FDSTessellationSettings RequestedSettings;
+    FDSTessellationPrediction Prediction;
+    uint32 RequestedGeneration = 0;
+    bool bHasRequest = false;
+    bool bHasPrediction = false;
+    bool bPredictionQueued = false;
+    bool bAnalyzed = false;
+
+    std::atomic<bool> bCancelled{ false };
+};
@@ -0,0 +1,263 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSTextureCompressionPass.h"
+#include "DSTaskScheduler.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Texture2D.h"
+#include "Materials/MaterialInterface.h"
+#include "MaterialShared.h"
+#include "RenderingThread.h"
+#include "RHI.h"
+
+// Logging category for the texture compression pass
+DEFINE_LOG_CATEGORY_STATIC(LogDSTextureCompression, Log, All);
+
+int32 FDSTextureCompressionPass::Start(const TArray<UPrimitiveComponent*>& Primitives, FDSTaskScheduler& Scheduler)
+{
+    Jobs.Reset();
+    NumSkipped = 0;
+    bCancelled = false;
+
+    // Unique textures referenced by the imported materials, and which of them are on screen
+    TSet<UTexture2D*> Textures;
+    TSet<UTexture2D*> VisibleTextures;
+    TArray<UTexture*> UsedTextures;
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+        if (!IsValid(Primitive))
+        {
+            continue;
+        }
+
+        const bool bVisible = Primitive->WasRecentlyRendered();
+        for (int32 MaterialIndex = 0; MaterialIndex < Primitive->GetNumMaterials(); ++MaterialIndex)
+        {
+            if (UMaterialInterface* Material = Primitive->GetMaterial(MaterialIndex))
+            {
+                UsedTextures.Reset();
+                Material->GetUsedTextures(UsedTextures, EMaterialQualityLevel::Num, true, GMaxRHIFeatureLevel, true);
+                for (UTexture* Texture : UsedTextures)
+                {
+                    if (UTexture2D* Texture2D = Cast<UTexture2D>(Texture))
+                    {
+                        Textures.Add(Texture2D);
+                        if (bVisible)
+                        {
+                            VisibleTextures.Add(Texture2D);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (UTexture2D* Texture : Textures)
+    {
+        // Only uncompressed textures created by the runtime import are candidates
+        FTexturePlatformData* PlatformData = Texture->GetPlatformData();
+        if (!PlatformData || PlatformData->PixelFormat != PF_B8G8R8A8 || PlatformData->Mips.Num() == 0)
+        {
+            continue;
+        }
+
+        FTexture2DMipMap& TopMip = PlatformData->Mips[0];
+        const int64 ExpectedSize = (int64)TopMip.SizeX * TopMip.SizeY * sizeof(FColor);
+        if (TopMip.SizeX % 4 != 0 || TopMip.SizeY % 4 != 0 || TopMip.BulkData.GetBulkDataSize() != ExpectedSize)
+        {
+            // Odd sizes cannot be block compressed and discarded bulk data cannot be read back
+            ++NumSkipped;
+            continue;
+        }
+
+        TSharedPtr<FJob, ESPMode::ThreadSafe> Job = MakeShared<FJob, ESPMode::ThreadSafe>();
+        Job->Texture = Texture;
+        Job->Width = TopMip.SizeX;
+        Job->Height = TopMip.SizeY;
+        Job->bIsNormalMap = Texture->CompressionSettings == TC_Normalmap;
+        Job->bVisible = VisibleTextures.Contains(Texture);
+        Job->Pixels.SetNumUninitialized(Job->Width * Job->Height);
+
+        const void* Data = TopMip.BulkData.LockReadOnly();
+        FMemory::Memcpy(Job->Pixels.GetData(), Data, ExpectedSize);
+        TopMip.BulkData.Unlock();
+
+        Jobs.Add(Job);
+    }
+
+    NumPending = Jobs.Num();
+    TaskScheduler = Scheduler.AsWeak();
+    TaskGroup = Scheduler.AllocateGroup();
+
+    TSharedRef<FDSTextureCompressionPass, ESPMode::ThreadSafe> This = AsShared();
+    for (const TSharedPtr<FJob, ESPMode::ThreadSafe>& Job : Jobs)
+    {
+        const EDSTaskLane Lane = Job->bVisible ? EDSTaskLane::Visible : EDSTaskLane::Normal;
+        Scheduler.Submit(Lane, Job->Pixels.Num(), [This, Job]()
+        {
+            This->RunJob(*Job);
+            --This->NumPending;
+        }, TaskGroup);
+    }
+
+    UE_LOG(LogDSTextureCompression, Log, TEXT("Compressing %d textures on %d workers (%d skipped)"), Jobs.Num(), Scheduler.GetNumWorkers(), NumSkipped);
+    return Jobs.Num();
+}
+
+void FDSTextureCompressionPass::Cancel()
+{
+    bCancelled = true;
+
+    // Jobs that already finished have written their results to the texture cache, only queued ones are lost
+    if (TSharedPtr<FDSTaskScheduler, ESPMode::ThreadSafe> Scheduler = TaskScheduler.Pin())
+    {
+        Scheduler->DiscardGroup(TaskGroup);
+    }
+}
+
+float FDSTextureCompressionPass::GetProgress() const
+{
+    if (Jobs.Num() == 0)
+    {
+        return 1.0f;
+    }
+
+    return 1.0f - (float)NumPending.load() / Jobs.Num();
+}
+
+void FDSTextureCompressionPass::RunJob(FJob& Job) const
+{
+    if (bCancelled)
+    {
+        return;
+    }
+
+    Job.ContentHash = FDSTextureCompressor::ComputeContentHash(Job.Pixels, Job.Width, Job.Height, Job.bIsNormalMap);
+    if (FDSTextureCompressor::LoadFromCache(Job.ContentHash, Job.Result))
+    {
+        Job.bSucceeded = true;
+        Job.bFromCache = true;
+        Job.bCached = true;
+    }
+    else
+    {
+        const EDSBlockFormat Format = FDSTextureCompressor::ChooseFormat(Job.Pixels, Job.bIsNormalMap);
+        Job.bSucceeded = FDSTextureCompressor::Compress(Job.Pixels, Job.Width, Job.Height, Format, Job.Result);
+
+        // Cached even when the pass was cancelled meanwhile, the result only depends on the pixels
+        if (Job.bSucceeded)
+        {
+            Job.bCached = FDSTextureCompressor::SaveToCache(Job.ContentHash, Job.Result);
+        }
+    }
+
+    // The snapshot is no longer needed once the compressed chain exists
+    Job.Pixels.Empty();
+}
+
+FDSTextureCompressionStats FDSTextureCompressionPass::ApplyResults()
+{
+    check(IsInGameThread());
+
+    FDSTextureCompressionStats Stats;
+    Stats.NumSkipped = NumSkipped;
+
+    if (bCancelled || !IsComplete())
+    {
+        Jobs.Reset();
+        return Stats;
+    }
+
+    TArray<FJob*> ReadyJobs;
+    for (const TSharedPtr<FJob, ESPMode::ThreadSafe>& Job : Jobs)
+    {
+        if (Job->bSucceeded && Job->Texture.IsValid() && Job->Texture->GetPlatformData())
+        {
+            ReadyJobs.Add(Job.Get());
+        }
+        else
+        {
+            ++Stats.NumSkipped;
+        }
+    }
+
+    // Release every texture first so a single flush covers the whole batch before the mips are rewritten
+    for (FJob* Job : ReadyJobs)
+    {
+        Job->Texture->ReleaseResource();
+    }
+    FlushRenderingCommands();
+
+    for (FJob* Job : ReadyJobs)
+    {
+        UTexture2D* Texture = Job->Texture.Get();
+        FTexturePlatformData* PlatformData = Texture->GetPlatformData();
+
+        for (const FTexture2DMipMap& OldMip : PlatformData->Mips)
+        {
+            Stats.BytesBefore += OldMip.BulkData.GetBulkDataSize();
+        }
+
+        Stats.BytesAfter += WriteMips(Texture, Job->Result, 0);
+        if (Job->bCached)
+        {
+            Stats.CachedTextures.Emplace(Texture, Job->ContentHash);
+        }
+        if (Job->bFromCache)
+        {
+            ++Stats.NumFromCache;
+        }
+        else
+        {
+            ++Stats.NumCompressed;
+        }
+
+        Texture->UpdateResource();
+    }
+
+    Jobs.Reset();
+
+    UE_LOG(LogDSTextureCompression, Log, TEXT("Compressed %d textures (%d from cache, %d skipped): %.1f MB -> %.1f MB"),
+           Stats.NumCompressed + Stats.NumFromCache, Stats.NumFromCache, Stats.NumSkipped,
+           Stats.BytesBefore / (1024.0 * 1024.0), Stats.BytesAfter / (1024.0 * 1024.0));
+
+    return Stats;
+}
+
+int64 FDSTextureCompressionPass::WriteMips(UTexture2D* Texture, const FDSCompressedTexture& Compressed, int32 FirstMip)
+{
+    FTexturePlatformData* PlatformData = Texture->GetPlatformData();
+    check(PlatformData && Compressed.Mips.IsValidIndex(FirstMip));
+
+    PlatformData->PixelFormat = Compressed.GetPixelFormat();
+    PlatformData->SizeX = FMath::Max(Compressed.Width >> FirstMip, 1);
+    PlatformData->SizeY = FMath::Max(Compressed.Height >> FirstMip, 1);
+    PlatformData->Mips.Empty();
+
+    int64 ResidentSize = 0;
+    for (int32 MipIndex = FirstMip; MipIndex < Compressed.Mips.Num(); ++MipIndex)
+    {
+        const TArray<uint8>& MipData = Compressed.Mips[MipIndex];
+
+        FTexture2DMipMap* Mip = new FTexture2DMipMap();
+        Mip->SizeX = FMath::Max(Compressed.Width >> MipIndex, 1);
+        Mip->SizeY = FMath::Max(Compressed.Height >> MipIndex, 1);
+        PlatformData->Mips.Add(Mip);
+
+        Mip->BulkData.Lock(LOCK_READ_WRITE);
+        FMemory::Memcpy(Mip->BulkData.Realloc(MipData.Num()), MipData.GetData(), MipData.Num());
+        Mip->BulkData.Unlock();
+
+        ResidentSize += MipData.Num();
+    }
+
+    return ResidentSize;
+}
@@ -0,0 +1,128 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DSTextureCompressor.h"
+#include <atomic>
+
+// Forward declarations
+class UPrimitiveComponent;
+class UTexture2D;
+class FDSTaskScheduler;
+
+/**
+ * Summary of a finished texture compression pass
+ */
+struct FDSTextureCompressionStats
+{
+    int32 NumCompressed = 0;
+    int32 NumFromCache = 0;
+    int32 NumSkipped = 0;
+    int64 BytesBefore = 0;
+    int64 BytesAfter = 0;
+
+    /** Textures whose compressed chain is stored in the cache, with their cache key */
+    TArray<TPair<TWeakObjectPtr<UTexture2D>, uint64>> CachedTextures;
+};
+
+/**
+ * FDSTextureCompressionPass - Replaces uncompressed runtime textures with block compressed ones
+ *
+ * Textures referenced by the imported materials are snapshotted on the game thread, then
+ * compressed (or loaded from the content hash cache) on the task scheduler. Once every job
+ * has finished, ApplyResults swaps the new mip chains into the existing texture objects so
+ * materials keep their references.
+ */
+class DATASMITHTEST_API FDSTextureCompressionPass : public TSharedFromThis<FDSTextureCompressionPass, ESPMode::ThreadSafe>
+{
+public:
+    /**
+     * Gathers the uncompressed textures used by the primitives and starts the background jobs.
+     * Textures of components on screen are compressed first.
+     * @param Primitives Imported components whose materials are scanned
+     * @param Scheduler Scheduler the jobs run on
+     * @return Number of textures queued for compression
+     */
+    int32 Start(const TArray<UPrimitiveComponent*>& Primitives, FDSTaskScheduler& Scheduler);
+
+    /**
+     * Discards queued jobs and asks running ones to stop; results of a cancelled pass are never
+     * applied, but textures already compressed stay in the texture cache for the next pass
+     */
+    void Cancel();
+
+    /**
+     * Checks whether every background job has finished
+     */
+    bool IsComplete() const { return NumPending.load() == 0; }
+
+    /**
+     * Gets the fraction of jobs that have finished
+     * @return Progress between 0 and 1, 1 when idle
+     */
+    float GetProgress() const;
+
+    /**
+     * Uploads the compressed mip chains into their textures, must run on the game thread
+     * @return Statistics for the pass
+     */
+    FDSTextureCompressionStats ApplyResults();
+
+    /**
+     * Replaces the mips of a texture with part of a compressed chain. The texture resource
+     * must have been released and flushed by the caller, and updated afterwards.
+     * @param Texture Texture to rewrite
+     * @param Compressed Full compressed mip chain
+     * @param FirstMip Index of the largest mip to keep resident
+     * @return Size of the resident mips in bytes
+     */
+    static int64 WriteMips(UTexture2D* Texture, const FDSCompressedTexture& Compressed, int32 FirstMip);
+
+private:
+    struct FJob
+    {
+        TWeakObjectPtr<UTexture2D> Texture;
+        TArray<FColor> Pixels;
+        int32 Width = 0;
+        int32 Height = 0;
+        bool bIsNormalMap = false;
+        bool bVisible = false;
+
+        FDSCompressedTexture Result;
+        uint64 ContentHash = 0;
+        bool bSucceeded = false;
+        bool bFromCache = false;
+        bool bCached = false;
+    };
+
+    /**
+     * Compresses a single job on a worker thread
+     */
+    void RunJob(FJob& Job) const;
+
+    /** Jobs of the current pass */
+    TArray<TSharedPtr<FJob, ESPMode::ThreadSafe>> Jobs;
+
+    /** Number of jobs that have not finished yet */
+    std::atomic<int32> NumPending{ 0 };
+
+    /** Set when the pass has been cancelled */
+    std::atomic<bool> bCancelled{ false };
+
+    /** Scheduler and task group the jobs were queued on, used to discard them on cancel */
+    TWeakPtr<FDSTaskScheduler, ESPMode::ThreadSafe> TaskScheduler;
+    uint64 TaskGroup = 0;
+
+    /** Textures that could not be snapshotted when the pass started */
+    int32 NumSkipped = 0;
+};
@@ -0,0 +1,418 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSTextureCompressor.h"
+#include "HAL/FileManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/Paths.h"
+#include "Serialization/Archive.h"
+
+// Logging category for the texture compressor
+DEFINE_LOG_CATEGORY_STATIC(LogDSTextureCompressor, Log, All);
+
+namespace DSTextureCompressor
+{
+    static constexpr uint32 CacheMagic = 0x44535458; // 'DSTX'
+    static constexpr int32 CacheVersion = 1;
+
+    static int32 GetBlockBytes(EDSBlockFormat Format)
+    {
+        return Format == EDSBlockFormat::BC1 ? 8 : 16;
+    }
+
+    static uint16 PackRGB565(const FVector3f& Color)
+    {
+        const uint32 R = FMath::Clamp(FMath::RoundToInt(Color.X * 31.0f / 255.0f), 0, 31);
+        const uint32 G = FMath::Clamp(FMath::RoundToInt(Color.Y * 63.0f / 255.0f), 0, 63);
+        const uint32 B = FMath::Clamp(FMath::RoundToInt(Color.Z * 31.0f / 255.0f), 0, 31);
+        return (uint16)((R << 11) | (G << 5) | B);
+    }
+
+    static FVector3f UnpackRGB565(uint16 Packed)
+    {
+        const uint32 R = (Packed >> 11) & 31;
+        const uint32 G = (Packed >> 5) & 63;
+        const uint32 B = Packed & 31;
+        return FVector3f((R << 3) | (R >> 2), (G << 2) | (G >> 4), (B << 3) | (B >> 2));
+    }
+
+    static void WriteUInt16(uint8* Output, uint16 Value)
+    {
+        Output[0] = (uint8)(Value & 0xFF);
+        Output[1] = (uint8)(Value >> 8);
+    }
+
+    // Copies a 4x4 block, clamping reads at the mip edge for mips smaller than a block
+    static void FetchBlock(const TArray<FColor>& Pixels, int32 Width, int32 Height, int32 BlockX, int32 BlockY, FColor* OutBlock)
+    {
+        for (int32 Y = 0; Y < 4; ++Y)
+        {
+            const int32 SourceY = FMath::Min(BlockY * 4 + Y, Height - 1);
+            for (int32 X = 0; X < 4; ++X)
+            {
+                const int32 SourceX = FMath::Min(BlockX * 4 + X, Width - 1);
+                OutBlock[Y * 4 + X] = Pixels[SourceY * Width + SourceX];
+            }
+        }
+    }
+}
+
+EPixelFormat FDSCompressedTexture::GetPixelFormat() const
+{
+    switch (Format)
+    {
+    case EDSBlockFormat::BC3:
+        return PF_DXT5;
+    case EDSBlockFormat::BC5:
+        return PF_BC5;
+    default:
+        return PF_DXT1;
+    }
+}
+
+int64 FDSCompressedTexture::GetTotalSize() const
+{
+    int64 TotalSize = 0;
+    for (const TArray<uint8>& Mip : Mips)
+    {
+        TotalSize += Mip.Num();
+    }
+    return TotalSize;
+}
+
+FArchive& operator<<(FArchive& Ar, FDSCompressedTexture& Texture)
+{
+    uint8 Format = (uint8)Texture.Format;
+    Ar << Format;
+    Texture.Format = (EDSBlockFormat)Format;
+
+    Ar << Texture.Width;
+    Ar << Texture.Height;
+    Ar << Texture.Mips;
+    return Ar;
+}
+
+EDSBlockFormat FDSTextureCompressor::ChooseFormat(const TArray<FColor>& Pixels, bool bIsNormalMap)
+{
+    if (bIsNormalMap)
+    {
+        return EDSBlockFormat::BC5;
+    }
+
+    for (const FColor& Pixel : Pixels)
+    {
+        if (Pixel.A < 255)
+        {
+            return EDSBlockFormat::BC3;
+        }
+    }
+
+    return EDSBlockFormat::BC1;
+}
+
+bool FDSTextureCompressor::Compress(const TArray<FColor>& Pixels, int32 Width, int32 Height, EDSBlockFormat Format, FDSCompressedTexture& OutTexture)
+{
+    // Block compressed top mips must be whole blocks
+    if (Width <= 0 || Height <= 0 || Width % 4 != 0 || Height % 4 != 0 || Pixels.Num() != Width * Height)
+    {
+        return false;
+    }
+
+    OutTexture.Format = Format;
+    OutTexture.Width = Width;
+    OutTexture.Height = Height;
+    OutTexture.Mips.Reset();
+
+    const int32 BlockBytes = DSTextureCompressor::GetBlockBytes(Format);
+
+    TArray<FColor> MipPixels = Pixels;
+    int32 MipWidth = Width;
+    int32 MipHeight = Height;
+
+    while (true)
+    {
+        const int32 BlocksX = FMath::DivideAndRoundUp(MipWidth, 4);
+        const int32 BlocksY = FMath::DivideAndRoundUp(MipHeight, 4);
+
+        TArray<uint8>& MipData = OutTexture.Mips.AddDefaulted_GetRef();
+        MipData.SetNumUninitialized(BlocksX * BlocksY * BlockBytes);
+
+        FColor Block[16];
+        uint8 Channel[16];
+        for (int32 BlockY = 0; BlockY < BlocksY; ++BlockY)
+        {
+            for (int32 BlockX = 0; BlockX < BlocksX; ++BlockX)
+            {
+                DSTextureCompressor::FetchBlock(MipPixels, MipWidth, MipHeight, BlockX, BlockY, Block);
+                uint8* Output = MipData.GetData() + (BlockY * BlocksX + BlockX) * BlockBytes;
+
+                switch (Format)
+                {
+                case EDSBlockFormat::BC1:
+                    EncodeColorBlock(Block, Output);
+                    break;
+
+                case EDSBlockFormat::BC3:
+                    for (int32 Index = 0; Index < 16; ++Index)
+                    {
+                        Channel[Index] = Block[Index].A;
+                    }
+                    EncodeSingleChannelBlock(Channel, Output);
+                    EncodeColorBlock(Block, Output + 8);
+                    break;
+
+                case EDSBlockFormat::BC5:
+                    for (int32 Index = 0; Index < 16; ++Index)
+                    {
+                        Channel[Index] = Block[Index].R;
+                    }
+                    EncodeSingleChannelBlock(Channel, Output);
+                    for (int32 Index = 0; Index < 16; ++Index)
+                    {
+                        Channel[Index] = Block[Index].G;
+                    }
+                    EncodeSingleChannelBlock(Channel, Output + 8);
+                    break;
+                }
+            }
+        }
+
+        if (MipWidth == 1 && MipHeight == 1)
+        {
+            break;
+        }
+
+        TArray<FColor> NextMip;
+        DownsampleMip(MipPixels, MipWidth, MipHeight, NextMip, MipWidth, MipHeight);
+        MipPixels = MoveTemp(NextMip);
+    }
+
+    return true;
+}
+
+void FDSTextureCompressor::EncodeColorBlock(const FColor* Block, uint8* Output)
+{
+    // Principal axis of the block colors, found by a few power iterations on the covariance
+    FVector3f Colors[16];
+    FVector3f Mean = FVector3f::ZeroVector;
+    for (int32 Index = 0; Index < 16; ++Index)
+    {
+        Colors[Index] = FVector3f(Block[Index].R, Block[Index].G, Block[Index].B);
+        Mean += Colors[Index];
+    }
+    Mean /= 16.0f;
+
+    float Covariance[6] = { 0.0f };
+    for (const FVector3f& Color : Colors)
+    {
+        const FVector3f Delta = Color - Mean;
+        Covariance[0] += Delta.X * Delta.X;
+        Covariance[1] += Delta.X * Delta.Y;
+        Covariance[2] += Delta.X * Delta.Z;
+        Covariance[3] += Delta.Y * Delta.Y;
+        Covariance[4] += Delta.Y * Delta.Z;
+        Covariance[5] += Delta.Z * Delta.Z;
+    }
+
+    FVector3f Axis(1.0f, 1.0f, 1.0f);
+    for (int32 Iteration = 0; Iteration < 4; ++Iteration)
+    {
+        Axis = FVector3f(
+            Covariance[0] * Axis.X + Covariance[1] * Axis.Y + Covariance[2] * Axis.Z,
+            Covariance[1] * Axis.X + Covariance[3] * Axis.Y + Covariance[4] * Axis.Z,
+            Covariance[2] * Axis.X + Covariance[4] * Axis.Y + Covariance[5] * Axis.Z);
+
+        if (!Axis.Normalize())
+        {
+            Axis = FVector3f(1.0f, 1.0f, 1.0f).GetUnsafeNormal();
+            break;
+        }
+    }
+
+    // Range fit: endpoints at the extreme projections, inset slightly to reduce the error of the extremes
+    float MinProjection = MAX_flt;
+    float MaxProjection = -MAX_flt;
+    for (const FVector3f& Color : Colors)
+    {
+        const float Projection = FVector3f::DotProduct(Color - Mean, Axis);
+        MinProjection = FMath::Min(MinProjection, Projection);
+        MaxProjection = FMath::Max(MaxProjection, Projection);
+    }
+
+    const float Inset = (MaxProjection - MinProjection) / 16.0f;
+    uint16 Color0 = DSTextureCompressor::PackRGB565(Mean + Axis * (MaxProjection - Inset));
+    uint16 Color1 = DSTextureCompressor::PackRGB565(Mean + Axis * (MinProjection + Inset));
+
+    // Four color mode requires Color0 > Color1
+    if (Color0 < Color1)
+    {
+        Swap(Color0, Color1);
+    }
+
+    uint32 Indices = 0;
+    if (Color0 != Color1)
+    {
+        const FVector3f Endpoint0 = DSTextureCompressor::UnpackRGB565(Color0);
+        const FVector3f Endpoint1 = DSTextureCompressor::UnpackRGB565(Color1);
+        const FVector3f Palette[4] =
+        {
+            Endpoint0,
+            Endpoint1,
+            (Endpoint0 * 2.0f + Endpoint1) / 3.0f,
+            (Endpoint0 + Endpoint1 * 2.0f) / 3.0f
+        };
+
+        for (int32 Index = 0; Index < 16; ++Index)
+        {
+            uint32 BestIndex = 0;
+            float BestDistance = MAX_flt;
+            for (uint32 PaletteIndex = 0; PaletteIndex < 4; ++PaletteIndex)
+            {
+                const float Distance = FVector3f::DistSquared(Colors[Index], Palette[PaletteIndex]);
+                if (Distance < BestDistance)
+                {
+                    BestDistance = Distance;
+                    BestIndex = PaletteIndex;
+                }
+            }
+            Indices |= BestIndex << (Index * 2);
+        }
+    }
+
+    DSTextureCompressor::WriteUInt16(Output, Color0);
+    DSTextureCompressor::WriteUInt16(Output + 2, Color1);
+    Output[4] = (uint8)(Indices & 0xFF);
+    Output[5] = (uint8)((Indices >> 8) & 0xFF);
+    Output[6] = (uint8)((Indices >> 16) & 0xFF);
+    Output[7] = (uint8)(Indices >> 24);
+}
+
+void FDSTextureCompressor::EncodeSingleChannelBlock(const uint8* Values, uint8* Output)
+{
+    uint8 MinValue = 255;
+    uint8 MaxValue = 0;
+    for (int32 Index = 0; Index < 16; ++Index)
+    {
+        MinValue = FMath::Min(MinValue, Values[Index]);
+        MaxValue = FMath::Max(MaxValue, Values[Index]);
+    }
+
+    // Eight value mode (first endpoint greater than the second), the endpoints span the block range
+    Output[0] = MaxValue;
+    Output[1] = MinValue;
+
+    uint64 Indices = 0;
+    if (MaxValue != MinValue)
+    {
+        const float Range = (float)(MaxValue - MinValue);
+        for (int32 Index = 0; Index < 16; ++Index)
+        {
+            // Step 0 is the first endpoint and step 7 the second, interpolants are stored as indices 2..7
+            const int32 Step = FMath::RoundToInt((MaxValue - Values[Index]) * 7.0f / Range);
+            const uint64 BlockIndex = Step == 0 ? 0 : (Step == 7 ? 1 : Step + 1);
+            Indices |= BlockIndex << (Index * 3);
+        }
+    }
+
+    for (int32 Byte = 0; Byte < 6; ++Byte)
+    {
+        Output[2 + Byte] = (uint8)((Indices >> (Byte * 8)) & 0xFF);
+    }
+}
+
+void FDSTextureCompressor::DownsampleMip(const TArray<FColor>& Source, int32 SourceWidth, int32 SourceHeight, TArray<FColor>& OutMip, int32& OutWidth, int32& OutHeight)
+{
+    OutWidth = FMath::Max(SourceWidth / 2, 1);
+    OutHeight = FMath::Max(SourceHeight / 2, 1);
+    OutMip.SetNumUninitialized(OutWidth * OutHeight);
+
+    // 2x2 box filter, collapsing to a 2x1 filter once one dimension reaches a single pixel
+    for (int32 Y = 0; Y < OutHeight; ++Y)
+    {
+        const int32 Y0 = FMath::Min(Y * 2, SourceHeight - 1);
+        const int32 Y1 = FMath::Min(Y * 2 + 1, SourceHeight - 1);
+        for (int32 X = 0; X < OutWidth; ++X)
+        {
+            const int32 X0 = FMath::Min(X * 2, SourceWidth - 1);
+            const int32 X1 = FMath::Min(X * 2 + 1, SourceWidth - 1);
+
+            const FColor& A = Source[Y0 * SourceWidth + X0];
+            const FColor& B = Source[Y0 * SourceWidth + X1];
+            const FColor& C = Source[Y1 * SourceWidth + X0];
+            const FColor& D = Source[Y1 * SourceWidth + X1];
+
+            OutMip[Y * OutWidth + X] = FColor(
+                (uint8)((A.R + B.R + C.R + D.R + 2) / 4),
+                (uint8)((A.G + B.G + C.G + D.G + 2) / 4),
+                (uint8)((A.B + B.B + C.B + D.B + 2) / 4),
+                (uint8)((A.A + B.A + C.A + D.A + 2) / 4));
+        }
+    }
+}
+
+uint64 FDSTextureCompressor::ComputeContentHash(const TArray<FColor>& Pixels, int32 Width, int32 Height, bool bIsNormalMap)
+{
+    FXxHash64Builder Builder;
+    Builder.Update(&Width, sizeof(Width));
+    Builder.Update(&Height, sizeof(Height));
+    Builder.Update(&bIsNormalMap, sizeof(bIsNormalMap));
+    Builder.Update(Pixels.GetData(), Pixels.Num() * sizeof(FColor));
+    return Builder.Finalize().Hash;
+}
+
+FString FDSTextureCompressor::GetCachePath(uint64 ContentHash)
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("DatasmithTest"), TEXT("TextureCache"), FString::Printf(TEXT("%016llx.dstex"), ContentHash));
+}
+
+bool FDSTextureCompressor::LoadFromCache(uint64 ContentHash, FDSCompressedTexture& OutTexture)
+{
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*GetCachePath(ContentHash)));
+    if (!Reader)
+    {
+        return false;
+    }
+
+    uint32 Magic = 0;
+    int32 Version = 0;
+    uint64 StoredHash = 0;
+    *Reader << Magic;
+    *Reader << Version;
+    *Reader << StoredHash;
+
+    if (Magic != DSTextureCompressor::CacheMagic || Version != DSTextureCompressor::CacheVersion || StoredHash != ContentHash)
+    {
+        return false;
+    }
+
+    *Reader << OutTexture;
+    return !Reader->IsError() && OutTexture.Mips.Num() > 0;
+}
+
+bool FDSTextureCompressor::SaveToCache(uint64 ContentHash, const FDSCompressedTexture& Texture)
+{
+    const FString CachePath = GetCachePath(ContentHash);
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*CachePath));
+    if (!Writer)
+    {
+        UE_LOG(LogDSTextureCompressor, Warning, TEXT("Could not write texture cache file %s"), *CachePath);
+        return false;
+    }
+
+    uint32 Magic = DSTextureCompressor::CacheMagic;
+    int32 Version = DSTextureCompressor::CacheVersion;
+    *Writer << Magic;
+    *Writer << Version;
+    *Writer << ContentHash;
+    *Writer << const_cast<FDSCompressedTexture&>(Texture);
+
+    return Writer->Close();
+}
@@ -0,0 +1,106 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PixelFormat.h"
+
+/**
+ * Block compression formats the runtime compressor can produce
+ */
+enum class EDSBlockFormat : uint8
+{
+    BC1,    // Opaque color, 4 bits per pixel
+    BC3,    // Color with alpha, 8 bits per pixel
+    BC5     // Two channel normal maps, 8 bits per pixel
+};
+
+/**
+ * Block compressed texture with its full mip chain
+ */
+struct FDSCompressedTexture
+{
+    EDSBlockFormat Format = EDSBlockFormat::BC1;
+    int32 Width = 0;
+    int32 Height = 0;
+
+    /** Block data of each mip, largest first */
+    TArray<TArray<uint8>> Mips;
+
+    /**
+     * Gets the engine pixel format matching the block format
+     */
+    EPixelFormat GetPixelFormat() const;
+
+    /**
+     * Gets the total size of all mips in bytes
+     */
+    int64 GetTotalSize() const;
+
+    friend FArchive& operator<<(FArchive& Ar, FDSCompressedTexture& Texture);
+};
+
+/**
+ * FDSTextureCompressor - CPU block compressor for runtime-imported textures
+ *
+ * Runtime textures arrive as uncompressed BGRA8. The compressor builds a box-filtered mip
+ * chain and encodes each level to BC1, BC3 or BC5 with a fast principal-axis range fit.
+ * It only works on plain pixel data and is safe to call from worker threads.
+ */
+class DATASMITHTEST_API FDSTextureCompressor
+{
+public:
+    /**
+     * Picks the block format for a texture from its content
+     * @param Pixels Top mip pixels
+     * @param bIsNormalMap Whether the texture is sampled as a normal map
+     * @return BC5 for normal maps, BC3 when any pixel is not fully opaque, BC1 otherwise
+     */
+    static EDSBlockFormat ChooseFormat(const TArray<FColor>& Pixels, bool bIsNormalMap);
+
+    /**
+     * Generates mips and block compresses them
+     * @param Pixels Top mip pixels, Width * Height entries
+     * @param Width Width of the top mip, must be a multiple of 4
+     * @param Height Height of the top mip, must be a multiple of 4
+     * @param Format Block format to encode to
+     * @param OutTexture Receives the compressed mip chain
+     * @return True if the texture could be compressed
+     */
+    static bool Compress(const TArray<FColor>& Pixels, int32 Width, int32 Height, EDSBlockFormat Format, FDSCompressedTexture& OutTexture);
+
+    /**
+     * Computes the content hash used as the cache key
+     */
+    static uint64 ComputeContentHash(const TArray<FColor>& Pixels, int32 Width, int32 Height, bool bIsNormalMap);
+
+    /**
+     * Gets the cache file for a content hash
+     */
+    static FString GetCachePath(uint64 ContentHash);
+
+    /**
+     * Loads a compressed texture from the cache
+     * @return True if a valid cache entry was found
+     */
+    static bool LoadFromCache(uint64 ContentHash, FDSCompressedTexture& OutTexture);
+
+    /**
+     * Stores a compressed texture in the cache
+     */
+    static bool SaveToCache(uint64 ContentHash, const FDSCompressedTexture& Texture);
+
+private:
+    static void EncodeColorBlock(const FColor* Block, uint8* Output);
+    static void EncodeSingleChannelBlock(const uint8* Values, uint8* Output);
+    static void DownsampleMip(const TArray<FColor>& Source, int32 SourceWidth, int32 SourceHeight, TArray<FColor>& OutMip, int32& OutWidth, int32& OutHeight);
+};
@@ -0,0 +1,372 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSTextureStreamer.h"
+#include "DSTextureCompressionPass.h"
+#include "Async/Async.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Texture2D.h"
+#include "Materials/MaterialInterface.h"
+#include "MaterialShared.h"
+#include "RenderingThread.h"
+#include "RHI.h"
+
+// Logging category for the texture streamer
+DEFINE_LOG_CATEGORY_STATIC(LogDSTextureStreamer, Log, All);
+
+FDSTextureStreamer::FDSTextureStreamer(const FDSTextureStreamingSettings& InSettings)
+    : Settings(InSettings)
+{
+}
+
+void FDSTextureStreamer::Register(UTexture2D* Texture, uint64 CacheKey)
+{
+    FTexturePlatformData* PlatformData = IsValid(Texture) ? Texture->GetPlatformData() : nullptr;
+    if (!PlatformData || PlatformData->Mips.Num() == 0)
+    {
+        return;
+    }
+
+    FEntry& Entry = Entries.FindOrAdd(Texture);
+    Entry.Texture = Texture;
+    Entry.CacheKey = CacheKey;
+    Entry.MaxDimension = FMath::Max(PlatformData->Mips[0].SizeX, PlatformData->Mips[0].SizeY);
+    Entry.ResidentMips = PlatformData->Mips.Num();
+    Entry.WantedMips = Entry.ResidentMips;
+    Entry.LastNeededTime = FPlatformTime::Seconds();
+    Entry.bCacheMissing = false;
+    Entry.LoadedChain.Reset();
+
+    Entry.MipSizes.Reset(PlatformData->Mips.Num());
+    for (const FTexture2DMipMap& Mip : PlatformData->Mips)
+    {
+        Entry.MipSizes.Add(Mip.BulkData.GetBulkDataSize());
+    }
+}
+
+void FDSTextureStreamer::SetPrimitives(const TArray<UPrimitiveComponent*>& Primitives)
+{
+    for (TPair<TWeakObjectPtr<UTexture2D>, FEntry>& Pair : Entries)
+    {
+        Pair.Value.Users.Reset();
+    }
+
+    TArray<UTexture*> UsedTextures;
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+        if (!IsValid(Primitive))
+        {
+            continue;
+        }
+
+        for (int32 MaterialIndex = 0; MaterialIndex < Primitive->GetNumMaterials(); ++MaterialIndex)
+        {
+            UMaterialInterface* Material = Primitive->GetMaterial(MaterialIndex);
+            if (!Material)
+            {
+                continue;
+            }
+
+            UsedTextures.Reset();
+            Material->GetUsedTextures(UsedTextures, EMaterialQualityLevel::Num, true, GMaxRHIFeatureLevel, true);
+            for (UTexture* Texture : UsedTextures)
+            {
+                if (FEntry* Entry = Entries.Find(Cast<UTexture2D>(Texture)))
+                {
+                    Entry->Users.AddUnique(Primitive);
+                }
+            }
+        }
+    }
+}
+
+void FDSTextureStreamer::Update(const FDSTextureStreamingView& View)
+{
+    check(IsInGameThread());
+
+    // Textures destroyed by a reimport no longer need streaming
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (!It->Value.Texture.IsValid() || !It->Value.Texture->GetPlatformData())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    int64 WantedSize = 0;
+    for (TPair<TWeakObjectPtr<UTexture2D>, FEntry>& Pair : Entries)
+    {
+        FEntry& Entry = Pair.Value;
+        Entry.WantedMips = ComputeWantedMips(Entry, View);
+        WantedSize += GetSizeOfMips(Entry, Entry.WantedMips);
+    }
+
+    // Over budget: drop one more mip from every texture until the demand fits or nothing can be dropped
+    bool bCanDrop = true;
+    while (WantedSize > Settings.PoolSize && bCanDrop)
+    {
+        bCanDrop = false;
+        for (TPair<TWeakObjectPtr<UTexture2D>, FEntry>& Pair : Entries)
+        {
+            FEntry& Entry = Pair.Value;
+            if (Entry.WantedMips > GetMipsForDimension(Entry, Settings.MinResidentSize))
+            {
+                WantedSize -= Entry.MipSizes[Entry.MipSizes.Num() - Entry.WantedMips];
+                --Entry.WantedMips;
+                bCanDrop = true;
+            }
+        }
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    TArray<FEntry*> StreamIn;
+    TArray<FEntry*> StreamOut;
+
+    for (TPair<TWeakObjectPtr<UTexture2D>, FEntry>& Pair : Entries)
+    {
+        FEntry& Entry = Pair.Value;
+        if (Entry.WantedMips >= Entry.ResidentMips)
+        {
+            Entry.LastNeededTime = Now;
+        }
+
+        if (Entry.WantedMips > Entry.ResidentMips && !Entry.bCacheMissing)
+        {
+            if (Entry.LoadedChain.IsValid())
+            {
+                StreamIn.Add(&Entry);
+            }
+            else if (!Entry.bLoadInFlight)
+            {
+                RequestLoad(Entry);
+            }
+        }
+        else
+        {
+            // The view moved away before the load finished
+            Entry.LoadedChain.Reset();
+
+            if (Entry.WantedMips < Entry.ResidentMips && Now - Entry.LastNeededTime > Settings.DropDelay)
+            {
+                StreamOut.Add(&Entry);
+            }
+        }
+    }
+
+    if (StreamIn.Num() == 0 && StreamOut.Num() == 0)
+    {
+        return;
+    }
+
+    // Largest deficits first so the most visibly blurry textures sharpen first
+    StreamIn.Sort([](const FEntry& A, const FEntry& B)
+    {
+        return A.WantedMips - A.ResidentMips > B.WantedMips - B.ResidentMips;
+    });
+
+    TArray<FEntry*> Batch;
+    for (FEntry* Entry : StreamIn)
+    {
+        if (Batch.Num() < Settings.MaxUpdatesPerTick)
+        {
+            Batch.Add(Entry);
+        }
+    }
+    for (FEntry* Entry : StreamOut)
+    {
+        if (Batch.Num() < Settings.MaxUpdatesPerTick)
+        {
+            Batch.Add(Entry);
+        }
+    }
+
+    // One flush for the whole batch before the mips are rewritten
+    for (FEntry* Entry : Batch)
+    {
+        Entry->Texture->ReleaseResource();
+    }
+    FlushRenderingCommands();
+
+    int32 NumStreamedIn = 0;
+    int32 NumStreamedOut = 0;
+    for (FEntry* Entry : Batch)
+    {
+        UTexture2D* Texture = Entry->Texture.Get();
+        const int32 NumMips = Entry->MipSizes.Num();
+
+        if (Entry->LoadedChain.IsValid())
+        {
+            FDSTextureCompressionPass::WriteMips(Texture, *Entry->LoadedChain, NumMips - Entry->WantedMips);
+            Entry->LoadedChain.Reset();
+            ++NumStreamedIn;
+        }
+        else
+        {
+            FTexturePlatformData* PlatformData = Texture->GetPlatformData();
+            PlatformData->Mips.RemoveAt(0, Entry->ResidentMips - Entry->WantedMips);
+            PlatformData->SizeX = PlatformData->Mips[0].SizeX;
+            PlatformData->SizeY = PlatformData->Mips[0].SizeY;
+            ++NumStreamedOut;
+        }
+
+        Entry->ResidentMips = Entry->WantedMips;
+        Texture->UpdateResource();
+    }
+
+    UE_LOG(LogDSTextureStreamer, Verbose, TEXT("Streamed in %d and out %d textures, %.1f MB resident"),
+           NumStreamedIn, NumStreamedOut, GetResidentSize() / (1024.0 * 1024.0));
+}
+
+int32 FDSTextureStreamer::RestoreFullMips()
+{
+    check(IsInGameThread());
+    DS_TRACE_SCOPE(FDSTextureStreamer::RestoreFullMips);
+
+    TArray<FEntry*> Batch;
+    for (TPair<TWeakObjectPtr<UTexture2D>, FEntry>& Pair : Entries)
+    {
+        FEntry& Entry = Pair.Value;
+        if (!Entry.Texture.IsValid() || !Entry.Texture->GetPlatformData() || Entry.ResidentMips >= Entry.MipSizes.Num())
+        {
+            continue;
+        }
+
+        // Chains loaded for the view are reused, the others are read now since there is no later update to wait for
+        if (!Entry.LoadedChain.IsValid())
+        {
+            TSharedPtr<FDSCompressedTexture, ESPMode::ThreadSafe> Chain = MakeShared<FDSCompressedTexture, ESPMode::ThreadSafe>();
+            if (!FDSTextureCompressor::LoadFromCache(Entry.CacheKey, *Chain) || Chain->Mips.Num() != Entry.MipSizes.Num())
+            {
+                UE_LOG(LogDSTextureStreamer, Warning, TEXT("Texture cache entry for %s is missing, it stays at %d mips"), *GetNameSafe(Entry.Texture.Get()), Entry.ResidentMips);
+                continue;
+            }
+            Entry.LoadedChain = Chain;
+        }
+        Batch.Add(&Entry);
+    }
+
+    if (Batch.Num() == 0)
+    {
+        return 0;
+    }
+
+    // One flush for the whole batch before the mips are rewritten
+    for (FEntry* Entry : Batch)
+    {
+        Entry->Texture->ReleaseResource();
+    }
+    FlushRenderingCommands();
+
+    for (FEntry* Entry : Batch)
+    {
+        FDSTextureCompressionPass::WriteMips(Entry->Texture.Get(), *Entry->LoadedChain, 0);
+        Entry->LoadedChain.Reset();
+        Entry->ResidentMips = Entry->MipSizes.Num();
+        Entry->Texture->UpdateResource();
+    }
+
+    UE_LOG(LogDSTextureStreamer, Log, TEXT("Restored the full mip chains of %d textures"), Batch.Num());
+    return Batch.Num();
+}
+
+int64 FDSTextureStreamer::GetResidentSize() const
+{
+    int64 ResidentSize = 0;
+    for (const TPair<TWeakObjectPtr<UTexture2D>, FEntry>& Pair : Entries)
+    {
+        ResidentSize += GetSizeOfMips(Pair.Value, Pair.Value.ResidentMips);
+    }
+    return ResidentSize;
+}
+
+int32 FDSTextureStreamer::ComputeWantedMips(const FEntry& Entry, const FDSTextureStreamingView& View) const
+{
+    // Pixels covered per unit of bounds size at unit distance
+    const float ScreenScale = View.ViewportHeight * 0.5f / FMath::Tan(FMath::DegreesToRadians(FMath::Max(View.FOVDegrees, 1.0f)) * 0.5f);
+
+    float WantedDimension = 0.0f;
+    for (const TWeakObjectPtr<UPrimitiveComponent>& User : Entry.Users)
+    {
+        const UPrimitiveComponent* Primitive = User.Get();
+        if (!Primitive || !Primitive->IsRegistered())
+        {
+            continue;
+        }
+
+        // Assumes the texture spans the component once, which holds for most CAD material mappings
+        const FBoxSphereBounds& Bounds = Primitive->Bounds;
+        const float Distance = FMath::Max(FVector::Dist(View.Origin, Bounds.Origin) - Bounds.SphereRadius, 1.0f);
+        const float ScreenPixels = 2.0f * Bounds.SphereRadius / Distance * ScreenScale;
+        WantedDimension = FMath::Max(WantedDimension, ScreenPixels * Settings.TexelsPerPixel);
+    }
+
+    return GetMipsForDimension(Entry, FMath::Max(FMath::CeilToInt(WantedDimension), Settings.MinResidentSize));
+}
+
+int32 FDSTextureStreamer::GetMipsForDimension(const FEntry& Entry, int32 Dimension)
+{
+    const int32 NumMips = Entry.MipSizes.Num();
+
+    int32 FirstMip = 0;
+    while (FirstMip + 1 < NumMips && (Entry.MaxDimension >> (FirstMip + 1)) >= Dimension)
+    {
+        ++FirstMip;
+    }
+
+    return NumMips - FirstMip;
+}
+
+int64 FDSTextureStreamer::GetSizeOfMips(const FEntry& Entry, int32 NumMips)
+{
+    int64 Size = 0;
+    for (int32 MipIndex = Entry.MipSizes.Num() - NumMips; MipIndex < Entry.MipSizes.Num(); ++MipIndex)
+    {
+        Size += Entry.MipSizes[MipIndex];
+    }
+    return Size;
+}
+
+void FDSTextureStreamer::RequestLoad(FEntry& Entry)
+{
+    Entry.bLoadInFlight = true;
+
+    TWeakPtr<FDSTextureStreamer, ESPMode::ThreadSafe> WeakThis = AsShared();
+    TWeakObjectPtr<UTexture2D> Texture = Entry.Texture;
+    const uint64 CacheKey = Entry.CacheKey;
+    const int32 ExpectedMips = Entry.MipSizes.Num();
+
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, Texture, CacheKey, ExpectedMips]()
+    {
+        TSharedPtr<FDSCompressedTexture, ESPMode::ThreadSafe> Chain = MakeShared<FDSCompressedTexture, ESPMode::ThreadSafe>();
+        const bool bLoaded = FDSTextureCompressor::LoadFromCache(CacheKey, *Chain) && Chain->Mips.Num() == ExpectedMips;
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Texture, Chain, bLoaded]()
+        {
+            TSharedPtr<FDSTextureStreamer, ESPMode::ThreadSafe> This = WeakThis.Pin();
+            FEntry* Entry = This.IsValid() ? This->Entries.Find(Texture) : nullptr;
+            if (!Entry)
+            {
+                return;
+            }
+
+            Entry->bLoadInFlight = false;
+            if (bLoaded)
+            {
+                Entry->LoadedChain = Chain;
+            }
+            else
+            {
+                UE_LOG(LogDSTextureStreamer, Warning, TEXT("Texture cache entry for %s is missing, keeping its resident mips"), *GetNameSafe(Texture.Get()));
+                Entry->bCacheMissing = true;
+            }
+        });
+    });
+}
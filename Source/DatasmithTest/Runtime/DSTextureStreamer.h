@@ -0,0 +1,158 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DSTextureCompressor.h"
+
+// Forward declarations
+class UPrimitiveComponent;
+class UTexture2D;
+
+/**
+ * Tunables of the runtime texture streamer
+ */
+struct FDSTextureStreamingSettings
+{
+    /** Memory budget for all streamed textures, in bytes */
+    int64 PoolSize = 512ll * 1024 * 1024;
+
+    /** Smallest top mip dimension that always stays resident */
+    int32 MinResidentSize = 64;
+
+    /** Texels wanted per on-screen pixel of a component's bounds */
+    float TexelsPerPixel = 1.0f;
+
+    /** Time a mip must be unneeded before it is dropped, avoids thrashing at view distance boundaries */
+    float DropDelay = 5.0f;
+
+    /** Maximum number of textures rewritten per update, bounds the render flush cost */
+    int32 MaxUpdatesPerTick = 8;
+};
+
+/**
+ * Camera description used to compute mip demand
+ */
+struct FDSTextureStreamingView
+{
+    FVector Origin = FVector::ZeroVector;
+    float FOVDegrees = 90.0f;
+    float ViewportHeight = 1080.0f;
+};
+
+/**
+ * FDSTextureStreamer - Keeps only the mips needed by the current view resident for imported textures
+ *
+ * Runtime textures have no cooked bulk data, so the engine streamer cannot page them. Once a
+ * texture has been block compressed, its full chain lives in the compression cache; the
+ * streamer drops top mips of textures that are small or far away on screen and reloads them
+ * from the cache file on a background thread when they are needed again.
+ */
+class DATASMITHTEST_API FDSTextureStreamer : public TSharedFromThis<FDSTextureStreamer, ESPMode::ThreadSafe>
+{
+public:
+    explicit FDSTextureStreamer(const FDSTextureStreamingSettings& InSettings);
+
+    /**
+     * Starts streaming a texture whose full compressed chain is currently resident
+     * @param Texture Texture to stream
+     * @param CacheKey Content hash of the compressed chain in the texture cache
+     */
+    void Register(UTexture2D* Texture, uint64 CacheKey);
+
+    /**
+     * Rebuilds which components use which streamed texture, call after every import
+     * @param Primitives Imported components whose materials are scanned
+     */
+    void SetPrimitives(const TArray<UPrimitiveComponent*>& Primitives);
+
+    /**
+     * Computes mip demand for the view and streams mips in or out, must run on the game thread
+     * @param View Camera the demand is computed for
+     */
+    void Update(const FDSTextureStreamingView& View);
+
+    /**
+     * Brings every streamed texture back to its full mip chain, reading it from the cache on the
+     * calling thread; used before the streamer is dropped so no texture stays at reduced resolution
+     * @return Number of textures restored
+     */
+    int32 RestoreFullMips();
+
+    /**
+     * Updates the tunables, takes effect on the next update
+     */
+    void SetSettings(const FDSTextureStreamingSettings& InSettings) { Settings = InSettings; }
+
+    /**
+     * Gets the number of textures being streamed
+     */
+    int32 GetNumTextures() const { return Entries.Num(); }
+
+    /**
+     * Gets the size of all resident mips of streamed textures in bytes
+     */
+    int64 GetResidentSize() const;
+
+private:
+    struct FEntry
+    {
+        TWeakObjectPtr<UTexture2D> Texture;
+        uint64 CacheKey = 0;
+
+        /** Size of each mip of the full chain, largest first */
+        TArray<int64> MipSizes;
+
+        /** Dimension of the largest mip of the full chain */
+        int32 MaxDimension = 0;
+
+        int32 ResidentMips = 0;
+        int32 WantedMips = 0;
+
+        /** Last time the resident mips were all needed */
+        double LastNeededTime = 0.0;
+
+        bool bLoadInFlight = false;
+
+        /** Set when the cache file could not be read, the texture then keeps its resident mips */
+        bool bCacheMissing = false;
+
+        /** Full chain loaded from the cache, waiting to be uploaded */
+        TSharedPtr<FDSCompressedTexture, ESPMode::ThreadSafe> LoadedChain;
+
+        /** Components whose materials use this texture */
+        TArray<TWeakObjectPtr<UPrimitiveComponent>> Users;
+    };
+
+    /**
+     * Computes how many mips a texture needs for the view
+     */
+    int32 ComputeWantedMips(const FEntry& Entry, const FDSTextureStreamingView& View) const;
+
+    /**
+     * Gets the number of mips to keep resident so the top mip is at least the given dimension
+     */
+    static int32 GetMipsForDimension(const FEntry& Entry, int32 Dimension);
+
+    /**
+     * Gets the size of the smallest mips of a texture
+     */
+    static int64 GetSizeOfMips(const FEntry& Entry, int32 NumMips);
+
+    /**
+     * Loads the full chain of a texture from the cache on a background thread
+     */
+    void RequestLoad(FEntry& Entry);
+
+    FDSTextureStreamingSettings Settings;
+    TMap<TWeakObjectPtr<UTexture2D>, FEntry> Entries;
+};
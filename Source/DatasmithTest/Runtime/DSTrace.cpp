@@ -0,0 +1,43 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(DSChannel);
+
+CSV_DEFINE_CATEGORY_MODULE(DATASMITHTEST_API, DSImport, true);
+CSV_DEFINE_CATEGORY_MODULE(DATASMITHTEST_API, DSLightSync, true);
+CSV_DEFINE_CATEGORY_MODULE(DATASMITHTEST_API, DSUI, true);
+
+void FDSTrace::BeginRegion(const FString& Name)
+{
+    check(IsInGameThread());
+
+    if (UE_TRACE_CHANNELEXPR_IS_ENABLED(DSChannel))
+    {
+        TRACE_BEGIN_REGION(*Name);
+    }
+
+    CSV_EVENT(DSImport, TEXT("Begin %s"), *Name);
+}
+
+void FDSTrace::EndRegion(const FString& Name)
+{
+    check(IsInGameThread());
+
+    if (UE_TRACE_CHANNELEXPR_IS_ENABLED(DSChannel))
+    {
+        TRACE_END_REGION(*Name);
+    }
+
+    CSV_EVENT(DSImport, TEXT("End %s"), *Name);
+}
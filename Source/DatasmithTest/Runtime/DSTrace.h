@@ -0,0 +1,61 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+/**
+ * Trace channel of the DS subsystems, enabled with -trace=default,ds or Trace.Enable ds.
+ * Timing scopes and import regions are only emitted while it is on.
+ */
+UE_TRACE_CHANNEL_EXTERN(DSChannel, DATASMITHTEST_API);
+
+/** CSV categories: per-frame import state, per-frame light sync state, and UI actions as events */
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(DATASMITHTEST_API, DSImport);
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(DATASMITHTEST_API, DSLightSync);
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(DATASMITHTEST_API, DSUI);
+
+/** Timing scope on the DS channel, named after an identifier like TRACE_CPUPROFILER_EVENT_SCOPE */
+#define DS_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, DSChannel)
+
+/**
+ * Timing scope on the DS channel for an operation triggered from the UI, also recorded as a CSV event.
+ * Goes after the handler's guards, so values set by the widget itself are not recorded as user actions.
+ */
+#define DS_TRACE_UI_ACTION(Name) \
+    CSV_EVENT(DSUI, TEXT(PREPROCESSOR_TO_STRING(Name))); \
+    DS_TRACE_SCOPE(Name)
+
+/**
+ * FDSTrace - Timeline regions for work spanning several frames
+ *
+ * Imports, DirectLink updates and the passes after them run over many frames, so they cannot be
+ * CPU scopes. They are emitted as trace regions instead, shown as bars above the frame timeline
+ * in Unreal Insights, and as CSV events, so hitches in either capture can be matched to the import
+ * or update in flight. Game thread only.
+ */
+class DATASMITHTEST_API FDSTrace
+{
+public:
+    /**
+     * Begins a region; regions are matched by name, so it must be unique while open
+     */
+    static void BeginRegion(const FString& Name);
+
+    /**
+     * Ends a region begun with the same name
+     */
+    static void EndRegion(const FString& Name);
+};
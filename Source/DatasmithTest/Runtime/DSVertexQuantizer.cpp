@@ -0,0 +1,224 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSVertexQuantizer.h"
+#include "DSStaticMeshRebuild.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+#include "PackedNormal.h"
+
+// Logging category for the vertex quantizer
+DEFINE_LOG_CATEGORY_STATIC(LogDSVertexQuantizer, Log, All);
+
+namespace DSVertexQuantizer
+{
+    // Quantization may use at most this fraction of the tessellation tolerances,
+    // so it never becomes the dominant source of error
+    static constexpr float ToleranceFraction = 0.5f;
+}
+
+void FDSVertexQuantizationReport::Log() const
+{
+    UE_LOG(LogDSVertexQuantizer, Log, TEXT("=== Vertex Quantization Report ==="));
+    UE_LOG(LogDSVertexQuantizer, Log, TEXT("Meshes: %d, LODs quantized: %d, LODs without CPU data: %d"),
+           NumMeshes, NumLODsQuantized, NumLODsWithoutCPUData);
+    UE_LOG(LogDSVertexQuantizer, Log, TEXT("Kept full precision UVs: %d LODs, high precision tangents: %d LODs"),
+           NumUVsKeptFullPrecision, NumTangentsKeptHighPrecision);
+    UE_LOG(LogDSVertexQuantizer, Log, TEXT("Vertex attributes: %.2f MB -> %.2f MB (saved %.2f MB)"),
+           BytesBefore / (1024.0 * 1024.0), BytesAfter / (1024.0 * 1024.0), (BytesBefore - BytesAfter) / (1024.0 * 1024.0));
+}
+
+FDSVertexQuantizer::FDSVertexQuantizer(float InChordTolerance, float InNormalTolerance)
+    : ChordTolerance(InChordTolerance)
+    , NormalTolerance(InNormalTolerance)
+{
+}
+
+FDSVertexQuantizationReport FDSVertexQuantizer::Apply(const TArray<UPrimitiveComponent*>& Primitives) const
+{
+    FDSVertexQuantizationReport Report;
+
+    TArray<UStaticMesh*> Meshes;
+    FDSStaticMeshRebuild::GatherStaticMeshes(Primitives, Meshes);
+    Report.NumMeshes = Meshes.Num();
+
+    // Decide per LOD up front so only meshes that actually change get their resources recreated
+    struct FLODDecision
+    {
+        bool bHalfUVs = false;
+        bool bLowPrecisionTangents = false;
+        bool bChanged = false;
+    };
+
+    TMap<UStaticMesh*, TArray<FLODDecision>> Decisions;
+    TArray<UStaticMesh*> MeshesToModify;
+
+    for (UStaticMesh* StaticMesh : Meshes)
+    {
+        FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+        TArray<FLODDecision>& LODDecisions = Decisions.Add(StaticMesh);
+        LODDecisions.SetNum(RenderData->LODResources.Num());
+
+        bool bMeshChanged = false;
+        for (int32 LODIndex = 0; LODIndex < RenderData->LODResources.Num(); ++LODIndex)
+        {
+            const FStaticMeshLODResources& LOD = RenderData->LODResources[LODIndex];
+            if (!FDSStaticMeshRebuild::HasCPUData(LOD))
+            {
+                ++Report.NumLODsWithoutCPUData;
+                continue;
+            }
+
+            // Never raise precision again, a previous pass already validated the lower one
+            const FStaticMeshVertexBuffer& VertexBuffer = LOD.VertexBuffers.StaticMeshVertexBuffer;
+            FLODDecision& Decision = LODDecisions[LODIndex];
+            Decision.bHalfUVs = !VertexBuffer.GetUseFullPrecisionUVs() || CanUseHalfUVs(LOD);
+            Decision.bLowPrecisionTangents = !VertexBuffer.GetUseHighPrecisionTangentBasis() || CanUseLowPrecisionTangents(LOD);
+            Decision.bChanged = (Decision.bHalfUVs && VertexBuffer.GetUseFullPrecisionUVs())
+                             || (Decision.bLowPrecisionTangents && VertexBuffer.GetUseHighPrecisionTangentBasis());
+
+            Report.NumUVsKeptFullPrecision += Decision.bHalfUVs ? 0 : 1;
+            Report.NumTangentsKeptHighPrecision += Decision.bLowPrecisionTangents ? 0 : 1;
+            bMeshChanged |= Decision.bChanged;
+        }
+
+        if (bMeshChanged)
+        {
+            MeshesToModify.Add(StaticMesh);
+        }
+    }
+
+    FDSStaticMeshRebuild::Modify(MeshesToModify, [&Decisions, &Report](UStaticMesh& StaticMesh, FStaticMeshRenderData& RenderData)
+    {
+        const TArray<FLODDecision>& LODDecisions = Decisions.FindChecked(&StaticMesh);
+        for (int32 LODIndex = 0; LODIndex < RenderData.LODResources.Num(); ++LODIndex)
+        {
+            const FLODDecision& Decision = LODDecisions[LODIndex];
+            if (!Decision.bChanged)
+            {
+                continue;
+            }
+
+            FStaticMeshLODResources& LOD = RenderData.LODResources[LODIndex];
+            Report.BytesBefore += GetAttributeSize(LOD);
+            Requantize(LOD, Decision.bHalfUVs, Decision.bLowPrecisionTangents);
+            Report.BytesAfter += GetAttributeSize(LOD);
+            ++Report.NumLODsQuantized;
+        }
+    });
+
+    return Report;
+}
+
+bool FDSVertexQuantizer::CanUseHalfUVs(const FStaticMeshLODResources& LOD) const
+{
+    const FStaticMeshVertexBuffer& VertexBuffer = LOD.VertexBuffers.StaticMeshVertexBuffer;
+    const FPositionVertexBuffer& PositionBuffer = LOD.VertexBuffers.PositionVertexBuffer;
+    const uint32 NumVertices = VertexBuffer.GetNumVertices();
+    const uint32 NumTexCoords = VertexBuffer.GetNumTexCoords();
+    if (NumVertices == 0 || NumTexCoords == 0)
+    {
+        return true;
+    }
+
+    FBox3f PositionBounds(ForceInit);
+    for (uint32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+    {
+        PositionBounds += PositionBuffer.VertexPosition(VertexIndex);
+    }
+
+    for (uint32 UVIndex = 0; UVIndex < NumTexCoords; ++UVIndex)
+    {
+        FBox2f UVBounds(ForceInit);
+        float MaxUVError = 0.0f;
+        for (uint32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+        {
+            const FVector2f UV = VertexBuffer.GetVertexUV(VertexIndex, UVIndex);
+            const FVector2f Quantized(FFloat16(UV.X).GetFloat(), FFloat16(UV.Y).GetFloat());
+            UVBounds += UV;
+            MaxUVError = FMath::Max(MaxUVError, (UV - Quantized).GetAbsMax());
+        }
+
+        // World distance covered by one UV unit, estimated from the mesh and UV extents
+        const float UVExtent = FMath::Max(UVBounds.GetSize().GetMax(), UE_KINDA_SMALL_NUMBER);
+        const float WorldPerUV = PositionBounds.GetSize().GetMax() / UVExtent;
+
+        if (MaxUVError * WorldPerUV > ChordTolerance * DSVertexQuantizer::ToleranceFraction)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool FDSVertexQuantizer::CanUseLowPrecisionTangents(const FStaticMeshLODResources& LOD) const
+{
+    const FStaticMeshVertexBuffer& VertexBuffer = LOD.VertexBuffers.StaticMeshVertexBuffer;
+    const float MinCosine = FMath::Cos(FMath::DegreesToRadians(NormalTolerance * DSVertexQuantizer::ToleranceFraction));
+
+    for (uint32 VertexIndex = 0; VertexIndex < VertexBuffer.GetNumVertices(); ++VertexIndex)
+    {
+        const FVector3f Normal = FVector3f(VertexBuffer.VertexTangentZ(VertexIndex)).GetSafeNormal();
+        const FVector3f Quantized = FPackedNormal(Normal).ToFVector3f().GetSafeNormal();
+        if (FVector3f::DotProduct(Normal, Quantized) < MinCosine)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void FDSVertexQuantizer::Requantize(FStaticMeshLODResources& LOD, bool bHalfUVs, bool bLowPrecisionTangents)
+{
+    FStaticMeshVertexBuffer& VertexBuffer = LOD.VertexBuffers.StaticMeshVertexBuffer;
+    const uint32 NumVertices = VertexBuffer.GetNumVertices();
+    const uint32 NumTexCoords = VertexBuffer.GetNumTexCoords();
+
+    TArray<FVector3f> TangentX, TangentY, TangentZ;
+    TArray<FVector2f> UVs;
+    TangentX.SetNumUninitialized(NumVertices);
+    TangentY.SetNumUninitialized(NumVertices);
+    TangentZ.SetNumUninitialized(NumVertices);
+    UVs.SetNumUninitialized(NumVertices * NumTexCoords);
+
+    for (uint32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+    {
+        TangentX[VertexIndex] = FVector3f(VertexBuffer.VertexTangentX(VertexIndex));
+        TangentY[VertexIndex] = VertexBuffer.VertexTangentY(VertexIndex);
+        TangentZ[VertexIndex] = FVector3f(VertexBuffer.VertexTangentZ(VertexIndex));
+        for (uint32 UVIndex = 0; UVIndex < NumTexCoords; ++UVIndex)
+        {
+            UVs[VertexIndex * NumTexCoords + UVIndex] = VertexBuffer.GetVertexUV(VertexIndex, UVIndex);
+        }
+    }
+
+    // Reallocating after changing the precision flags gives the buffer its new layout
+    VertexBuffer.SetUseFullPrecisionUVs(!bHalfUVs);
+    VertexBuffer.SetUseHighPrecisionTangentBasis(!bLowPrecisionTangents);
+    VertexBuffer.Init(NumVertices, NumTexCoords, true);
+
+    for (uint32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+    {
+        VertexBuffer.SetVertexTangents(VertexIndex, TangentX[VertexIndex], TangentY[VertexIndex], TangentZ[VertexIndex]);
+        for (uint32 UVIndex = 0; UVIndex < NumTexCoords; ++UVIndex)
+        {
+            VertexBuffer.SetVertexUV(VertexIndex, UVIndex, UVs[VertexIndex * NumTexCoords + UVIndex]);
+        }
+    }
+}
+
+int64 FDSVertexQuantizer::GetAttributeSize(const FStaticMeshLODResources& LOD)
+{
+    const FStaticMeshVertexBuffer& VertexBuffer = LOD.VertexBuffers.StaticMeshVertexBuffer;
+    return (int64)VertexBuffer.GetTangentSize() + VertexBuffer.GetTexCoordSize();
+}
@@ -0,0 +1,92 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class UPrimitiveComponent;
+struct FStaticMeshLODResources;
+
+/**
+ * Summary of a vertex quantization pass
+ */
+struct FDSVertexQuantizationReport
+{
+    int32 NumMeshes = 0;
+    int32 NumLODsQuantized = 0;
+    int32 NumLODsWithoutCPUData = 0;
+
+    /** LODs kept at full precision because quantizing would exceed the tessellation tolerances */
+    int32 NumUVsKeptFullPrecision = 0;
+    int32 NumTangentsKeptHighPrecision = 0;
+
+    int64 BytesBefore = 0;
+    int64 BytesAfter = 0;
+
+    /**
+     * Writes the report to the log
+     */
+    void Log() const;
+};
+
+/**
+ * FDSVertexQuantizer - Stores imported mesh attributes at reduced precision
+ *
+ * Tessellated CAD surfaces are only accurate to the chord and normal tolerances they were built
+ * with, so their vertex attributes do not need full float precision. The quantizer switches
+ * texture coordinates to half floats and the tangent frame to 8-bit packed normals when the
+ * measured quantization error stays below a fraction of those tolerances.
+ *
+ * Positions stay in full precision: the local vertex factory used by static meshes only reads
+ * float3 positions, so bounds-relative 16-bit positions would need a custom vertex factory.
+ */
+class DATASMITHTEST_API FDSVertexQuantizer
+{
+public:
+    /**
+     * @param InChordTolerance Tessellation chord tolerance (cm), bounds the world space texture coordinate error
+     * @param InNormalTolerance Tessellation normal tolerance (degrees), bounds the tangent frame error
+     */
+    FDSVertexQuantizer(float InChordTolerance, float InNormalTolerance);
+
+    /**
+     * Quantizes the static meshes used by the given primitives, must run on the game thread
+     * @param Primitives Imported components
+     * @return Report with memory savings
+     */
+    FDSVertexQuantizationReport Apply(const TArray<UPrimitiveComponent*>& Primitives) const;
+
+private:
+    /**
+     * Checks whether half precision texture coordinates stay within the chord tolerance
+     */
+    bool CanUseHalfUVs(const FStaticMeshLODResources& LOD) const;
+
+    /**
+     * Checks whether 8-bit tangents stay within the normal tolerance
+     */
+    bool CanUseLowPrecisionTangents(const FStaticMeshLODResources& LOD) const;
+
+    /**
+     * Rewrites the tangent and texture coordinate buffer with the given precisions
+     */
+    static void Requantize(FStaticMeshLODResources& LOD, bool bHalfUVs, bool bLowPrecisionTangents);
+
+    /**
+     * Gets the size of the tangent and texture coordinate data of a LOD
+     */
+    static int64 GetAttributeSize(const FStaticMeshLODResources& LOD);
+
+    float ChordTolerance;
+    float NormalTolerance;
+};
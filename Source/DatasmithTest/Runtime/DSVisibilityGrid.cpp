@@ -0,0 +1,379 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#include "DSVisibilityGrid.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/Crc.h"
+#include "Serialization/Archive.h"
+
+// Logging category for the visibility grid
+DEFINE_LOG_CATEGORY_STATIC(LogDSVisibilityGrid, Log, All);
+
+namespace DSVisibilityGrid
+{
+    // File identification for the on-disk cache
+    static constexpr uint32 CacheMagic = 0x44535647; // 'DSVG'
+    static constexpr int32 CacheVersion = 1;
+
+    // Sample points inside a cell, as fractions of the cell half-extent
+    static const FVector SampleOffsets[] =
+    {
+        FVector(0.0f, 0.0f, 0.0f),
+        FVector(-0.6f, -0.6f, -0.6f),
+        FVector(0.6f, -0.6f, -0.6f),
+        FVector(-0.6f, 0.6f, -0.6f),
+        FVector(0.6f, 0.6f, -0.6f),
+        FVector(-0.6f, -0.6f, 0.6f),
+        FVector(0.6f, -0.6f, 0.6f),
+        FVector(-0.6f, 0.6f, 0.6f),
+        FVector(0.6f, 0.6f, 0.6f)
+    };
+
+    /**
+     * Returns true if the box is thin along one axis and wide along the two others
+     */
+    static bool IsSlabOccluder(const FBox& Box, const FDSVisibilityGridSettings& Settings)
+    {
+        const FVector Size = Box.GetSize();
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            const float OtherA = Size[(Axis + 1) % 3];
+            const float OtherB = Size[(Axis + 2) % 3];
+            if (Size[Axis] <= Settings.OccluderMaxThickness && OtherA >= Settings.OccluderMinSpan && OtherB >= Settings.OccluderMinSpan)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+TSharedPtr<FDSVisibilityGrid, ESPMode::ThreadSafe> FDSVisibilityGrid::Build(const TArray<FBox>& ComponentBounds, const FDSVisibilityGridSettings& Settings)
+{
+    FBox SceneBounds(ForceInit);
+    for (const FBox& Bounds : ComponentBounds)
+    {
+        if (Bounds.IsValid)
+        {
+            SceneBounds += Bounds;
+        }
+    }
+
+    if (!SceneBounds.IsValid || ComponentBounds.Num() == 0)
+    {
+        UE_LOG(LogDSVisibilityGrid, Warning, TEXT("Cannot build visibility grid - no valid component bounds"));
+        return nullptr;
+    }
+
+    TSharedPtr<FDSVisibilityGrid, ESPMode::ThreadSafe> Grid = MakeShared<FDSVisibilityGrid, ESPMode::ThreadSafe>();
+    Grid->NumComponents = ComponentBounds.Num();
+    Grid->SceneHash = ComputeSceneHash(ComponentBounds, Settings);
+    Grid->GridBounds = SceneBounds.ExpandBy(1.0f);
+
+    // Grow the cell size until the grid respects the cell budget
+    const FVector GridSize = Grid->GridBounds.GetSize();
+    float CellSize = FMath::Max(Settings.CellSize, 1.0f);
+    FIntVector Dimensions;
+    for (;;)
+    {
+        Dimensions = FIntVector(
+            FMath::Max(1, FMath::CeilToInt(GridSize.X / CellSize)),
+            FMath::Max(1, FMath::CeilToInt(GridSize.Y / CellSize)),
+            FMath::Max(1, FMath::CeilToInt(GridSize.Z / CellSize)));
+
+        const int64 CellCount = (int64)Dimensions.X * Dimensions.Y * Dimensions.Z;
+        if (CellCount <= FMath::Max(Settings.MaxCells, 1))
+        {
+            break;
+        }
+        CellSize *= 1.25f;
+    }
+
+    Grid->Dimensions = Dimensions;
+    Grid->CellExtent = FVector(GridSize.X / Dimensions.X, GridSize.Y / Dimensions.Y, GridSize.Z / Dimensions.Z);
+
+    const int32 NumCells = Dimensions.X * Dimensions.Y * Dimensions.Z;
+
+    // Register components and occluders in every cell their bounds overlap
+    TArray<TBitArray<>> CellComponents;
+    CellComponents.Init(TBitArray<>(false, Grid->NumComponents), NumCells);
+
+    TArray<FBox> Occluders;
+    TArray<TArray<int32>> CellOccluders;
+    CellOccluders.SetNum(NumCells);
+
+    for (int32 ComponentIndex = 0; ComponentIndex < ComponentBounds.Num(); ++ComponentIndex)
+    {
+        const FBox& Bounds = ComponentBounds[ComponentIndex];
+        if (!Bounds.IsValid)
+        {
+            continue;
+        }
+
+        const FVector MinLocal = (Bounds.Min - Grid->GridBounds.Min) / Grid->CellExtent;
+        const FVector MaxLocal = (Bounds.Max - Grid->GridBounds.Min) / Grid->CellExtent;
+        const FIntVector MinCoords(
+            FMath::Clamp(FMath::FloorToInt(MinLocal.X), 0, Dimensions.X - 1),
+            FMath::Clamp(FMath::FloorToInt(MinLocal.Y), 0, Dimensions.Y - 1),
+            FMath::Clamp(FMath::FloorToInt(MinLocal.Z), 0, Dimensions.Z - 1));
+        const FIntVector MaxCoords(
+            FMath::Clamp(FMath::FloorToInt(MaxLocal.X), 0, Dimensions.X - 1),
+            FMath::Clamp(FMath::FloorToInt(MaxLocal.Y), 0, Dimensions.Y - 1),
+            FMath::Clamp(FMath::FloorToInt(MaxLocal.Z), 0, Dimensions.Z - 1));
+
+        const bool bIsOccluder = DSVisibilityGrid::IsSlabOccluder(Bounds, Settings);
+        const int32 OccluderIndex = bIsOccluder ? Occluders.Add(Bounds) : INDEX_NONE;
+
+        for (int32 Z = MinCoords.Z; Z <= MaxCoords.Z; ++Z)
+        {
+            for (int32 Y = MinCoords.Y; Y <= MaxCoords.Y; ++Y)
+            {
+                for (int32 X = MinCoords.X; X <= MaxCoords.X; ++X)
+                {
+                    const int32 CellIndex = Grid->GetCellIndex(FIntVector(X, Y, Z));
+                    CellComponents[CellIndex][ComponentIndex] = true;
+                    if (OccluderIndex != INDEX_NONE)
+                    {
+                        CellOccluders[CellIndex].Add(OccluderIndex);
+                    }
+                }
+            }
+        }
+    }
+
+    UE_LOG(LogDSVisibilityGrid, Log, TEXT("Building visibility grid: %dx%dx%d cells, %d components, %d occluders"),
+           Dimensions.X, Dimensions.Y, Dimensions.Z, Grid->NumComponents, Occluders.Num());
+
+    // Cell-to-cell visibility, each row only computes the upper triangle to halve the ray count
+    TArray<TBitArray<>> CellVisibility;
+    CellVisibility.Init(TBitArray<>(false, NumCells), NumCells);
+
+    ParallelFor(NumCells, [&Grid, &CellVisibility, &Occluders, &CellOccluders, NumCells](int32 CellA)
+    {
+        TBitArray<>& Row = CellVisibility[CellA];
+        Row[CellA] = true;
+
+        const FBox BoxA = Grid->GetCellBox(CellA);
+        const FIntVector CoordsA = Grid->GetCellCoords(CellA);
+
+        for (int32 CellB = CellA + 1; CellB < NumCells; ++CellB)
+        {
+            // Neighbouring cells always see each other
+            const FIntVector Delta = Grid->GetCellCoords(CellB) - CoordsA;
+            if (FMath::Abs(Delta.X) <= 1 && FMath::Abs(Delta.Y) <= 1 && FMath::Abs(Delta.Z) <= 1)
+            {
+                Row[CellB] = true;
+                continue;
+            }
+
+            const FBox BoxB = Grid->GetCellBox(CellB);
+            for (const FVector& Offset : DSVisibilityGrid::SampleOffsets)
+            {
+                const FVector Start = BoxA.GetCenter() + Offset * BoxA.GetExtent();
+                const FVector End = BoxB.GetCenter() + Offset * BoxB.GetExtent();
+                if (!Grid->IsSegmentOccluded(Start, End, Occluders, CellOccluders))
+                {
+                    Row[CellB] = true;
+                    break;
+                }
+            }
+        }
+    });
+
+    // Mirror the upper triangle so every row is complete
+    for (int32 CellA = 0; CellA < NumCells; ++CellA)
+    {
+        for (int32 CellB = CellA + 1; CellB < NumCells; ++CellB)
+        {
+            if (CellVisibility[CellA][CellB])
+            {
+                CellVisibility[CellB][CellA] = true;
+            }
+        }
+    }
+
+    // Collapse cell visibility into per-cell component sets
+    Grid->VisibleComponents.Init(TBitArray<>(false, Grid->NumComponents), NumCells);
+    ParallelFor(NumCells, [&Grid, &CellVisibility, &CellComponents, NumCells](int32 CellIndex)
+    {
+        TBitArray<>& Visible = Grid->VisibleComponents[CellIndex];
+        for (int32 OtherCell = 0; OtherCell < NumCells; ++OtherCell)
+        {
+            if (CellVisibility[CellIndex][OtherCell])
+            {
+                Visible.CombineWithBitwiseOR(CellComponents[OtherCell], EBitwiseOperatorFlags::MaintainSize);
+            }
+        }
+    });
+
+    return Grid;
+}
+
+uint32 FDSVisibilityGrid::ComputeSceneHash(const TArray<FBox>& ComponentBounds, const FDSVisibilityGridSettings& Settings)
+{
+    uint32 Hash = FCrc::MemCrc32(&Settings, sizeof(FDSVisibilityGridSettings));
+    for (const FBox& Bounds : ComponentBounds)
+    {
+        // Quantize to centimeters so float noise from the import does not invalidate the cache
+        const FIntVector Min(FMath::RoundToInt(Bounds.Min.X), FMath::RoundToInt(Bounds.Min.Y), FMath::RoundToInt(Bounds.Min.Z));
+        const FIntVector Max(FMath::RoundToInt(Bounds.Max.X), FMath::RoundToInt(Bounds.Max.Y), FMath::RoundToInt(Bounds.Max.Z));
+        Hash = FCrc::MemCrc32(&Min, sizeof(FIntVector), Hash);
+        Hash = FCrc::MemCrc32(&Max, sizeof(FIntVector), Hash);
+    }
+    return Hash;
+}
+
+TSharedPtr<FDSVisibilityGrid, ESPMode::ThreadSafe> FDSVisibilityGrid::LoadFromFile(const FString& FilePath, uint32 ExpectedSceneHash)
+{
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+    if (!Reader)
+    {
+        return nullptr;
+    }
+
+    uint32 Magic = 0;
+    int32 Version = 0;
+    uint32 StoredHash = 0;
+    *Reader << Magic;
+    *Reader << Version;
+    *Reader << StoredHash;
+
+    if (Magic != DSVisibilityGrid::CacheMagic || Version != DSVisibilityGrid::CacheVersion || StoredHash != ExpectedSceneHash)
+    {
+        UE_LOG(LogDSVisibilityGrid, Log, TEXT("Ignoring stale visibility cache: %s"), *FilePath);
+        return nullptr;
+    }
+
+    TSharedPtr<FDSVisibilityGrid, ESPMode::ThreadSafe> Grid = MakeShared<FDSVisibilityGrid, ESPMode::ThreadSafe>();
+    Grid->SceneHash = StoredHash;
+    *Reader << Grid->GridBounds;
+    *Reader << Grid->Dimensions;
+    *Reader << Grid->CellExtent;
+    *Reader << Grid->NumComponents;
+    *Reader << Grid->VisibleComponents;
+
+    if (Reader->IsError() || Grid->VisibleComponents.Num() != Grid->Dimensions.X * Grid->Dimensions.Y * Grid->Dimensions.Z)
+    {
+        UE_LOG(LogDSVisibilityGrid, Warning, TEXT("Visibility cache is corrupt: %s"), *FilePath);
+        return nullptr;
+    }
+
+    return Grid;
+}
+
+bool FDSVisibilityGrid::SaveToFile(const FString& FilePath) const
+{
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+    if (!Writer)
+    {
+        UE_LOG(LogDSVisibilityGrid, Warning, TEXT("Failed to open visibility cache for writing: %s"), *FilePath);
+        return false;
+    }
+
+    uint32 Magic = DSVisibilityGrid::CacheMagic;
+    int32 Version = DSVisibilityGrid::CacheVersion;
+    uint32 Hash = SceneHash;
+    FBox Bounds = GridBounds;
+    FIntVector Dims = Dimensions;
+    FVector Extent = CellExtent;
+    int32 Components = NumComponents;
+    TArray<TBitArray<>> Visible = VisibleComponents;
+
+    *Writer << Magic;
+    *Writer << Version;
+    *Writer << Hash;
+    *Writer << Bounds;
+    *Writer << Dims;
+    *Writer << Extent;
+    *Writer << Components;
+    *Writer << Visible;
+
+    return Writer->Close();
+}
+
+int32 FDSVisibilityGrid::GetCellIndex(const FVector& Location) const
+{
+    if (!GridBounds.IsInsideOrOn(Location))
+    {
+        return INDEX_NONE;
+    }
+
+    const FVector Local = (Location - GridBounds.Min) / CellExtent;
+    return GetCellIndex(FIntVector(
+        FMath::Clamp(FMath::FloorToInt(Local.X), 0, Dimensions.X - 1),
+        FMath::Clamp(FMath::FloorToInt(Local.Y), 0, Dimensions.Y - 1),
+        FMath::Clamp(FMath::FloorToInt(Local.Z), 0, Dimensions.Z - 1)));
+}
+
+bool FDSVisibilityGrid::IsComponentVisibleFromCell(int32 CellIndex, int32 ComponentIndex) const
+{
+    if (!VisibleComponents.IsValidIndex(CellIndex) || ComponentIndex < 0 || ComponentIndex >= NumComponents)
+    {
+        // Unknown cells or components are never culled
+        return true;
+    }
+    return VisibleComponents[CellIndex][ComponentIndex];
+}
+
+FIntVector FDSVisibilityGrid::GetCellCoords(int32 CellIndex) const
+{
+    const int32 SliceSize = Dimensions.X * Dimensions.Y;
+    return FIntVector(CellIndex % Dimensions.X, (CellIndex % SliceSize) / Dimensions.X, CellIndex / SliceSize);
+}
+
+int32 FDSVisibilityGrid::GetCellIndex(const FIntVector& Coords) const
+{
+    return Coords.X + Coords.Y * Dimensions.X + Coords.Z * Dimensions.X * Dimensions.Y;
+}
+
+FBox FDSVisibilityGrid::GetCellBox(int32 CellIndex) const
+{
+    const FIntVector Coords = GetCellCoords(CellIndex);
+    const FVector Min = GridBounds.Min + FVector(Coords.X, Coords.Y, Coords.Z) * CellExtent;
+    return FBox(Min, Min + CellExtent);
+}
+
+bool FDSVisibilityGrid::IsSegmentOccluded(const FVector& Start, const FVector& End, const TArray<FBox>& Occluders, const TArray<TArray<int32>>& CellOccluders) const
+{
+    const FVector Segment = End - Start;
+    const float StepLength = CellExtent.GetMin() * 0.5f;
+    const int32 NumSteps = FMath::Max(1, FMath::CeilToInt(Segment.Size() / StepLength));
+
+    int32 PreviousCell = INDEX_NONE;
+    for (int32 Step = 0; Step <= NumSteps; ++Step)
+    {
+        const int32 CellIndex = GetCellIndex(Start + Segment * ((float)Step / NumSteps));
+        if (CellIndex == INDEX_NONE || CellIndex == PreviousCell)
+        {
+            continue;
+        }
+        PreviousCell = CellIndex;
+
+        for (const int32 OccluderIndex : CellOccluders[CellIndex])
+        {
+            const FBox& Occluder = Occluders[OccluderIndex];
+
+            // Sample points inside an occluder would make it block everything, ignore it for this ray
+            if (Occluder.IsInsideOrOn(Start) || Occluder.IsInsideOrOn(End))
+            {
+                continue;
+            }
+
+            if (FMath::LineBoxIntersection(Occluder, Start, End, Segment))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,108 @@
+﻿// Copyright (c) 2025 Rudra Ojha
+// All rights reserved.
+//
+// This source code is provided for educational and reference purposes only.
+// Redistribution, modification, or use of this code in any commercial or private
+// product is strictly prohibited without explicit written permission from the author.
+//
+// Unauthorized use in any software or plugin distributed to end-users,
+// whether open-source or commercial, is not allowed.
+//
+// Contact: rudraojhaif@gmail.com for licensing inquiries.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Settings used when building a coarse visibility grid over imported geometry
+ */
+struct FDSVisibilityGridSettings
+{
+    /** Desired edge length of a cell in world units, grown automatically to respect MaxCells */
+    float CellSize = 400.0f;
+
+    /** Upper bound on the number of cells, keeps the cell-to-cell pass tractable */
+    int32 MaxCells = 1024;
+
+    /** Components thinner than this along one axis are candidates for occluders (walls, floors) */
+    float OccluderMaxThickness = 60.0f;
+
+    /** Minimum span along the two other axes for a thin component to count as an occluder */
+    float OccluderMinSpan = 150.0f;
+};
+
+/**
+ * FDSVisibilityGrid - Precomputed cell-to-cell visibility for imported interiors
+ *
+ * The grid partitions the bounds of the imported scene into uniform cells and,
+ * using slab-like components (walls, floors, ceilings) as solid occluders,
+ * determines which cells can see each other. For every cell it stores the set
+ * of components that may be visible from inside it, so the runtime only needs
+ * a cell lookup and a bit test per component.
+ *
+ * Building is pure CPU work on plain data and is safe to run on a background thread.
+ */
+class DATASMITHTEST_API FDSVisibilityGrid
+{
+public:
+    /**
+     * Builds the grid from the world-space bounds of the imported components
+     * @param ComponentBounds Bounds of each component, indexed the same way queries are
+     * @param Settings Cell and occluder settings
+     * @return The built grid, or nullptr if there is nothing to build
+     */
+    static TSharedPtr<FDSVisibilityGrid, ESPMode::ThreadSafe> Build(const TArray<FBox>& ComponentBounds, const FDSVisibilityGridSettings& Settings);
+
+    /**
+     * Computes a hash identifying a scene layout and grid settings, used to validate cached grids
+     */
+    static uint32 ComputeSceneHash(const TArray<FBox>& ComponentBounds, const FDSVisibilityGridSettings& Settings);
+
+    /**
+     * Loads a previously saved grid
+     * @param FilePath Path of the cache file
+     * @param ExpectedSceneHash Hash of the current scene; the cache is rejected if it differs
+     * @return The loaded grid, or nullptr if the file is missing, stale or corrupt
+     */
+    static TSharedPtr<FDSVisibilityGrid, ESPMode::ThreadSafe> LoadFromFile(const FString& FilePath, uint32 ExpectedSceneHash);
+
+    /**
+     * Saves the grid so later sessions can skip the build
+     * @return True if the file was written
+     */
+    bool SaveToFile(const FString& FilePath) const;
+
+    /**
+     * Gets the cell containing a world location
+     * @return Cell index, or INDEX_NONE if the location is outside the grid
+     */
+    int32 GetCellIndex(const FVector& Location) const;
+
+    /**
+     * Checks whether a component may be visible from inside a cell
+     */
+    bool IsComponentVisibleFromCell(int32 CellIndex, int32 ComponentIndex) const;
+
+    int32 GetNumCells() const { return VisibleComponents.Num(); }
+    int32 GetNumComponents() const { return NumComponents; }
+    uint32 GetSceneHash() const { return SceneHash; }
+
+private:
+    FIntVector GetCellCoords(int32 CellIndex) const;
+    int32 GetCellIndex(const FIntVector& Coords) const;
+    FBox GetCellBox(int32 CellIndex) const;
+
+    /**
+     * Tests whether a segment passes through any occluder registered in the cells it crosses
+     */
+    bool IsSegmentOccluded(const FVector& Start, const FVector& End, const TArray<FBox>& Occluders, const TArray<TArray<int32>>& CellOccluders) const;
+
+    FBox GridBounds = FBox(ForceInit);
+    FIntVector Dimensions = FIntVector::ZeroValue;
+    FVector CellExtent = FVector::ZeroVector;
+    int32 NumComponents = 0;
+    uint32 SceneHash = 0;
+
+    /** Per cell, one bit per component that may be visible from the cell */
+    TArray<TBitArray<>> VisibleComponents;
+};
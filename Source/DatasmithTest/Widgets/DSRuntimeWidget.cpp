@@ -12,6 +12,7 @@
 #include "DSRuntimeWidget.h"
 #include "../Pawns/DSPawn.h"
 #include "../Actors/DSRuntimeManager.h"
+#include "../Runtime/DSTrace.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "Kismet/GameplayStatics.h"
@@ -20,6 +21,7 @@
 #include "Components/CheckBox.h"
 #include "Components/Button.h"
 #include "Components/TextBlock.h"
+#include "Components/ProgressBar.h"
 #include "EngineUtils.h"
 #include "DatasmithTest/Actors/DSLightSyncer.h"
 #include "HAL/IConsoleManager.h"
@@ -71,6 +73,25 @@ void UDSRuntimeWidget::NativeConstruct()
         NormalToleranceTextBox->OnTextCommitted.AddDynamic(this, &UDSRuntimeWidget::OnNormalToleranceCommitted);
     }
 
+    // Predictions follow the tolerances as they are typed, so their cost is known before they are committed
+    for (UEditableTextBox* TextBox : { ChordToleranceTextBox.Get(), MaxEdgeLengthTextBox.Get(), NormalToleranceTextBox.Get() })
+    {
+        if (TextBox)
+        {
+            TextBox->OnTextChanged.AddDynamic(this, &UDSRuntimeWidget::OnTessellationSettingChanged);
+        }
+    }
+
+    if (ViewIncludeFiltersTextBox)
+    {
+        ViewIncludeFiltersTextBox->OnTextCommitted.AddDynamic(this, &UDSRuntimeWidget::OnViewIncludeFiltersCommitted);
+    }
+
+    if (ViewExcludeFiltersTextBox)
+    {
+        ViewExcludeFiltersTextBox->OnTextCommitted.AddDynamic(this, &UDSRuntimeWidget::OnViewExcludeFiltersCommitted);
+    }
+
     // === DROPDOWN COMBO BOX EVENT BINDING ===
     // Set up event handlers for all dropdown selection changes
     if (StitchingTechniqueComboBox)
@@ -153,6 +174,21 @@ void UDSRuntimeWidget::NativeConstruct()
         SyncLightButton->OnClicked.AddDynamic(this, &UDSRuntimeWidget::OnLightSyncPressed);
     }
 
+    if (SceneCostCategoryComboBox)
+    {
+        SceneCostCategoryComboBox->OnSelectionChanged.AddDynamic(this, &UDSRuntimeWidget::OnSceneCostCategoryChanged);
+    }
+
+    if (SceneCostSortComboBox)
+    {
+        SceneCostSortComboBox->OnSelectionChanged.AddDynamic(this, &UDSRuntimeWidget::OnSceneCostSortChanged);
+    }
+
+    if (AnalyzeSceneCostButton)
+    {
+        AnalyzeSceneCostButton->OnClicked.AddDynamic(this, &UDSRuntimeWidget::OnAnalyzeSceneCostClicked);
+    }
+
     // Load current values from game objects and populate all UI controls
     RefreshAllValues();
 
@@ -172,6 +208,24 @@ void UDSRuntimeWidget::NativeDestruct()
     Super::NativeDestruct();
 }
 
+void UDSRuntimeWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+    Super::NativeTick(MyGeometry, InDeltaTime);
+
+    // Import progress changes every frame while the widget is open
+    RefreshImportStatus();
+
+    // Predictions finish in the background a few frames after the tolerances are edited
+    RefreshTessellationPrediction();
+
+    // Imports finish while the widget is open, show their scene cost report as soon as it exists
+    if (CurrentDSRuntimeManager.IsValid() && CurrentDSRuntimeManager->GetSceneCostReportNumber() != DisplayedSceneCostReportNumber)
+    {
+        PopulateSceneCostSortComboBox();
+        RefreshSceneCostTable();
+    }
+}
+
 void UDSRuntimeWidget::ShowWidget()
 {
     UE_LOG(LogDSRuntimeWidget, Log, TEXT("Showing DSRuntimeWidget"));
@@ -311,6 +365,17 @@ void UDSRuntimeWidget::InitializeComboBoxes()
     PopulateHierarchyMethodComboBox();
     PopulateCollisionEnabledComboBox();
     PopulateCollisionTraceFlagComboBox();
+
+    if (SceneCostCategoryComboBox && CurrentDSRuntimeManager.IsValid())
+    {
+        SceneCostCategoryComboBox->ClearOptions();
+        for (const FString& Category : CurrentDSRuntimeManager->GetSceneCostCategories())
+        {
+            SceneCostCategoryComboBox->AddOption(Category);
+        }
+        SceneCostCategoryComboBox->SetSelectedIndex(0);
+    }
+
     // Update DirectLink sources list (may change dynamically)
     RefreshDirectLinkSources();
 }
@@ -506,6 +571,16 @@ void UDSRuntimeWidget::RefreshDatasmithValues()
         ImportMetadataCheckBox->SetIsChecked(CurrentDSRuntimeManager->GetImportMetadata());
     }
 
+    if (ViewIncludeFiltersTextBox)
+    {
+        ViewIncludeFiltersTextBox->SetText(FText::FromString(FString::Join(CurrentDSRuntimeManager->GetViewIncludeFilters(), TEXT("; "))));
+    }
+
+    if (ViewExcludeFiltersTextBox)
+    {
+        ViewExcludeFiltersTextBox->SetText(FText::FromString(FString::Join(CurrentDSRuntimeManager->GetViewExcludeFilters(), TEXT("; "))));
+    }
+
     // === UPDATE DIRECTLINK CONNECTION SETTINGS ===
     if (DirectLinkSourceComboBox)
     {
@@ -540,6 +615,122 @@ void UDSRuntimeWidget::RefreshRaytracingValues()
     }
 }
 
+void UDSRuntimeWidget::RefreshImportStatus()
+{
+    // Both status widgets are optional in the widget blueprint
+    if ((!ImportStatusTextBlock && !ImportProgressBar) || !CurrentDSRuntimeManager.IsValid())
+    {
+        return;
+    }
+
+    FString StatusText = TEXT("Idle");
+    float Progress = 1.0f;
+
+    if (CurrentDSRuntimeManager->IsImportRestartPending())
+    {
+        StatusText = TEXT("Restarting import...");
+        Progress = 0.0f;
+    }
+    else if (CurrentDSRuntimeManager->IsImportInProgress())
+    {
+        StatusText = CurrentDSRuntimeManager->IsSceneSwapPending() ? TEXT("Reimporting in background...") : TEXT("Importing...");
+        Progress = 0.0f;
+    }
+    else if (CurrentDSRuntimeManager->IsPSOPrecacheInProgress())
+    {
+        Progress = CurrentDSRuntimeManager->GetPSOPrecacheProgress();
+        StatusText = FString::Printf(TEXT("Compiling shaders: %d%%"), FMath::RoundToInt(Progress * 100.0f));
+    }
+
+    if (ImportStatusTextBlock)
+    {
+        ImportStatusTextBlock->SetText(FText::FromString(StatusText));
+    }
+
+    if (ImportProgressBar)
+    {
+        ImportProgressBar->SetPercent(Progress);
+    }
+}
+
+void UDSRuntimeWidget::RefreshTessellationPrediction()
+{
+    if (!CurrentDSRuntimeManager.IsValid())
+    {
+        return;
+    }
+
+    FString PredictionText = CurrentDSRuntimeManager->GetTessellationPrediction();
+    if (PredictionText.IsEmpty() && CurrentDSRuntimeManager->IsTessellationPredictionInProgress())
+    {
+        PredictionText = TEXT("Estimating tessellation cost...");
+    }
+
+    if (PredictionText == DisplayedTessellationPrediction)
+    {
+        return;
+    }
+    DisplayedTessellationPrediction = PredictionText;
+
+    if (TessellationPredictionTextBlock)
+    {
+        TessellationPredictionTextBlock->SetText(FText::FromString(PredictionText));
+        return;
+    }
+
+    // Layouts without the prediction text block show it when hovering the tolerances
+    for (UEditableTextBox* TextBox : { ChordToleranceTextBox.Get(), MaxEdgeLengthTextBox.Get(), NormalToleranceTextBox.Get() })
+    {
+        if (TextBox)
+        {
+            TextBox->SetToolTipText(FText::FromString(PredictionText));
+        }
+    }
+}
+
+void UDSRuntimeWidget::PopulateSceneCostSortComboBox()
+{
+    if (!SceneCostSortComboBox || !SceneCostCategoryComboBox || !CurrentDSRuntimeManager.IsValid())
+    {
+        return;
+    }
+
+    // Keep the sort column when it exists in the new category, columns differ between categories
+    const FString PreviousColumn = SceneCostSortComboBox->GetSelectedOption();
+    const TArray<FString> Columns = CurrentDSRuntimeManager->GetSceneCostColumns(SceneCostCategoryComboBox->GetSelectedIndex());
+
+    bIsUpdatingValues = true;
+    SceneCostSortComboBox->ClearOptions();
+    for (const FString& Column : Columns)
+    {
+        SceneCostSortComboBox->AddOption(Column);
+    }
+    if (Columns.Num() > 0)
+    {
+        SceneCostSortComboBox->SetSelectedIndex(FMath::Max(Columns.IndexOfByKey(PreviousColumn), 0));
+    }
+    bIsUpdatingValues = false;
+}
+
+void UDSRuntimeWidget::RefreshSceneCostTable()
+{
+    if (!CurrentDSRuntimeManager.IsValid())
+    {
+        return;
+    }
+
+    DisplayedSceneCostReportNumber = CurrentDSRuntimeManager->GetSceneCostReportNumber();
+
+    if (!SceneCostTextBlock || !SceneCostCategoryComboBox)
+    {
+        return;
+    }
+
+    const int32 SortColumn = SceneCostSortComboBox ? FMath::Max(SceneCostSortComboBox->GetSelectedIndex(), 0) : 0;
+    const FString Table = CurrentDSRuntimeManager->GetSceneCostTable(SceneCostCategoryComboBox->GetSelectedIndex(), SortColumn, SceneCostTableRows);
+    SceneCostTextBlock->SetText(FText::FromString(Table.IsEmpty() ? TEXT("No scene cost report yet") : Table));
+}
+
 // === Event Handlers - Text Input ===
 
 void UDSRuntimeWidget::OnMaxSpeedCommitted(const FText& Text, ETextCommit::Type CommitMethod)
@@ -550,6 +741,8 @@ void UDSRuntimeWidget::OnMaxSpeedCommitted(const FText& Text, ETextCommit::Type
         return;
     }
 
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnMaxSpeedCommitted);
+
     float NewMaxSpeed;
     // Validate the input text as a valid float value
     if (ValidateFloatInput(Text, NewMaxSpeed))
@@ -574,6 +767,8 @@ void UDSRuntimeWidget::OnChordToleranceCommitted(const FText& Text, ETextCommit:
         return;
     }
 
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnChordToleranceCommitted);
+
     float NewValue;
     // Validate and parse the input value
     if (ValidateFloatInput(Text, NewValue))
@@ -598,6 +793,8 @@ void UDSRuntimeWidget::OnMaxEdgeLengthCommitted(const FText& Text, ETextCommit::
         return;
     }
 
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnMaxEdgeLengthCommitted);
+
     float NewValue;
     // Parse and validate the input
     if (ValidateFloatInput(Text, NewValue))
@@ -622,6 +819,8 @@ void UDSRuntimeWidget::OnNormalToleranceCommitted(const FText& Text, ETextCommit
         return;
     }
 
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnNormalToleranceCommitted);
+
     float NewValue;
     // Validate the entered tolerance value
     if (ValidateFloatInput(Text, NewValue))
@@ -638,6 +837,72 @@ void UDSRuntimeWidget::OnNormalToleranceCommitted(const FText& Text, ETextCommit
     }
 }
 
+void UDSRuntimeWidget::OnTessellationSettingChanged(const FText& Text)
+{
+    // Skip processing during programmatic updates or if manager is invalid
+    if (bIsUpdatingValues || !CurrentDSRuntimeManager.IsValid())
+    {
+        return;
+    }
+
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnTessellationSettingChanged);
+
+    // Fields that do not parse yet while being typed in keep the manager's current value
+    float ChordTolerance = CurrentDSRuntimeManager->GetChordTolerance();
+    float MaxEdgeLength = CurrentDSRuntimeManager->GetMaxEdgeLength();
+    float NormalTolerance = CurrentDSRuntimeManager->GetNormalTolerance();
+
+    float Value;
+    if (ChordToleranceTextBox && ValidateFloatInput(ChordToleranceTextBox->GetText(), Value))
+    {
+        ChordTolerance = Value;
+    }
+    if (MaxEdgeLengthTextBox && ValidateFloatInput(MaxEdgeLengthTextBox->GetText(), Value))
+    {
+        MaxEdgeLength = Value;
+    }
+    if (NormalToleranceTextBox && ValidateFloatInput(NormalToleranceTextBox->GetText(), Value))
+    {
+        NormalTolerance = Value;
+    }
+
+    CurrentDSRuntimeManager->PredictTessellationCost(ChordTolerance, MaxEdgeLength, NormalTolerance);
+}
+
+void UDSRuntimeWidget::OnViewIncludeFiltersCommitted(const FText& Text, ETextCommit::Type CommitMethod)
+{
+    // Skip processing during programmatic updates or if manager is invalid
+    if (bIsUpdatingValues || !CurrentDSRuntimeManager.IsValid())
+    {
+        return;
+    }
+
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnViewIncludeFiltersCommitted);
+
+    // Rules are separated by semicolons, empty entries are dropped
+    TArray<FString> Filters;
+    Text.ToString().ParseIntoArray(Filters, TEXT(";"), true);
+    CurrentDSRuntimeManager->SetViewIncludeFilters(Filters);
+    UE_LOG(LogDSRuntimeWidget, Log, TEXT("Set view include filters to: %s"), *Text.ToString());
+}
+
+void UDSRuntimeWidget::OnViewExcludeFiltersCommitted(const FText& Text, ETextCommit::Type CommitMethod)
+{
+    // Skip processing during programmatic updates or if manager is invalid
+    if (bIsUpdatingValues || !CurrentDSRuntimeManager.IsValid())
+    {
+        return;
+    }
+
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnViewExcludeFiltersCommitted);
+
+    // Rules are separated by semicolons, empty entries are dropped
+    TArray<FString> Filters;
+    Text.ToString().ParseIntoArray(Filters, TEXT(";"), true);
+    CurrentDSRuntimeManager->SetViewExcludeFilters(Filters);
+    UE_LOG(LogDSRuntimeWidget, Log, TEXT("Set view exclude filters to: %s"), *Text.ToString());
+}
+
 // === Event Handlers - Combo Boxes ===
 
 void UDSRuntimeWidget::OnStitchingTechniqueChanged(FString SelectedItem, ESelectInfo::Type SelectionType)
@@ -648,6 +913,8 @@ void UDSRuntimeWidget::OnStitchingTechniqueChanged(FString SelectedItem, ESelect
         return;
     }
 
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnStitchingTechniqueChanged);
+
     // Convert the selected string back to the corresponding enum value
     const EDatasmithCADStitchingTechnique NewTechnique = StringToStitchingTechnique(SelectedItem);
     // Apply the new stitching technique setting
@@ -663,6 +930,8 @@ void UDSRuntimeWidget::OnHierarchyMethodChanged(FString SelectedItem, ESelectInf
         return;
     }
 
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnHierarchyMethodChanged);
+
     // Convert display string to enum value
     const EBuildHierarchyMethod NewMethod = StringToHierarchyMethod(SelectedItem);
     // Update the hierarchy building method
@@ -678,6 +947,8 @@ void UDSRuntimeWidget::OnCollisionEnabledChanged(FString SelectedItem, ESelectIn
         return;
     }
 
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnCollisionEnabledChanged);
+
     // Parse the collision type from the selected string
     const ECollisionEnabled::Type NewCollision = StringToCollisionEnabled(SelectedItem);
     // Apply the new collision detection setting
@@ -693,6 +964,8 @@ void UDSRuntimeWidget::OnCollisionTraceFlagChanged(FString SelectedItem, ESelect
         return;
     }
 
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnCollisionTraceFlagChanged);
+
     // Convert string selection to enum value
     const ECollisionTraceFlag NewTraceFlag = StringToCollisionTraceFlag(SelectedItem);
     // Update the collision trace flag setting
@@ -708,6 +981,8 @@ void UDSRuntimeWidget::OnDirectLinkSourceChanged(FString SelectedItem, ESelectIn
         return;
     }
 
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnDirectLinkSourceChanged);
+
     // Parse the source index from "Source X" format string
     FString IndexString;
     if (SelectedItem.Split(TEXT(" "), nullptr, &IndexString))
@@ -723,6 +998,31 @@ void UDSRuntimeWidget::OnDirectLinkSourceChanged(FString SelectedItem, ESelectIn
     }
 }
 
+void UDSRuntimeWidget::OnSceneCostCategoryChanged(FString SelectedItem, ESelectInfo::Type SelectionType)
+{
+    if (bIsUpdatingValues || !CurrentDSRuntimeManager.IsValid())
+    {
+        return;
+    }
+
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnSceneCostCategoryChanged);
+
+    PopulateSceneCostSortComboBox();
+    RefreshSceneCostTable();
+}
+
+void UDSRuntimeWidget::OnSceneCostSortChanged(FString SelectedItem, ESelectInfo::Type SelectionType)
+{
+    if (bIsUpdatingValues || !CurrentDSRuntimeManager.IsValid())
+    {
+        return;
+    }
+
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnSceneCostSortChanged);
+
+    RefreshSceneCostTable();
+}
+
 // === Event Handlers - Check Boxes ===
 
 void UDSRuntimeWidget::OnImportMetadataChanged(bool bIsChecked)
@@ -733,6 +1033,8 @@ void UDSRuntimeWidget::OnImportMetadataChanged(bool bIsChecked)
         return;
     }
 
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnImportMetadataChanged);
+
     // Update the metadata import flag in the runtime manager
     CurrentDSRuntimeManager->SetImportMetadata(bIsChecked);
     UE_LOG(LogDSRuntimeWidget, Log, TEXT("Set import metadata to: %s"), bIsChecked ? TEXT("true") : TEXT("false"));
@@ -746,6 +1048,8 @@ void UDSRuntimeWidget::OnRaytracingShadowsChanged(bool bIsChecked)
         return;
     }
 
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnRaytracingShadowsChanged);
+
     // Update local state and apply the setting to the rendering system
     bRaytracingShadowsEnabled = bIsChecked;
     ApplyRaytracingShadowsSetting();
@@ -760,6 +1064,8 @@ void UDSRuntimeWidget::OnRaytracingAmbientOcclusionChanged(bool bIsChecked)
         return;
     }
 
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnRaytracingAmbientOcclusionChanged);
+
     // Store the new state and apply it to the render settings
     bRaytracingAmbientOcclusionEnabled = bIsChecked;
     ApplyRaytracingAmbientOcclusionSetting();
@@ -774,6 +1080,8 @@ void UDSRuntimeWidget::OnRaytracingGlobalIlluminationChanged(bool bIsChecked)
         return;
     }
 
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnRaytracingGlobalIlluminationChanged);
+
     // Update local flag and apply to rendering pipeline
     bRaytracingGlobalIlluminationEnabled = bIsChecked;
     ApplyRaytracingGlobalIlluminationSetting();
@@ -788,6 +1096,8 @@ void UDSRuntimeWidget::OnRaytracingReflectionsChanged(bool bIsChecked)
         return;
     }
 
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnRaytracingReflectionsChanged);
+
     // Save the new setting and configure the rendering system
     bRaytracingReflectionsEnabled = bIsChecked;
     ApplyRaytracingReflectionsSetting();
@@ -798,6 +1108,8 @@ void UDSRuntimeWidget::OnRaytracingReflectionsChanged(bool bIsChecked)
 
 void UDSRuntimeWidget::OnUpdateDirectLinkClicked()
 {
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnUpdateDirectLinkClicked);
+
     // Ensure we have a valid runtime manager before proceeding
     if (!CurrentDSRuntimeManager.IsValid())
     {
@@ -822,6 +1134,8 @@ void UDSRuntimeWidget::OnUpdateDirectLinkClicked()
 
 void UDSRuntimeWidget::OnRefreshSourcesClicked()
 {
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnRefreshSourcesClicked);
+
     UE_LOG(LogDSRuntimeWidget, Log, TEXT("Refreshing DirectLink sources..."));
     // Query the runtime manager for updated source list and refresh the dropdown
     RefreshDirectLinkSources();
@@ -829,6 +1143,8 @@ void UDSRuntimeWidget::OnRefreshSourcesClicked()
 
 void UDSRuntimeWidget::OnApplySettingsClicked()
 {
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnApplySettingsClicked);
+
     // Verify we have a valid runtime manager reference
     if (!CurrentDSRuntimeManager.IsValid())
     {
@@ -837,8 +1153,8 @@ void UDSRuntimeWidget::OnApplySettingsClicked()
     }
 
     UE_LOG(LogDSRuntimeWidget, Log, TEXT("Applying import settings..."));
-    // Tell the runtime manager to apply all current import option settings
-    const bool bSuccess = CurrentDSRuntimeManager->ApplyImportOptions();
+    // Reimport with the current settings, the previous scene stays on screen until the new one is ready
+    const bool bSuccess = CurrentDSRuntimeManager->RestartImport();
     
     // Report the outcome of the settings application
     if (bSuccess)
@@ -847,18 +1163,43 @@ void UDSRuntimeWidget::OnApplySettingsClicked()
     }
     else
     {
-        LogError(TEXT("Failed to apply import settings"));
+        LogError(TEXT("Failed to reimport with the new settings - they apply to the next DirectLink connection"));
     }
 }
 
 void UDSRuntimeWidget::OnCloseClicked()
 {
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnCloseClicked);
+
     // Simply hide the widget when close button is pressed
     HideWidget();
 }
 
+void UDSRuntimeWidget::OnAnalyzeSceneCostClicked()
+{
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnAnalyzeSceneCostClicked);
+
+    if (!CurrentDSRuntimeManager.IsValid())
+    {
+        LogError(TEXT("Cannot analyze scene cost - no DSRuntimeManager found"));
+        return;
+    }
+
+    const FString ReportPath = CurrentDSRuntimeManager->AnalyzeSceneCost();
+    if (ReportPath.IsEmpty())
+    {
+        LogWarning(TEXT("Scene cost report could not be written"));
+    }
+
+    // The tick refresh would pick the new report up as well, this shows it before the next frame
+    PopulateSceneCostSortComboBox();
+    RefreshSceneCostTable();
+}
+
 void UDSRuntimeWidget::OnLightSyncPressed()
 {
+    DS_TRACE_UI_ACTION(UDSRuntimeWidget::OnLightSyncPressed);
+
     if (!CurrentDSLightSyncer.IsValid())
     {
         LogError(TEXT("Cannot update lightsync - no DSLightSyncer found"));
@@ -18,6 +18,7 @@
 #include "Components/CheckBox.h"
 #include "Components/Button.h"
 #include "Components/TextBlock.h"
+#include "Components/ProgressBar.h"
 #include "DatasmithRuntime.h"
 #include "DSRuntimeWidget.generated.h"
 
@@ -50,6 +51,7 @@ public:
 protected:
     virtual void NativeConstruct() override;
     virtual void NativeDestruct() override;
+    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
     // === UI Components ===
     
@@ -67,6 +69,10 @@ protected:
     UPROPERTY(meta = (BindWidget))
     TObjectPtr<UEditableTextBox> NormalToleranceTextBox;
 
+    // Predicted cost of the tolerances being edited (optional, shown as the tolerance boxes' tooltip without it)
+    UPROPERTY(meta = (BindWidgetOptional))
+    TObjectPtr<UTextBlock> TessellationPredictionTextBlock;
+
     UPROPERTY(meta = (BindWidget))
     TObjectPtr<UComboBoxString> StitchingTechniqueComboBox;
 
@@ -85,6 +91,13 @@ protected:
     UPROPERTY(meta = (BindWidget))
     TObjectPtr<UCheckBox> ImportMetadataCheckBox;
 
+    // View filters (optional), "Key=Pattern" rules separated by semicolons; failing elements are not built
+    UPROPERTY(meta = (BindWidgetOptional))
+    TObjectPtr<UEditableTextBox> ViewIncludeFiltersTextBox;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    TObjectPtr<UEditableTextBox> ViewExcludeFiltersTextBox;
+
     // Raytracing Graphics Settings
     UPROPERTY(meta = (BindWidget))
     TObjectPtr<UCheckBox> RaytracingShadowsCheckBox;
@@ -121,6 +134,26 @@ protected:
     UPROPERTY(meta = (BindWidget))
     TObjectPtr<UButton> SyncLightButton;
 
+    // Import Status (optional, shows import and shader precompilation progress)
+    UPROPERTY(meta = (BindWidgetOptional))
+    TObjectPtr<UTextBlock> ImportStatusTextBlock;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    TObjectPtr<UProgressBar> ImportProgressBar;
+
+    // Scene Cost (optional, ranks the heaviest contributors of the imported scene)
+    UPROPERTY(meta = (BindWidgetOptional))
+    TObjectPtr<UComboBoxString> SceneCostCategoryComboBox;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    TObjectPtr<UComboBoxString> SceneCostSortComboBox;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    TObjectPtr<UTextBlock> SceneCostTextBlock;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    TObjectPtr<UButton> AnalyzeSceneCostButton;
+
 private:
     // === Utility ===
     bool FirstTimeLightSync = true;
@@ -142,6 +175,17 @@ private:
     /** Flag to prevent recursive updates when setting values */
     bool bIsUpdatingValues = false;
 
+    /** Tessellation prediction currently shown, to only update the display when it changes */
+    FString DisplayedTessellationPrediction;
+
+    // === Scene Cost Display ===
+
+    /** Number of the scene cost report currently shown, a different number means the table is stale */
+    int32 DisplayedSceneCostReportNumber = 0;
+
+    /** Number of rows shown in the scene cost table */
+    static constexpr int32 SceneCostTableRows = 15;
+
     // === Raytracing Settings Storage ===
     
     /** Current raytracing shadows state */
@@ -216,6 +260,11 @@ private:
      */
     void RefreshDirectLinkSources();
 
+    /**
+     * Fills the scene cost sort combo box with the columns of the selected category
+     */
+    void PopulateSceneCostSortComboBox();
+
     // === Value Update Methods ===
 
     /**
@@ -238,6 +287,21 @@ private:
      */
     void RefreshRaytracingValues();
 
+    /**
+     * Updates the import status text and progress bar from the runtime manager
+     */
+    void RefreshImportStatus();
+
+    /**
+     * Shows the latest tessellation cost prediction from the runtime manager
+     */
+    void RefreshTessellationPrediction();
+
+    /**
+     * Shows the selected category of the last scene cost report, sorted by the selected column
+     */
+    void RefreshSceneCostTable();
+
     // === Event Handlers - Text Input ===
 
     /**
@@ -264,6 +328,24 @@ private:
     UFUNCTION()
     void OnNormalToleranceCommitted(const FText& Text, ETextCommit::Type CommitMethod);
 
+    /**
+     * Called while any tessellation text box is edited, before it is committed
+     */
+    UFUNCTION()
+    void OnTessellationSettingChanged(const FText& Text);
+
+    /**
+     * Called when the view include filters text box is committed
+     */
+    UFUNCTION()
+    void OnViewIncludeFiltersCommitted(const FText& Text, ETextCommit::Type CommitMethod);
+
+    /**
+     * Called when the view exclude filters text box is committed
+     */
+    UFUNCTION()
+    void OnViewExcludeFiltersCommitted(const FText& Text, ETextCommit::Type CommitMethod);
+
     // === Event Handlers - Combo Boxes ===
 
     /**
@@ -296,6 +378,18 @@ private:
     UFUNCTION()
     void OnDirectLinkSourceChanged(FString SelectedItem, ESelectInfo::Type SelectionType);
 
+    /**
+     * Called when the scene cost category combo box selection changes
+     */
+    UFUNCTION()
+    void OnSceneCostCategoryChanged(FString SelectedItem, ESelectInfo::Type SelectionType);
+
+    /**
+     * Called when the scene cost sort column combo box selection changes
+     */
+    UFUNCTION()
+    void OnSceneCostSortChanged(FString SelectedItem, ESelectInfo::Type SelectionType);
+
     // === Event Handlers - Check Boxes ===
 
     /**
@@ -360,6 +454,12 @@ private:
     UFUNCTION()
     void OnLightSyncPressed();
 
+    /**
+     * Called when the Analyze Scene Cost button is clicked
+     */
+    UFUNCTION()
+    void OnAnalyzeSceneCostClicked();
+
     // === Utility Methods ===
 
     /**